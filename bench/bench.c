@@ -0,0 +1,292 @@
+/**
+ * @file bench.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Benchmark harness. Each container is measured in a forked child process so that
+ * peak RSS is attributed to a single container and size. Results are printed to stdout as
+ * CSV (or JSON lines with -j) with one row per operation.
+*/
+
+#include "bench.h"
+
+#include <getopt.h>
+#include <inttypes.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#define BENCH_MIN_N 1000
+
+typedef struct {
+    const char *name; // Name of the container type, used for filtering with -c
+    bench_func  func; // Runs every operation for the container at a given size
+} BenchSuite_t;
+
+static const BenchSuite_t suites[] = {
+    { "Buffer_t",    bench_buffer },
+    { "Stack_t",     bench_stack  },
+    { "LLNode_t",    bench_ll     },
+    { "BTreeNode_t", bench_btree  },
+    { "Map_t",       bench_hmap   },
+    { "CMap_t",      bench_chmap  },
+    { "STree_t",     bench_stree  },
+    { "SkipList_t",  bench_skiplist },
+    { "Heap_t",      bench_heap   },
+    { "TimerWheel_t", bench_twheel },
+    { "Cache_t",     bench_cache  },
+    { "Bloom_t",     bench_bloom  },
+    { "Cuckoo_t",    bench_cuckoo },
+    { "Intern_t",    bench_intern },
+    { "Sort",        bench_sort   },
+    { "ThreadPool_t", bench_pool  },
+    { "BitVec_t",    bench_bitvec },
+    { "PackedArray_t", bench_packed },
+};
+
+static bool   json = false;
+static size_t allocs = 0;
+
+/*
+ * ===============================
+ *     Allocation Counting
+ * ===============================
+ */
+
+// The library is linked with --wrap so that each of its heap calls lands here first
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    ++allocs;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t nmemb, size_t size) {
+    ++allocs;
+    return __real_calloc(nmemb, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    ++allocs;
+    return __real_realloc(ptr, size);
+}
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static long _bench_peak_rss_kb(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+static int _bench_cmp_u64(const void *lhs, const void *rhs) {
+    const uint64_t a = *(const uint64_t*)lhs;
+    const uint64_t b = *(const uint64_t*)rhs;
+    return (a > b) - (a < b);
+}
+
+// Rows without per-operation samples leave the p99_ns and max_ns columns empty (null in JSON)
+static void _bench_print(
+    const char *container,
+    const char *op,
+    const size_t n,
+    const double ns_per_op,
+    const double allocs_per_op,
+    const bool tail,
+    const uint64_t p99_ns,
+    const uint64_t max_ns
+) {
+    char p99[24] = "";
+    char max[24] = "";
+
+    if (tail) {
+        snprintf(p99, sizeof(p99), "%" PRIu64, p99_ns);
+        snprintf(max, sizeof(max), "%" PRIu64, max_ns);
+    }
+
+    if (json) {
+        printf(
+            "{\"container\":\"%s\",\"op\":\"%s\",\"n\":%zu,\"ns_per_op\":%.3f,"
+            "\"allocs_per_op\":%.3f,\"peak_rss_kb\":%ld,\"p99_ns\":%s,\"max_ns\":%s}\n",
+            container, op, n, ns_per_op, allocs_per_op, _bench_peak_rss_kb(),
+            tail ? p99 : "null", tail ? max : "null"
+        );
+    } else {
+        printf("%s,%s,%zu,%.3f,%.3f,%ld,%s,%s\n",
+            container, op, n, ns_per_op, allocs_per_op, _bench_peak_rss_kb(), p99, max
+        );
+    }
+}
+
+static void _bench_run(const BenchSuite_t *suite, const size_t n) {
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        exit(EXIT_FAILURE);
+    } else if (pid == 0) {
+        // exit() rather than _exit() so that profile data is written when building for PGO
+        suite->func(n);
+        exit(EXIT_SUCCESS);
+    }
+
+    int status;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+        fprintf(stderr, "bench: %s with n=%zu did not complete\n", suite->name, n);
+    }
+}
+
+static void _bench_usage(const char *argv0) {
+    fprintf(stderr,
+        "Usage: %s [-n max] [-c container] [-j]\n"
+        "  -n max        Largest container size (default: %d); sizes step by 10x from %d\n"
+        "  -c container  Only run the named container (e.g. Map_t)\n"
+        "  -j            Print JSON lines instead of CSV\n",
+        argv0, 1000000, BENCH_MIN_N
+    );
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Reads the monotonic clock.
+ * @returns The current time in nanoseconds
+ */
+uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Begins measuring an operation.
+ * @param[out] timer The timer to start
+ * @param[in] container The name of the container being measured
+ */
+void bench_start(BenchTimer_t *timer, const char *container) {
+    timer->container = container;
+    timer->allocs = allocs;
+    timer->start_ns = bench_now_ns();
+}
+
+/**
+ * @brief Finishes measuring an operation and prints the result row.
+ * @param[in] timer The timer returned from bench_start()
+ * @param[in] op The name of the operation being measured
+ * @param[in] n The number of elements held by the container
+ * @param[in] nops The number of operations performed since bench_start()
+ */
+void bench_stop(const BenchTimer_t *timer, const char *op, const size_t n, const size_t nops) {
+    const uint64_t elapsed = bench_now_ns() - timer->start_ns;
+    const size_t nallocs = allocs - timer->allocs;
+    const double ns_per_op = (nops != 0) ? (double)elapsed / (double)nops : 0.0;
+    const double allocs_per_op = (nops != 0) ? (double)nallocs / (double)nops : 0.0;
+
+    bench_report(timer->container, op, n, ns_per_op, allocs_per_op);
+}
+
+/**
+ * @brief Finishes measuring an operation whose latency was sampled per operation and prints the
+ * result row, including the 99th percentile and the worst case.
+ * @param[in] timer The timer returned from bench_start()
+ * @param[in] op The name of the operation being measured
+ * @param[in] n The number of elements held by the container
+ * @param[in/out] lat The latency of each operation in nanoseconds (sorted in place)
+ * @param[in] nops The number of operations performed since bench_start()
+ */
+void bench_stop_latency(const BenchTimer_t *timer, const char *op, const size_t n, uint64_t *lat, const size_t nops) {
+    const size_t nallocs = allocs - timer->allocs;
+    uint64_t total = 0;
+
+    if (nops == 0) {
+        bench_report(timer->container, op, n, 0.0, 0.0);
+        return;
+    }
+    for (size_t i = 0; i < nops; ++i) {
+        total += lat[i];
+    }
+    qsort(lat, nops, sizeof(uint64_t), _bench_cmp_u64);
+
+    _bench_print(
+        timer->container, op, n, (double)total / (double)nops, (double)nallocs / (double)nops,
+        true, lat[nops - nops / 100 - 1], lat[nops - 1]
+    );
+}
+
+/**
+ * @brief Prints a result row for a measurement taken without bench_start().
+ * @param[in] container The name of the container being measured
+ * @param[in] op The name of the operation being measured
+ * @param[in] n The number of elements held by the container
+ * @param[in] ns_per_op The reported latency in nanoseconds
+ * @param[in] allocs_per_op The reported number of allocations per operation
+ */
+void bench_report(
+    const char *container,
+    const char *op,
+    const size_t n,
+    const double ns_per_op,
+    const double allocs_per_op
+) {
+    _bench_print(container, op, n, ns_per_op, allocs_per_op, false, 0, 0);
+}
+
+/**
+ * @brief Maps an index onto a unique, well-mixed 64-bit key (splitmix64 finalizer).
+ * @param[in] i The index
+ * @returns The key for index i
+ */
+uint64_t bench_key(const uint64_t i) {
+    uint64_t z = i + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+int main(int argc, char **argv) {
+    size_t max_n = 1000000;
+    const char *only = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:c:j")) != -1) {
+        switch (opt) {
+            case 'n':
+                max_n = (size_t)strtoull(optarg, NULL, 10);
+                break;
+            case 'c':
+                only = optarg;
+                break;
+            case 'j':
+                json = true;
+                break;
+            default:
+                _bench_usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (!json) {
+        printf("container,op,n,ns_per_op,allocs_per_op,peak_rss_kb,p99_ns,max_ns\n");
+    }
+    fflush(stdout);
+
+    for (size_t i = 0; i < sizeof(suites) / sizeof(*suites); ++i) {
+        if (only != NULL && strcmp(only, suites[i].name) != 0) {
+            continue;
+        }
+        for (size_t n = BENCH_MIN_N; n <= max_n; n *= 10) {
+            _bench_run(&suites[i], n);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
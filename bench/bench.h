@@ -0,0 +1,52 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "dsc_common.h"
+
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+typedef struct {
+    const char *container; // Name of the container type being measured
+    uint64_t    start_ns;  // Monotonic timestamp taken when the measurement began
+    size_t      allocs;    // Allocation count taken when the measurement began
+} BenchTimer_t;
+
+typedef void (* const bench_func)(const size_t n);
+
+// Forward function declarations
+
+uint64_t       bench_now_ns(void);
+void           bench_start(BenchTimer_t *timer, const char *container);
+void           bench_stop(const BenchTimer_t *timer, const char *op, const size_t n, const size_t nops);
+void           bench_stop_latency(const BenchTimer_t *timer, const char *op, const size_t n, uint64_t *lat, const size_t nops);
+void           bench_report(const char *container, const char *op, const size_t n, const double ns_per_op, const double allocs_per_op);
+uint64_t       bench_key(const uint64_t i);
+
+void           bench_buffer(const size_t n);
+void           bench_stack(const size_t n);
+void           bench_ll(const size_t n);
+void           bench_btree(const size_t n);
+void           bench_hmap(const size_t n);
+void           bench_chmap(const size_t n);
+void           bench_stree(const size_t n);
+void           bench_skiplist(const size_t n);
+void           bench_heap(const size_t n);
+void           bench_twheel(const size_t n);
+void           bench_cache(const size_t n);
+void           bench_bloom(const size_t n);
+void           bench_cuckoo(const size_t n);
+void           bench_intern(const size_t n);
+void           bench_sort(const size_t n);
+void           bench_pool(const size_t n);
+void           bench_bitvec(const size_t n);
+void           bench_packed(const size_t n);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // BENCH_H
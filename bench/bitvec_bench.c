@@ -0,0 +1,38 @@
+#include "bench.h"
+#include "bitvec.h"
+
+void bench_bitvec(const size_t n) {
+    BenchTimer_t timer;
+    BitVec_t bv;
+    volatile size_t sink = 0;
+
+    // About half the bits set
+    dsc_bitvec_init(&bv, n);
+    for (size_t i = 0; i < n; ++i) {
+        if (bench_key(i) & 1) {
+            dsc_bitvec_set(&bv, i, true);
+        }
+    }
+
+    bench_start(&timer, "BitVec_t");
+    dsc_bitvec_build(&bv);
+    bench_stop(&timer, "build", n, n);
+
+    bench_start(&timer, "BitVec_t");
+    for (size_t i = 0; i < n; ++i) {
+        sink += dsc_bitvec_rank(&bv, bench_key(n + i) % n);
+    }
+    bench_stop(&timer, "rank", n, n);
+
+    const size_t ones = dsc_bitvec_ones(&bv);
+    if (ones != 0) {
+        bench_start(&timer, "BitVec_t");
+        for (size_t i = 0; i < n; ++i) {
+            sink += dsc_bitvec_select(&bv, bench_key(n + i) % ones);
+        }
+        bench_stop(&timer, "select", n, n);
+    }
+
+    dsc_bitvec_destroy(&bv);
+    (void)sink;
+}
@@ -0,0 +1,37 @@
+#include "bench.h"
+#include "bloom.h"
+
+void bench_bloom(const size_t n) {
+    BenchTimer_t timer;
+    Bloom_t bloom;
+    uint64_t *keys = malloc(n * sizeof(uint64_t));
+    volatile size_t sink = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = bench_key(i);
+    }
+
+    dsc_bloom_init(&bloom, n, 10, sizeof(uint64_t), NULL);
+    bench_start(&timer, "Bloom_t");
+    for (size_t i = 0; i < n; ++i) {
+        dsc_bloom_add(&bloom, &keys[i]);
+    }
+    bench_stop(&timer, "add", n, n);
+
+    bench_start(&timer, "Bloom_t");
+    for (size_t i = 0; i < n; ++i) {
+        sink += dsc_bloom_contains(&bloom, &keys[bench_key(n + i) % n]);
+    }
+    bench_stop(&timer, "lookup", n, n);
+
+    // The same missing keys as the Map_t lookup_miss row, which this filter would front
+    bench_start(&timer, "Bloom_t");
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t missing = bench_key(n + i);
+        sink += dsc_bloom_contains(&bloom, &missing);
+    }
+    bench_stop(&timer, "lookup_miss", n, n);
+
+    dsc_bloom_destroy(&bloom);
+    free(keys);
+}
@@ -0,0 +1,121 @@
+#include "bench.h"
+#include "btree.h"
+#include "rcu_btree.h"
+
+// search_func takes no context, so the key being searched for is passed through here
+static uint64_t needle;
+
+static InsertCmp_t _bench_btree_insert(const BTreeNode_t node, const BTreeNode_t cmp) {
+    return (*(uint64_t*)cmp->data < *(uint64_t*)node->data) ? INSERT_LT : INSERT_GT;
+}
+
+static SearchCmp_t _bench_btree_search(const BTreeNode_t node) {
+    const uint64_t key = *(uint64_t*)node->data;
+    if (needle < key) {
+        return SEARCH_LT;
+    } else if (needle > key) {
+        return SEARCH_GT;
+    } else {
+        return SEARCH_EQ;
+    }
+}
+
+static int _bench_btree_cmp(const void *lhs, const void *rhs) {
+    const uint64_t a = *(const uint64_t*)lhs;
+    const uint64_t b = *(const uint64_t*)rhs;
+    return (a > b) - (a < b);
+}
+
+static BTreeNode_t _bench_btree_build(uint64_t *keys, const size_t n) {
+    BTreeNode_t root = dsc_btree_create(&keys[0], NULL, DFS);
+    for (size_t i = 1; i < n; ++i) {
+        dsc_btree_add(root, &keys[i], NULL, _bench_btree_insert);
+    }
+    return root;
+}
+
+void bench_btree(const size_t n) {
+    BenchTimer_t timer;
+    uint64_t *keys = malloc(n * sizeof(uint64_t));
+    volatile uint64_t sink = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = bench_key(i);
+    }
+
+    bench_start(&timer, "BTreeNode_t");
+    BTreeNode_t root = _bench_btree_build(keys, n);
+    bench_stop(&timer, "insert", n, n);
+
+    bench_start(&timer, "BTreeNode_t");
+    for (size_t i = 0; i < n; ++i) {
+        needle = keys[bench_key(n + i) % n];
+        sink += dsc_btree_peek(root, _bench_btree_search)->id;
+    }
+    bench_stop(&timer, "lookup", n, n);
+
+    // A full in-order walk reports ns per node visited
+    BTreeCursor_t cursor;
+    bench_start(&timer, "BTreeNode_t");
+    for (BTreeNode_t node = dsc_btree_cursor_first(&cursor, root); node != NULL; node = dsc_btree_cursor_next(&cursor)) {
+        sink += node->id;
+    }
+    bench_stop(&timer, "scan", n, n);
+    dsc_btree_cursor_destroy(&cursor);
+
+    bench_start(&timer, "BTreeNode_t");
+    dsc_btree_destroy(root);
+    bench_stop(&timer, "destroy", n, n);
+
+    // dsc_btree_remove() drops whole subtrees; removing in reverse insertion order only removes leaves
+    root = _bench_btree_build(keys, n);
+    bench_start(&timer, "BTreeNode_t");
+    for (size_t i = n - 1; i > 0; --i) {
+        needle = keys[i];
+        dsc_btree_remove(root, _bench_btree_search);
+    }
+    bench_stop(&timer, "delete", n, n - 1);
+    dsc_btree_destroy(root);
+
+    // Bulk construction sorts a copy of the keys in place, then builds a balanced tree over it
+    uint64_t *sorted = malloc(n * sizeof(uint64_t));
+    memcpy(sorted, keys, n * sizeof(uint64_t));
+    bench_start(&timer, "BTreeNode_t");
+    root = dsc_btree_build(sorted, n, sizeof(uint64_t), _bench_btree_cmp, 0, DFS, NULL);
+    bench_stop(&timer, "build_parallel", n, n);
+
+    bench_start(&timer, "BTreeNode_t");
+    dsc_btree_destroy_parallel(root, 0);
+    bench_stop(&timer, "destroy_parallel", n, n);
+
+    bench_start(&timer, "BTreeNode_t");
+    root = dsc_btree_build_from_sorted(sorted, n, sizeof(uint64_t), DFS, NULL);
+    bench_stop(&timer, "build_sorted", n, n);
+    dsc_btree_destroy(root);
+    free(sorted);
+
+    // The same lookups through an RCU read section, which adds two atomic stores per lookup
+    RcuBTree_t rcu;
+    RcuReader_t reader;
+    dsc_rcu_btree_init(&rcu, DFS, NULL);
+    dsc_rcu_btree_register(&rcu, &reader);
+    bench_start(&timer, "BTreeNode_t");
+    for (size_t i = 0; i < n; ++i) {
+        dsc_rcu_btree_add(&rcu, &keys[i], NULL, _bench_btree_insert);
+    }
+    bench_stop(&timer, "insert_rcu", n, n);
+
+    bench_start(&timer, "BTreeNode_t");
+    for (size_t i = 0; i < n; ++i) {
+        needle = keys[bench_key(n + i) % n];
+        root = dsc_rcu_btree_read_begin(&rcu, &reader);
+        sink += dsc_btree_peek(root, _bench_btree_search)->id;
+        dsc_rcu_btree_read_end(&reader);
+    }
+    bench_stop(&timer, "lookup_rcu", n, n);
+    dsc_rcu_btree_unregister(&rcu, &reader);
+    dsc_rcu_btree_destroy(&rcu);
+
+    free(keys);
+    (void)sink;
+}
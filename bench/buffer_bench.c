@@ -0,0 +1,48 @@
+#include "bench.h"
+#include "buffer.h"
+
+// Grows the buffer one element at a time, touching each new element, until it holds n elements
+static size_t _bench_buf_grow(Buffer_t *buf, const size_t n) {
+    size_t nops = 0;
+    for (size_t nelem = 2; nelem <= n; ++nelem, ++nops) {
+        dsc_buf_resize(buf, nelem);
+        ((uint64_t*)buf->base)[nelem - 1] = nelem;
+    }
+    return nops;
+}
+
+void bench_buffer(const size_t n) {
+    BenchTimer_t timer;
+    Buffer_t buf = { 0 };
+    size_t nops;
+    volatile size_t sink = 0;
+
+    dsc_buf_init(&buf, 1, sizeof(uint64_t));
+    bench_start(&timer, "Buffer_t");
+    nops = _bench_buf_grow(&buf, n);
+    bench_stop(&timer, "resize_heap", n, nops);
+    dsc_buf_destroy(&buf);
+
+    dsc_buf_init_mmap(&buf, 1, sizeof(uint64_t), 0);
+    bench_start(&timer, "Buffer_t");
+    nops = _bench_buf_grow(&buf, n);
+    bench_stop(&timer, "resize_mmap", n, nops);
+
+    // The element kernels report ns per element
+    const uint64_t sentinel = bench_key(0);
+    bench_start(&timer, "Buffer_t");
+    dsc_buf_fill_elem(&buf, &sentinel);
+    bench_stop(&timer, "fill_elem", n, n);
+
+    const uint64_t missing = bench_key(1);
+    bench_start(&timer, "Buffer_t");
+    sink += dsc_buf_find(&buf, &missing);
+    bench_stop(&timer, "find", n, n);
+
+    bench_start(&timer, "Buffer_t");
+    sink += dsc_buf_count(&buf, &sentinel);
+    bench_stop(&timer, "count", n, n);
+
+    dsc_buf_destroy(&buf);
+    (void)sink;
+}
@@ -0,0 +1,32 @@
+#include "bench.h"
+#include "cache.h"
+
+// Requests are skewed: squaring a uniform draw makes low ranks far more popular than high ones
+static uint64_t _bench_cache_request(const size_t i, const size_t n) {
+    const double u = (double)(bench_key(i) >> 11) / (double)(1ULL << 53);
+    return bench_key((uint64_t)(u * u * (double)n));
+}
+
+// Serves n requests through a cache holding a tenth of the keys, filling it on each miss
+static void _bench_cache_policy(const size_t n, const CachePolicy_t policy, const char *op) {
+    BenchTimer_t timer;
+    Cache_t cache;
+    uint64_t value = 0;
+
+    dsc_cache_init(&cache, (n / 10 != 0) ? n / 10 : 1, sizeof(uint64_t), sizeof(uint64_t), policy);
+    bench_start(&timer, "Cache_t");
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t key = _bench_cache_request(i, n);
+        if (dsc_cache_get(&cache, &key) == NULL) {
+            dsc_cache_put(&cache, &key, &value);
+        }
+    }
+    bench_stop(&timer, op, n, n);
+    dsc_cache_destroy(&cache);
+}
+
+void bench_cache(const size_t n) {
+    _bench_cache_policy(n, CACHE_LRU, "get_put_lru");
+    _bench_cache_policy(n, CACHE_CLOCK, "get_put_clock");
+    _bench_cache_policy(n, CACHE_TINYLFU, "get_put_tinylfu");
+}
@@ -0,0 +1,70 @@
+#include "bench.h"
+#include "chmap.h"
+
+#define BENCH_CHMAP_MAX_THREADS 64
+
+typedef struct {
+    CMap_t         *map;   // Map shared by every thread
+    const uint64_t *keys;  // Keys present in the map
+    size_t          n;     // Number of keys
+    size_t          nops;  // Lookups performed by each thread
+    size_t          seed;  // Offsets the key sequence so threads do not walk in lockstep
+    uint64_t        sink;  // Keeps the lookups from being optimized away
+} BenchCHMapArg_t;
+
+static void *_bench_chmap_reader(void *arg) {
+    BenchCHMapArg_t *ctx = arg;
+    uint64_t value = 0;
+
+    for (size_t i = 0; i < ctx->nops; ++i) {
+        dsc_chmap_retrieve_value(ctx->map, &ctx->keys[bench_key(ctx->seed + i) % ctx->n], &value);
+        ctx->sink += value;
+    }
+
+    return NULL;
+}
+
+// Reports the time per lookup across all threads, so linear scaling shows as ns_per_op halving
+static void _bench_chmap_readers(CMap_t *map, const uint64_t *keys, const size_t n, const size_t nthreads) {
+    pthread_t threads[BENCH_CHMAP_MAX_THREADS];
+    BenchCHMapArg_t args[BENCH_CHMAP_MAX_THREADS];
+    BenchTimer_t timer;
+    char op[32];
+
+    bench_start(&timer, "CMap_t");
+    for (size_t t = 0; t < nthreads; ++t) {
+        args[t] = (BenchCHMapArg_t){ map, keys, n, n, (t + 1) * n, 0 };
+        pthread_create(&threads[t], NULL, _bench_chmap_reader, &args[t]);
+    }
+    for (size_t t = 0; t < nthreads; ++t) {
+        pthread_join(threads[t], NULL);
+    }
+    snprintf(op, sizeof(op), "lookup_t%zu", nthreads);
+    bench_stop(&timer, op, n, n * nthreads);
+}
+
+void bench_chmap(const size_t n) {
+    BenchTimer_t timer;
+    CMap_t map = { 0 };
+    uint64_t *keys = malloc(n * sizeof(uint64_t));
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = bench_key(i);
+    }
+
+    bench_start(&timer, "CMap_t");
+    dsc_chmap_init(&map, 0, sizeof(uint64_t), sizeof(uint64_t));
+    for (size_t i = 0; i < n; ++i) {
+        dsc_chmap_add_entry(&map, &keys[i], &i);
+    }
+    bench_stop(&timer, "insert", n, n);
+
+    ncpu = (ncpu < 1) ? 1 : (ncpu > BENCH_CHMAP_MAX_THREADS) ? BENCH_CHMAP_MAX_THREADS : ncpu;
+    for (size_t t = 1; t <= (size_t)ncpu; t *= 2) {
+        _bench_chmap_readers(&map, keys, n, t);
+    }
+
+    dsc_chmap_destroy(&map);
+    free(keys);
+}
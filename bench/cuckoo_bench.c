@@ -0,0 +1,42 @@
+#include "bench.h"
+#include "cuckoo.h"
+
+void bench_cuckoo(const size_t n) {
+    BenchTimer_t timer;
+    Cuckoo_t filter;
+    uint64_t *keys = malloc(n * sizeof(uint64_t));
+    volatile size_t sink = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = bench_key(i);
+    }
+
+    dsc_cuckoo_init(&filter, n, sizeof(uint64_t), NULL);
+    bench_start(&timer, "Cuckoo_t");
+    for (size_t i = 0; i < n; ++i) {
+        dsc_cuckoo_add(&filter, &keys[i]);
+    }
+    bench_stop(&timer, "add", n, n);
+
+    bench_start(&timer, "Cuckoo_t");
+    for (size_t i = 0; i < n; ++i) {
+        sink += dsc_cuckoo_contains(&filter, &keys[bench_key(n + i) % n]);
+    }
+    bench_stop(&timer, "lookup", n, n);
+
+    bench_start(&timer, "Cuckoo_t");
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t missing = bench_key(n + i);
+        sink += dsc_cuckoo_contains(&filter, &missing);
+    }
+    bench_stop(&timer, "lookup_miss", n, n);
+
+    bench_start(&timer, "Cuckoo_t");
+    for (size_t i = 0; i < n; ++i) {
+        dsc_cuckoo_remove(&filter, &keys[i]);
+    }
+    bench_stop(&timer, "delete", n, n);
+
+    dsc_cuckoo_destroy(&filter);
+    free(keys);
+}
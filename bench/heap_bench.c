@@ -0,0 +1,56 @@
+#include "bench.h"
+#include "heap.h"
+
+static int _bench_heap_cmp(const void *lhs, const void *rhs) {
+    const uint64_t a = *(const uint64_t*)lhs;
+    const uint64_t b = *(const uint64_t*)rhs;
+    return (a > b) - (a < b);
+}
+
+// Pushes then pops every key, reporting each phase as e.g. push_d4 and pop_d4
+static void _bench_heap_arity(const uint64_t *keys, const size_t n, const size_t arity) {
+    BenchTimer_t timer;
+    Heap_t heap;
+    uint64_t top;
+    char op[32];
+
+    dsc_heap_init(&heap, sizeof(uint64_t), arity, _bench_heap_cmp);
+    bench_start(&timer, "Heap_t");
+    for (size_t i = 0; i < n; ++i) {
+        dsc_heap_push(&heap, &keys[i], NULL);
+    }
+    snprintf(op, sizeof(op), "push_d%zu", arity);
+    bench_stop(&timer, op, n, n);
+
+    bench_start(&timer, "Heap_t");
+    while (dsc_heap_pop(&heap, &top) == DSC_EOK) {}
+    snprintf(op, sizeof(op), "pop_d%zu", arity);
+    bench_stop(&timer, op, n, n);
+    dsc_heap_destroy(&heap);
+}
+
+void bench_heap(const size_t n) {
+    BenchTimer_t timer;
+    Heap_t heap;
+    uint64_t *keys = malloc(n * sizeof(uint64_t));
+    uint64_t best[100];
+
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = bench_key(i);
+    }
+
+    _bench_heap_arity(keys, n, 2);
+    _bench_heap_arity(keys, n, 4);
+
+    dsc_heap_init(&heap, sizeof(uint64_t), 0, _bench_heap_cmp);
+    bench_start(&timer, "Heap_t");
+    dsc_heap_heapify(&heap, keys, n);
+    bench_stop(&timer, "heapify", n, n);
+    dsc_heap_destroy(&heap);
+
+    bench_start(&timer, "Heap_t");
+    dsc_heap_topk(keys, n, sizeof(uint64_t), 100, _bench_heap_cmp, best);
+    bench_stop(&timer, "topk100", n, n);
+
+    free(keys);
+}
@@ -0,0 +1,134 @@
+#include "bench.h"
+#include "hmap.h"
+#include "iter.h"
+
+static void _bench_hmap_build(Map_t *map, const uint64_t *keys, const size_t n) {
+    dsc_hmap_init(map, 0, sizeof(uint64_t), sizeof(uint64_t));
+    for (size_t i = 0; i < n; ++i) {
+        dsc_hmap_add_entry(map, &keys[i], &i);
+    }
+}
+
+// Times each insert individually so that the row also carries the 99th percentile and worst case
+static void _bench_hmap_tail(const uint64_t *keys, const size_t n, const MapResize_t resize, const char *op) {
+    BenchTimer_t timer;
+    Map_t map = { 0 };
+    uint64_t *lat = malloc(n * sizeof(uint64_t));
+
+    if (lat == NULL) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    dsc_hmap_init(&map, 0, sizeof(uint64_t), sizeof(uint64_t));
+    dsc_hmap_set_resize(&map, resize);
+    bench_start(&timer, "Map_t");
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t start = bench_now_ns();
+        dsc_hmap_add_entry(&map, &keys[i], &i);
+        lat[i] = bench_now_ns() - start;
+    }
+    bench_stop_latency(&timer, op, n, lat, n);
+    dsc_hmap_destroy(&map);
+    free(lat);
+}
+
+void bench_hmap(const size_t n) {
+    BenchTimer_t timer;
+    Map_t map = { 0 };
+    uint64_t *keys = malloc(n * sizeof(uint64_t));
+    volatile uint64_t sink = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = bench_key(i);
+    }
+
+    bench_start(&timer, "Map_t");
+    _bench_hmap_build(&map, keys, n);
+    bench_stop(&timer, "insert", n, n);
+
+    bench_start(&timer, "Map_t");
+    for (size_t i = 0; i < n; ++i) {
+        Buffer_t value = dsc_hmap_retrieve_value(&map, &keys[bench_key(n + i) % n]);
+        sink += *(uint64_t*)value.base;
+    }
+    bench_stop(&timer, "lookup", n, n);
+
+    bench_start(&timer, "Map_t");
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t missing = bench_key(n + i);
+        sink += dsc_hmap_contains_key(&map, &missing);
+    }
+    bench_stop(&timer, "lookup_miss", n, n);
+
+    // The same probe streams again, handed to the batched calls in groups of 64
+    bench_start(&timer, "Map_t");
+    for (size_t i = 0; i < n; i += 64) {
+        const size_t m = (n - i < 64) ? n - i : 64;
+        uint64_t batch[64];
+        void *values[64];
+        for (size_t j = 0; j < m; ++j) {
+            batch[j] = keys[bench_key(n + i + j) % n];
+        }
+        dsc_hmap_retrieve_many(&map, batch, m, values);
+        for (size_t j = 0; j < m; ++j) {
+            sink += *(uint64_t*)values[j];
+        }
+    }
+    bench_stop(&timer, "lookup_batch", n, n);
+
+    bench_start(&timer, "Map_t");
+    for (size_t i = 0; i < n; i += 64) {
+        const size_t m = (n - i < 64) ? n - i : 64;
+        uint64_t batch[64];
+        bool found[64];
+        for (size_t j = 0; j < m; ++j) {
+            batch[j] = bench_key(n + i + j);
+        }
+        sink += dsc_hmap_contains_many(&map, batch, m, found);
+    }
+    bench_stop(&timer, "lookup_miss_batch", n, n);
+
+    bench_start(&timer, "Map_t");
+    Iter_t iter;
+    void *elems[DSC_ITER_BATCH];
+    size_t got;
+    dsc_iter_hmap(&iter, &map);
+    while ((got = dsc_iter_next(&iter, elems, DSC_ITER_BATCH)) != 0) {
+        for (size_t j = 0; j < got; ++j) {
+            sink += *(const uint64_t*)((const KV_t*)elems[j])->value;
+        }
+    }
+    dsc_iter_destroy(&iter);
+    bench_stop(&timer, "iterate", n, n);
+
+    bench_start(&timer, "Map_t");
+    dsc_hmap_destroy(&map);
+    bench_stop(&timer, "destroy", n, n);
+
+    _bench_hmap_build(&map, keys, n);
+    bench_start(&timer, "Map_t");
+    for (size_t i = 0; i < n; ++i) {
+        dsc_hmap_remove_entry(&map, &keys[i]);
+    }
+    bench_stop(&timer, "delete", n, n);
+    dsc_hmap_destroy(&map);
+
+    // The same entries in one batch, hashed and placed by one thread per CPU
+    uint64_t *values = malloc(n * sizeof(uint64_t));
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = i;
+    }
+    dsc_hmap_init(&map, 0, sizeof(uint64_t), sizeof(uint64_t));
+    bench_start(&timer, "Map_t");
+    dsc_hmap_add_many(&map, keys, values, n, 0);
+    bench_stop(&timer, "insert_bulk", n, n);
+    dsc_hmap_destroy(&map);
+    free(values);
+
+    _bench_hmap_tail(keys, n, RESIZE_BLOCKING, "insert_blocking");
+    _bench_hmap_tail(keys, n, RESIZE_INCREMENTAL, "insert_incremental");
+
+    free(keys);
+    (void)sink;
+}
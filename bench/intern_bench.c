@@ -0,0 +1,69 @@
+#include "bench.h"
+#include "intern.h"
+#include "hmap.h"
+
+#define BENCH_INTERN_LEN 24
+
+void bench_intern(const size_t n) {
+    BenchTimer_t timer;
+    Intern_t pool;
+    Map_t by_str = { 0 }, by_id = { 0 };
+    char *strs = malloc(n * BENCH_INTERN_LEN);
+    const char **keys = malloc(n * sizeof(char*));
+    uint32_t *ids = malloc(n * sizeof(uint32_t));
+    volatile uint64_t sink = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = strs + i * BENCH_INTERN_LEN;
+        snprintf(strs + i * BENCH_INTERN_LEN, BENCH_INTERN_LEN, "key-%016llx", (unsigned long long)bench_key(i));
+    }
+
+    dsc_intern_init(&pool, 0);
+    bench_start(&timer, "Intern_t");
+    for (size_t i = 0; i < n; ++i) {
+        dsc_intern_add(&pool, keys[i], &ids[i]);
+    }
+    bench_stop(&timer, "add", n, n);
+
+    bench_start(&timer, "Intern_t");
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t id;
+        dsc_intern_add(&pool, keys[bench_key(n + i) % n], &id);
+        sink += id;
+    }
+    bench_stop(&timer, "add_dup", n, n);
+
+    bench_start(&timer, "Intern_t");
+    for (size_t i = 0; i < n; ++i) {
+        sink += (uintptr_t)dsc_intern_str(&pool, ids[bench_key(n + i) % n]);
+    }
+    bench_stop(&timer, "str", n, n);
+
+    // The same map keyed by the strings themselves and by their IDs
+    dsc_hmap_init(&by_str, 0, 0, sizeof(uint64_t));
+    dsc_hmap_init(&by_id, 0, sizeof(uint32_t), sizeof(uint64_t));
+    dsc_hmap_set_hash(&by_id, int_hash);
+    for (size_t i = 0; i < n; ++i) {
+        dsc_hmap_add_entry(&by_str, keys[i], &i);
+        dsc_hmap_add_entry(&by_id, &ids[i], &i);
+    }
+
+    bench_start(&timer, "Intern_t");
+    for (size_t i = 0; i < n; ++i) {
+        sink += *(uint64_t*)dsc_hmap_retrieve_value(&by_str, keys[bench_key(n + i) % n]).base;
+    }
+    bench_stop(&timer, "map_lookup_str", n, n);
+
+    bench_start(&timer, "Intern_t");
+    for (size_t i = 0; i < n; ++i) {
+        sink += *(uint64_t*)dsc_hmap_retrieve_value(&by_id, &ids[bench_key(n + i) % n]).base;
+    }
+    bench_stop(&timer, "map_lookup_id", n, n);
+
+    dsc_hmap_destroy(&by_str);
+    dsc_hmap_destroy(&by_id);
+    dsc_intern_destroy(&pool);
+    free(strs);
+    free(keys);
+    free(ids);
+}
@@ -0,0 +1,62 @@
+#include "bench.h"
+#include "ll.h"
+#include "iter.h"
+
+// dsc_ll_peek() is O(idx), so random access is only measured up to this size
+#define BENCH_LL_PEEK_MAX_N 1000000
+#define BENCH_LL_PEEK_NOPS  1000
+
+void bench_ll(const size_t n) {
+    BenchTimer_t timer;
+    uint64_t *keys = malloc(n * sizeof(uint64_t));
+    volatile uint64_t sink = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = bench_key(i);
+    }
+
+    // Appending from the tail keeps each append O(1); appending from the head is O(n)
+    bench_start(&timer, "LLNode_t");
+    LLNode_t head = dsc_ll_create(&keys[0]);
+    LLNode_t tail = head;
+    for (size_t i = 1; i < n; ++i) {
+        dsc_ll_append(tail, &keys[i]);
+        tail = tail->next;
+    }
+    bench_stop(&timer, "append", n, n);
+
+    if (n <= BENCH_LL_PEEK_MAX_N) {
+        bench_start(&timer, "LLNode_t");
+        for (size_t i = 0; i < BENCH_LL_PEEK_NOPS; ++i) {
+            LLNode_t node = dsc_ll_peek(head, (unsigned)(bench_key(i) % n));
+            sink += *(uint64_t*)node->data;
+        }
+        bench_stop(&timer, "peek", n, BENCH_LL_PEEK_NOPS);
+    }
+
+    bench_start(&timer, "LLNode_t");
+    for (LLNode_t iter = head; iter != NULL; iter = iter->next) {
+        sink += *(uint64_t*)iter->data;
+    }
+    bench_stop(&timer, "iterate", n, n);
+
+    bench_start(&timer, "LLNode_t");
+    Iter_t iter;
+    void *elems[DSC_ITER_BATCH];
+    size_t got;
+    dsc_iter_ll(&iter, head);
+    while ((got = dsc_iter_next(&iter, elems, DSC_ITER_BATCH)) != 0) {
+        for (size_t i = 0; i < got; ++i) {
+            sink += *(uint64_t*)elems[i];
+        }
+    }
+    dsc_iter_destroy(&iter);
+    bench_stop(&timer, "iterate_batch", n, n);
+
+    bench_start(&timer, "LLNode_t");
+    dsc_ll_destroy(head);
+    bench_stop(&timer, "destroy", n, n);
+
+    free(keys);
+    (void)sink;
+}
@@ -0,0 +1,67 @@
+#include "bench.h"
+#include "packed.h"
+#include "sort.h"
+
+static int _bench_packed_cmp(const void *lhs, const void *rhs) {
+    const uint64_t a = *(const uint64_t*)lhs;
+    const uint64_t b = *(const uint64_t*)rhs;
+    return (a > b) - (a < b);
+}
+
+void bench_packed(const size_t n) {
+    BenchTimer_t timer;
+    PackedArray_t arr;
+    Buffer_t ids;
+    uint64_t out[DSC_PACKED_BLOCK];
+    volatile uint64_t sink = 0;
+
+    // A sorted ID list with 32-bit IDs, as left by flattening a large tree
+    dsc_buf_init(&ids, n, sizeof(uint64_t));
+    uint64_t *base = ids.base;
+    for (size_t i = 0; i < n; ++i) {
+        base[i] = bench_key(i) & UINT32_MAX;
+    }
+    dsc_sort_radix(&ids, RADIX_UNSIGNED);
+
+    bench_start(&timer, "PackedArray_t");
+    dsc_packed_init(&arr, base, n);
+    bench_stop(&timer, "pack", n, n);
+
+    bench_start(&timer, "PackedArray_t");
+    for (size_t i = 0; i < n; ++i) {
+        sink += dsc_packed_get(&arr, bench_key(n + i) % n);
+    }
+    bench_stop(&timer, "get", n, n);
+
+    bench_start(&timer, "PackedArray_t");
+    for (size_t i = 0; i < n; i += DSC_PACKED_BLOCK) {
+        const size_t got = dsc_packed_decode(&arr, i, DSC_PACKED_BLOCK, out);
+        for (size_t j = 0; j < got; ++j) {
+            sink += out[j];
+        }
+    }
+    bench_stop(&timer, "decode", n, n);
+
+    bench_start(&timer, "PackedArray_t");
+    for (size_t i = 0; i < n; ++i) {
+        sink += base[i];
+    }
+    bench_stop(&timer, "scan_plain", n, n);
+
+    bench_start(&timer, "PackedArray_t");
+    for (size_t i = 0; i < n; ++i) {
+        sink += dsc_packed_lower_bound(&arr, bench_key(n + i) & UINT32_MAX);
+    }
+    bench_stop(&timer, "lower_bound", n, n);
+
+    bench_start(&timer, "PackedArray_t");
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t key = bench_key(n + i) & UINT32_MAX;
+        sink += dsc_lower_bound(&ids, &key, _bench_packed_cmp);
+    }
+    bench_stop(&timer, "lower_bound_plain", n, n);
+
+    dsc_packed_destroy(&arr);
+    dsc_buf_destroy(&ids);
+    (void)sink;
+}
@@ -0,0 +1,55 @@
+#include "bench.h"
+#include "pool.h"
+#include "parallel.h"
+
+typedef struct {
+    uint64_t *out;
+} BenchPoolJob_t;
+
+// Uneven work: index i costs about (i % 64) rounds of mixing
+static void _bench_pool_range(void *ctx, const size_t lo, const size_t hi) {
+    BenchPoolJob_t *job = ctx;
+
+    for (size_t i = lo; i < hi; ++i) {
+        uint64_t x = bench_key(i);
+        for (size_t r = 0; r < (i & 63); ++r) {
+            x = bench_key(x);
+        }
+        job->out[i] = x;
+    }
+}
+
+void bench_pool(const size_t n) {
+    BenchTimer_t timer;
+    ThreadPool_t pool;
+    BenchPoolJob_t job = { malloc((n + 1024) * sizeof(uint64_t)) }; // small_jobs may run past n
+
+    if (job.out == NULL) {
+        return;
+    }
+
+    bench_start(&timer, "ThreadPool_t");
+    _bench_pool_range(&job, 0, n);
+    bench_stop(&timer, "serial", n, n);
+
+    bench_start(&timer, "ThreadPool_t");
+    dsc_parallel_for(n, 1024, _bench_pool_range, &job);
+    bench_stop(&timer, "parallel_for_threads", n, n);
+
+    dsc_pool_init(&pool, 0);
+    dsc_parallel_set_pool(&pool);
+
+    bench_start(&timer, "ThreadPool_t");
+    dsc_parallel_for(n, 1024, _bench_pool_range, &job);
+    bench_stop(&timer, "parallel_for_pool", n, n);
+
+    bench_start(&timer, "ThreadPool_t");
+    for (size_t i = 0; i < n; i += 1024) {
+        dsc_pool_for(&pool, 1024, 64, _bench_pool_range, &job);
+    }
+    bench_stop(&timer, "small_jobs", n, n);
+
+    dsc_parallel_set_pool(NULL);
+    dsc_pool_destroy(&pool);
+    free(job.out);
+}
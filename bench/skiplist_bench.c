@@ -0,0 +1,69 @@
+#include "bench.h"
+#include "skiplist.h"
+
+typedef struct {
+    SkipList_t     *list; // List shared by every thread
+    const uint64_t *keys; // Keys to insert
+    size_t          n;    // Number of keys, split evenly between the threads
+} BenchSkipArg_t;
+
+static int _bench_skip_cmp(const void *lhs, const void *rhs) {
+    const uint64_t a = *(const uint64_t*)lhs;
+    const uint64_t b = *(const uint64_t*)rhs;
+    return (a > b) - (a < b);
+}
+
+static void _bench_skip_inserter(void *ctx, const size_t idx, const size_t nthreads) {
+    BenchSkipArg_t *arg = ctx;
+    for (size_t i = arg->n * idx / nthreads; i < arg->n * (idx + 1) / nthreads; ++i) {
+        dsc_skiplist_add_concurrent(arg->list, &arg->keys[i], &i);
+    }
+}
+
+void bench_skiplist(const size_t n) {
+    BenchTimer_t timer;
+    SkipList_t list = { 0 };
+    uint64_t *keys = malloc(n * sizeof(uint64_t));
+    volatile uint64_t sink = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = bench_key(i);
+    }
+
+    dsc_skiplist_init(&list, sizeof(uint64_t), sizeof(uint64_t), _bench_skip_cmp);
+    bench_start(&timer, "SkipList_t");
+    for (size_t i = 0; i < n; ++i) {
+        dsc_skiplist_add(&list, &keys[i], &i);
+    }
+    bench_stop(&timer, "insert", n, n);
+
+    bench_start(&timer, "SkipList_t");
+    for (size_t i = 0; i < n; ++i) {
+        sink += *(uint64_t*)dsc_skiplist_find(&list, &keys[bench_key(n + i) % n]);
+    }
+    bench_stop(&timer, "lookup", n, n);
+
+    bench_start(&timer, "SkipList_t");
+    for (SkipNode_t node = dsc_skiplist_first(&list); node != NULL; node = dsc_skiplist_next(node)) {
+        sink += *(uint64_t*)dsc_skiplist_value(&list, node);
+    }
+    bench_stop(&timer, "scan", n, n);
+
+    bench_start(&timer, "SkipList_t");
+    for (size_t i = 0; i < n; ++i) {
+        dsc_skiplist_remove(&list, &keys[i]);
+    }
+    bench_stop(&timer, "delete", n, n);
+    dsc_skiplist_destroy(&list);
+
+    // One inserting thread per online CPU, all linking into the same list
+    BenchSkipArg_t arg = { &list, keys, n };
+    dsc_skiplist_init(&list, sizeof(uint64_t), sizeof(uint64_t), _bench_skip_cmp);
+    bench_start(&timer, "SkipList_t");
+    dsc_parallel_run(_bench_skip_inserter, &arg, dsc_parallel_nthreads(0));
+    bench_stop(&timer, "insert_concurrent", n, n);
+    dsc_skiplist_destroy(&list);
+
+    free(keys);
+    (void)sink;
+}
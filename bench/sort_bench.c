@@ -0,0 +1,67 @@
+#include "bench.h"
+#include "sort.h"
+
+static int _bench_sort_cmp(const void *lhs, const void *rhs) {
+    const uint64_t a = *(const uint64_t*)lhs;
+    const uint64_t b = *(const uint64_t*)rhs;
+    return (a > b) - (a < b);
+}
+
+static void _bench_sort_fill(Buffer_t *buf, const size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        ((uint64_t*)buf->base)[i] = bench_key(i);
+    }
+}
+
+void bench_sort(const size_t n) {
+    BenchTimer_t timer;
+    Buffer_t buf;
+    volatile size_t sink = 0;
+
+    dsc_buf_init(&buf, n, sizeof(uint64_t));
+
+    _bench_sort_fill(&buf, n);
+    bench_start(&timer, "Sort");
+    qsort(buf.base, n, sizeof(uint64_t), _bench_sort_cmp);
+    bench_stop(&timer, "qsort", n, n);
+
+    _bench_sort_fill(&buf, n);
+    bench_start(&timer, "Sort");
+    dsc_sort(&buf, _bench_sort_cmp);
+    bench_stop(&timer, "sort", n, n);
+
+    bench_start(&timer, "Sort");
+    dsc_sort(&buf, _bench_sort_cmp);
+    bench_stop(&timer, "sort_sorted", n, n);
+
+    _bench_sort_fill(&buf, n);
+    bench_start(&timer, "Sort");
+    dsc_sort_stable(&buf, _bench_sort_cmp);
+    bench_stop(&timer, "sort_stable", n, n);
+
+    _bench_sort_fill(&buf, n);
+    bench_start(&timer, "Sort");
+    dsc_sort_radix(&buf, RADIX_UNSIGNED);
+    bench_stop(&timer, "sort_radix", n, n);
+
+    _bench_sort_fill(&buf, n);
+    bench_start(&timer, "Sort");
+    dsc_sort_parallel(&buf, _bench_sort_cmp, 0);
+    bench_stop(&timer, "sort_parallel", n, n);
+
+    bench_start(&timer, "Sort");
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t key = bench_key(n + i);
+        sink += (size_t)bsearch(&key, buf.base, n, sizeof(uint64_t), _bench_sort_cmp);
+    }
+    bench_stop(&timer, "bsearch", n, n);
+
+    bench_start(&timer, "Sort");
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t key = bench_key(n + i);
+        sink += dsc_lower_bound(&buf, &key, _bench_sort_cmp);
+    }
+    bench_stop(&timer, "lower_bound", n, n);
+
+    dsc_buf_destroy(&buf);
+}
@@ -0,0 +1,46 @@
+#include "bench.h"
+#include "stack.h"
+
+void bench_stack(const size_t n) {
+    BenchTimer_t timer;
+    Stack_t stack = { 0 };
+    volatile uint64_t sink = 0;
+
+    uint64_t first = bench_key(0);
+    dsc_stack_init(&stack, &first, sizeof(uint64_t));
+
+    bench_start(&timer, "Stack_t");
+    for (size_t i = 1; i < n; ++i) {
+        uint64_t key = bench_key(i);
+        dsc_stack_push(&stack, &key);
+    }
+    bench_stop(&timer, "push", n, n - 1);
+
+    bench_start(&timer, "Stack_t");
+    for (size_t i = 0; i < n; ++i) {
+        sink += *(uint64_t*)dsc_stack_peek(&stack);
+    }
+    bench_stop(&timer, "peek", n, n);
+
+    bench_start(&timer, "Stack_t");
+    for (size_t i = 1; i < n; ++i) {
+        dsc_stack_pop(&stack);
+    }
+    bench_stop(&timer, "pop", n, n - 1);
+
+    dsc_stack_destroy(&stack);
+
+    // Short-lived, shallow stacks stay in their inline storage and never reach malloc
+    bench_start(&timer, "Stack_t");
+    for (size_t i = 0; i < n; ++i) {
+        Stack_t shallow;
+        uint64_t key = bench_key(i);
+        dsc_stack_init(&shallow, &key, sizeof(uint64_t));
+        dsc_stack_push(&shallow, &key);
+        dsc_stack_push(&shallow, &key);
+        sink += *(uint64_t*)dsc_stack_peek(&shallow);
+        dsc_stack_destroy(&shallow);
+    }
+    bench_stop(&timer, "shallow", n, n);
+    (void)sink;
+}
@@ -0,0 +1,45 @@
+#include "bench.h"
+#include "stree.h"
+
+static int _bench_stree_cmp(const void *lhs, const void *rhs) {
+    const uint64_t a = *(const uint64_t*)lhs;
+    const uint64_t b = *(const uint64_t*)rhs;
+    return (a > b) - (a < b);
+}
+
+// The same lookups as the BTreeNode_t suite's "lookup", so the two rows compare directly
+void bench_stree(const size_t n) {
+    BenchTimer_t timer;
+    Buffer_t sorted = { 0 };
+    STree_t tree = { 0 };
+    volatile uint64_t sink = 0;
+
+    dsc_buf_init(&sorted, n, sizeof(uint64_t));
+    uint64_t *keys = sorted.base;
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = bench_key(i);
+    }
+    qsort(keys, n, sizeof(uint64_t), _bench_stree_cmp);
+
+    bench_start(&timer, "STree_t");
+    dsc_stree_from_sorted(&tree, &sorted, _bench_stree_cmp);
+    bench_stop(&timer, "build_sorted", n, n);
+
+    bench_start(&timer, "STree_t");
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t key = bench_key(bench_key(n + i) % n);
+        sink += *(const uint64_t*)dsc_stree_find(&tree, &key);
+    }
+    bench_stop(&timer, "lookup", n, n);
+
+    bench_start(&timer, "STree_t");
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t missing = bench_key(n + i);
+        sink += (dsc_stree_find(&tree, &missing) != NULL);
+    }
+    bench_stop(&timer, "lookup_miss", n, n);
+
+    dsc_stree_destroy(&tree);
+    dsc_buf_destroy(&sorted);
+    (void)sink;
+}
@@ -0,0 +1,55 @@
+#include "bench.h"
+#include "twheel.h"
+
+// Timeouts are spread over this many ticks, e.g. milliseconds in the next ~17 minutes
+#define BENCH_TWHEEL_SPAN (1ULL << 20)
+
+static void _bench_twheel_fire(Timer_t *timer, void *ctx) {
+    (void)timer;
+    ++*(size_t*)ctx;
+}
+
+void bench_twheel(const size_t n) {
+    BenchTimer_t timer;
+    TimerWheel_t *wheel = malloc(sizeof(TimerWheel_t));
+    Timer_t *timers = malloc(n * sizeof(Timer_t));
+    size_t nfired = 0;
+
+    dsc_twheel_init(wheel, 0);
+    for (size_t i = 0; i < n; ++i) {
+        dsc_timer_init(&timers[i], _bench_twheel_fire, &nfired);
+    }
+
+    bench_start(&timer, "TimerWheel_t");
+    for (size_t i = 0; i < n; ++i) {
+        dsc_twheel_schedule(wheel, &timers[i], 1 + bench_key(i) % BENCH_TWHEEL_SPAN);
+    }
+    bench_stop(&timer, "schedule", n, n);
+
+    // Pushing a pending timeout back, as a connection does on every request it receives
+    bench_start(&timer, "TimerWheel_t");
+    for (size_t i = 0; i < n; ++i) {
+        dsc_twheel_schedule(wheel, &timers[i], 1 + bench_key(i + n) % BENCH_TWHEEL_SPAN);
+    }
+    bench_stop(&timer, "reschedule", n, n);
+
+    bench_start(&timer, "TimerWheel_t");
+    for (size_t i = 0; i < n; i += 2) {
+        dsc_twheel_cancel(wheel, &timers[i]);
+    }
+    bench_stop(&timer, "cancel", n, n / 2);
+
+    // Advancing one tick at a time, as an event loop would
+    const size_t npending = dsc_twheel_count(wheel);
+    bench_start(&timer, "TimerWheel_t");
+    for (uint64_t now = 1; now <= BENCH_TWHEEL_SPAN; ++now) {
+        dsc_twheel_advance(wheel, now);
+    }
+    bench_stop(&timer, "expire", n, npending);
+
+    if (nfired != npending) {
+        fprintf(stderr, "bench: TimerWheel_t fired %zu of %zu timers\n", nfired, npending);
+    }
+    free(timers);
+    free(wheel);
+}
@@ -0,0 +1,54 @@
+#ifndef BITVEC_H
+#define BITVEC_H
+
+#include "dsc_common.h"
+#include "dsc_alloc.h"
+#include "buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_BITVEC_SAMPLE 512 // One select sample is kept per this many set bits
+
+/*
+ * Static bitvector with rank and select. Bits are set with dsc_bitvec_set(), then
+ * dsc_bitvec_build() adds an index of about 25% of the bits' size. After that, rank runs in
+ * constant time (two table reads and a popcount) and select needs only a short search between
+ * samples. Setting a bit after the build invalidates the index until the next build.
+ */
+typedef struct {
+    Buffer_t bits;    // The bits, 64 to a word, followed by one zero word
+    Buffer_t ranks;   // Two words per 512-bit block: set bits before the block, then 9-bit counts within it
+    Buffer_t samples; // samples[j]: block holding set bit number j * DSC_BITVEC_SAMPLE
+    size_t   nbits;   // Number of bits
+    size_t   ones;    // Number of set bits, as of the last build
+} BitVec_t;
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_bitvec_init(BitVec_t *bv, const size_t nbits);
+DSC_DECL DscError_t     dsc_bitvec_init_alloc(BitVec_t *bv, const size_t nbits, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_bitvec_destroy(BitVec_t *bv);
+DSC_DECL DscError_t     dsc_bitvec_set(BitVec_t *bv, const size_t i, const bool value);
+DSC_DECL DscError_t     dsc_bitvec_build(BitVec_t *bv);
+DSC_DECL size_t         dsc_bitvec_rank(const BitVec_t* const bv, const size_t i);
+DSC_DECL size_t         dsc_bitvec_select(const BitVec_t* const bv, const size_t k);
+
+static inline bool dsc_bitvec_get(const BitVec_t* const bv, const size_t i) {
+    return (((const uint64_t*)bv->bits.base)[i >> 6] >> (i & 63)) & 1;
+}
+
+static inline size_t dsc_bitvec_nbits(const BitVec_t* const bv) {
+    return bv->nbits;
+}
+
+static inline size_t dsc_bitvec_ones(const BitVec_t* const bv) {
+    return bv->ones;
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // BITVEC_H
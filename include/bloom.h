@@ -0,0 +1,47 @@
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include "dsc_common.h"
+#include "dsc_alloc.h"
+#include "buffer.h"
+#include "hash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_BLOOM_WORDS 8 // 32-bit words per block; a block is 32 bytes and never straddles a cache line
+
+/*
+ * Split-block Bloom filter. A key selects one block and sets one bit in each of the block's
+ * eight words, so adding or testing a key touches a single cache line; with AVX2 the eight
+ * bits are computed and tested in one vector operation. Keys can be added but not removed.
+ */
+typedef struct {
+    Buffer_t  data;    // Backing storage, one block larger than needed so that blocks can be aligned
+    uint32_t *blocks;  // nblocks blocks of DSC_BLOOM_WORDS words, aligned to the block size
+    size_t    nblocks; // Number of blocks
+    size_t    count;   // Number of keys added
+    size_t    ksize;   // Size of each key in bytes (0 if keys are NUL-terminated strings)
+    hash_func hash;    // Hashes keys
+} Bloom_t;
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_bloom_init(Bloom_t *bloom, const size_t nkeys, const size_t bits_per_key, const size_t ksize, hash_func hash);
+DSC_DECL DscError_t     dsc_bloom_init_alloc(Bloom_t *bloom, const size_t nkeys, const size_t bits_per_key, const size_t ksize, hash_func hash, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_bloom_destroy(Bloom_t *bloom);
+DSC_DECL void           dsc_bloom_add_hash(Bloom_t *bloom, const uint32_t hash);
+DSC_DECL bool           dsc_bloom_contains_hash(const Bloom_t* const bloom, const uint32_t hash);
+DSC_DECL DscError_t     dsc_bloom_add(Bloom_t *bloom, const void* const key);
+DSC_DECL bool           dsc_bloom_contains(const Bloom_t* const bloom, const void* const key);
+
+static inline size_t dsc_bloom_count(const Bloom_t* const bloom) {
+    return bloom->count;
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // BLOOM_H
@@ -2,6 +2,10 @@
 #define BTREE_H
 
 #include "dsc_common.h"
+#include "dsc_alloc.h"
+#include "snapshot.h"
+#include "buffer.h"
+#include "parallel.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -18,6 +22,7 @@ typedef struct BTreeNode {
     SearchMethod_t method;   // Method of traversing the tree when doing searches (DFS or BFS)
     struct BTreeNode *left;  // A pointer to the left child node
     struct BTreeNode *right; // A pointer to the right child node
+    const DscAllocator_t *alloc; // Allocator used for this node (inherited from the root)
 } *BTreeNode_t;
 
 typedef enum {
@@ -32,16 +37,45 @@ typedef enum {
     INSERT_GT =  1
 } InsertCmp_t;
 typedef InsertCmp_t (* const insert_func)(const BTreeNode_t node, const BTreeNode_t cmp);
+typedef void (* visit_func)(const BTreeNode_t node, void *ctx);
+
+/*
+ * In-order cursor. Nodes carry no parent links (RcuBTree_t shares subtrees between versions,
+ * so a node can have several parents), so the cursor keeps the ancestors it still has to visit.
+ * The path starts out inline and holds a few levels before it spills through the tree's
+ * allocator; because of that, a cursor must not be copied by value.
+ */
+typedef struct {
+    BTreeNode_t   node;   // The node the cursor is on, or NULL once it has moved past the last node
+    SmallBuffer_t path;   // Ancestors still to be visited, nearest last
+    size_t        depth;  // Number of ancestors held in path
+    DscError_t    status; // DSC_ENOMEM if the path could not grow, which ends the walk early
+} BTreeCursor_t;
 
 // Forward function declarations
 
-BTreeNode_t       dsc_btree_create(void *data, size_t *id, const SearchMethod_t method);
-DscError_t        dsc_btree_destroy(BTreeNode_t root);
-DscError_t        dsc_btree_add(const BTreeNode_t root, void *data, size_t *id, insert_func func);
-DscError_t        dsc_btree_remove(BTreeNode_t root, search_func func);
-BTreeNode_t       dsc_btree_peek(const BTreeNode_t root, search_func func);
-BTreeNode_t       dsc_btree_peek_parent(const BTreeNode_t root, search_func func);
-DscError_t        dsc_btree_flatten(const BTreeNode_t root, const BTreeNode_t *list);
+DSC_DECL BTreeNode_t       dsc_btree_create(void *data, size_t *id, const SearchMethod_t method);
+DSC_DECL BTreeNode_t       dsc_btree_create_alloc(void *data, size_t *id, const SearchMethod_t method, const DscAllocator_t *alloc);
+DSC_DECL DscError_t        dsc_btree_destroy(BTreeNode_t root);
+DSC_DECL DscError_t        dsc_btree_destroy_parallel(BTreeNode_t root, const size_t nthreads);
+DSC_DECL BTreeNode_t       dsc_btree_build_from_sorted(void *base, const size_t nelem, const size_t size, const SearchMethod_t method, const DscAllocator_t *alloc);
+DSC_DECL BTreeNode_t       dsc_btree_build(void *base, const size_t nelem, const size_t size, compare_func cmp, const size_t nthreads, const SearchMethod_t method, const DscAllocator_t *alloc);
+DSC_DECL DscError_t        dsc_btree_add(const BTreeNode_t root, void *data, size_t *id, insert_func func);
+DSC_DECL DscError_t        dsc_btree_remove(BTreeNode_t root, search_func func);
+DSC_DECL BTreeNode_t       dsc_btree_peek(const BTreeNode_t root, search_func func);
+DSC_DECL BTreeNode_t       dsc_btree_peek_parent(const BTreeNode_t root, search_func func);
+DSC_DECL BTreeNode_t       dsc_btree_lower_bound(const BTreeNode_t root, search_func func);
+DSC_DECL BTreeNode_t       dsc_btree_upper_bound(const BTreeNode_t root, search_func func);
+DSC_DECL DscError_t        dsc_btree_range(const BTreeNode_t root, search_func lo, search_func hi, visit_func func, void *ctx);
+DSC_DECL DscError_t        dsc_btree_flatten(const BTreeNode_t root, BTreeNode_t *list);
+DSC_DECL BTreeNode_t       dsc_btree_cursor_first(BTreeCursor_t *cursor, const BTreeNode_t root);
+DSC_DECL BTreeNode_t       dsc_btree_cursor_lower_bound(BTreeCursor_t *cursor, const BTreeNode_t root, search_func func);
+DSC_DECL BTreeNode_t       dsc_btree_cursor_upper_bound(BTreeCursor_t *cursor, const BTreeNode_t root, search_func func);
+DSC_DECL BTreeNode_t       dsc_btree_cursor_next(BTreeCursor_t *cursor);
+DSC_DECL DscError_t        dsc_btree_cursor_destroy(BTreeCursor_t *cursor);
+DSC_DECL DscError_t        dsc_btree_save(const BTreeNode_t root, const size_t dsize, const char *path);
+DSC_DECL BTreeNode_t       dsc_btree_load(const Snapshot_t* const snap, const SearchMethod_t method, const DscAllocator_t *alloc);
+DSC_DECL const void*       dsc_btree_snapshot_peek(const Snapshot_t* const snap, search_func func, size_t *id);
 
 #ifdef __cplusplus
 }
@@ -2,23 +2,80 @@
 #define BUFFER_H
 
 #include "dsc_common.h"
+#include "dsc_alloc.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif // __cplusplus
 
+// Where a buffer's memory region comes from
+typedef enum {
+    BUF_HEAP, // Allocated through the buffer's allocator (malloc by default)
+    BUF_ANON, // Anonymous mapping; resized in place with mremap
+    BUF_FILE, // Shared file mapping; contents persist in the file
+    BUF_INLINE // Storage inside a SmallBuffer_t; spills to the heap once it outgrows it
+} BufBacking_t;
+
+// Bytes of inline storage held by a SmallBuffer_t (see dsc_buf_init_inline())
+#ifndef DSC_BUF_SMALL
+#define DSC_BUF_SMALL 32
+#endif // DSC_BUF_SMALL
+
+// Flags accepted by dsc_buf_init_mmap() and dsc_buf_map_file()
+#define DSC_BUF_HUGEPAGE (1u << 0) // Ask the kernel to back the mapping with transparent huge pages
+#define DSC_BUF_POPULATE (1u << 1) // Pre-fault the whole mapping up front
+
+// A Buffer_t copied by value shares its memory region with the original (dsc_buf_copy() makes a
+// separate one). The buf of a SmallBuffer_t must not be copied at all while it is inline.
 typedef struct {
    void   *base;  // Base address of the memory region
    uint8_t tsize; // The size (in bytes) of the data type used for the buffer's memory region
    size_t  bsize; // The size (in bytes) of the buffer's memory region
+   const DscAllocator_t *alloc; // Allocator backing the memory region (NULL for malloc)
+   BufBacking_t backing; // Where the memory region comes from
+   size_t  msize; // Length (in bytes) of the mapping; only used by mapped buffers
+   int     fd;    // File descriptor behind a BUF_FILE buffer
+   unsigned flags; // DSC_BUF_* flags a mapped buffer was created with
 } Buffer_t;
 
+// A Buffer_t that starts out in storage of its own. While it is inline, buf.base points into the
+// struct itself, so a SmallBuffer_t must not be copied or moved by value.
+typedef struct {
+   Buffer_t buf;                 // The buffer; pass &sbuf->buf wherever a Buffer_t is expected
+   uint8_t  small[DSC_BUF_SMALL]; // Inline storage; buf.base points here while buf.backing is BUF_INLINE
+} SmallBuffer_t;
+
 // Forward function declarations
 
-DscError_t     dsc_buf_init(Buffer_t *buf, const size_t nelem, const uint8_t tsize);
-DscError_t     dsc_buf_resize(Buffer_t *buf, const size_t nelem);
-DscError_t     dsc_buf_fill(Buffer_t *buf, const uint8_t byte);
-size_t         dsc_buf_nelem(const Buffer_t* const buf);
+DSC_DECL DscError_t     dsc_buf_init(Buffer_t *buf, const size_t nelem, const uint8_t tsize);
+DSC_DECL DscError_t     dsc_buf_init_alloc(Buffer_t *buf, const size_t nelem, const uint8_t tsize, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_buf_init_inline(SmallBuffer_t *sbuf, const size_t nelem, const uint8_t tsize, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_buf_init_mmap(Buffer_t *buf, const size_t nelem, const uint8_t tsize, const unsigned flags);
+DSC_DECL DscError_t     dsc_buf_map_file(Buffer_t *buf, const char *path, const size_t nelem, const uint8_t tsize, const unsigned flags);
+DSC_DECL DscError_t     dsc_buf_sync(const Buffer_t* const buf);
+DSC_DECL DscError_t     dsc_buf_destroy(Buffer_t *buf);
+DSC_DECL DscError_t     dsc_buf_resize(Buffer_t *buf, const size_t nelem);
+DSC_DECL DscError_t     dsc_buf_fill(Buffer_t *buf, const uint8_t byte);
+DSC_DECL DscError_t     dsc_buf_fill_elem(Buffer_t *buf, const void* const elem);
+DSC_DECL DscError_t     dsc_buf_copy(Buffer_t *dst, const Buffer_t* const src);
+DSC_DECL int            dsc_buf_compare(const Buffer_t* const lhs, const Buffer_t* const rhs);
+DSC_DECL size_t         dsc_buf_find(const Buffer_t* const buf, const void* const elem);
+DSC_DECL size_t         dsc_buf_count(const Buffer_t* const buf, const void* const elem);
+
+/**
+ * @brief Returns the number of elements that the buffer can fit.
+ * @since 04/06/2022
+ * @param[in] buf The buffer whos capacity is being checked
+ * @returns The capacity of the buffer or DSC_EFAIL upon failure
+ */
+static inline size_t dsc_buf_nelem(const Buffer_t* const buf) {
+    if (buf->base == NULL) {
+        DSC_LOG("The buffer points to an invalid baseess", DSC_ERROR);
+        return DSC_EFAIL;
+    }
+
+    return (buf->bsize / buf->tsize);
+}
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,81 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include "dsc_common.h"
+#include "dsc_alloc.h"
+#include "buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_CACHE_NIL UINT32_MAX
+
+// Which entry is dropped when a full cache takes a new key
+typedef enum {
+    CACHE_LRU,    // Evict the least recently used entry
+    CACHE_CLOCK,  // Evict the first entry the clock hand finds unreferenced since its last pass
+    CACHE_TINYLFU // LRU, but a new key is only admitted if it is used more often than the victim
+} CachePolicy_t;
+
+typedef struct {
+    size_t hits;       // Lookups that found their key
+    size_t misses;     // Lookups that did not
+    size_t inserts;    // New keys stored
+    size_t evictions;  // Entries dropped to make room for a new key
+    size_t rejections; // New keys refused by the admission filter (CACHE_TINYLFU only)
+} CacheStats_t;
+
+typedef void (* cache_evict_func)(const void *key, void *value, void *ctx);
+
+/*
+ * A bounded key/value cache. Entries live in one slab allocated up front and are linked by
+ * slab index rather than by pointer; a separate open-addressed table maps each key's hash to
+ * its entry. Nothing is allocated after initialization, so get, put and evict are all O(1).
+ * Keys and values are fixed-size and copied into the slab.
+ */
+typedef struct {
+    Buffer_t      slab;      // capacity entries of stride bytes: a header, the key, then the value
+    Buffer_t      index;     // Slab index + 1 of the entry in each table slot, or 0 if the slot is empty
+    Buffer_t      sketch;    // Saturating access counters estimating key frequency (CACHE_TINYLFU only)
+    size_t        capacity;  // Maximum number of entries
+    size_t        count;     // Number of entries
+    size_t        ksize;     // Size of each key in bytes
+    size_t        vsize;     // Size of each value in bytes
+    size_t        voff;      // Offset of the value within an entry
+    size_t        stride;    // Size of an entry in bytes
+    size_t        samples;   // Counter increments since the sketch was last aged
+    uint32_t      head;      // Most recently used entry (LRU policies)
+    uint32_t      tail;      // Least recently used entry (LRU policies)
+    uint32_t      free;      // First unused entry, linked through the entries' next fields
+    uint32_t      hand;      // Next entry the clock hand inspects (CACHE_CLOCK)
+    CachePolicy_t policy;    // Eviction policy
+    CacheStats_t  stats;     // Hit, miss and eviction counters
+    cache_evict_func on_evict; // Called for each entry dropped by the cache (may be NULL)
+    void         *evict_ctx; // Passed as the last argument to on_evict
+} Cache_t;
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_cache_init(Cache_t *cache, const size_t capacity, const size_t ksize, const size_t vsize, const CachePolicy_t policy);
+DSC_DECL DscError_t     dsc_cache_init_alloc(Cache_t *cache, const size_t capacity, const size_t ksize, const size_t vsize, const CachePolicy_t policy, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_cache_destroy(Cache_t *cache);
+DSC_DECL void           dsc_cache_on_evict(Cache_t *cache, cache_evict_func func, void *ctx);
+DSC_DECL void*          dsc_cache_get(Cache_t *cache, const void* const key);
+DSC_DECL DscError_t     dsc_cache_put(Cache_t *cache, const void* const key, const void* const value);
+DSC_DECL DscError_t     dsc_cache_remove(Cache_t *cache, const void* const key);
+
+static inline size_t dsc_cache_count(const Cache_t* const cache) {
+    return cache->count;
+}
+
+static inline double dsc_cache_hit_rate(const Cache_t* const cache) {
+    const size_t lookups = cache->stats.hits + cache->stats.misses;
+    return (lookups != 0) ? (double)cache->stats.hits / (double)lookups : 0.0;
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // CACHE_H
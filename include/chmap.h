@@ -0,0 +1,47 @@
+#ifndef CHMAP_H
+#define CHMAP_H
+
+#include "dsc_common.h"
+#include "map.h"
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_CACHELINE 64
+
+// One stripe of a CMap_t. Each segment is an ordinary Map_t guarded by its own lock and is
+// padded to a cache line so that readers of neighbouring segments do not share lock lines.
+typedef struct {
+    pthread_rwlock_t lock; // Held shared by readers and exclusively by writers of this segment
+    Map_t            map;  // Entries whose hash selects this segment
+} __attribute__((aligned(DSC_CACHELINE))) CMapSegment_t;
+
+typedef struct {
+    CMapSegment_t *segs;         // Cache-line aligned array of nsegs segments
+    void          *raw;          // Allocation that segs was carved from
+    size_t         nsegs;        // Number of segments (power of two)
+    size_t         ksize;        // Size of each key in bytes (0 if keys are NUL-terminated strings)
+    size_t         vsize;        // Size of each value in bytes
+    const DscAllocator_t *alloc; // Shared by every segment; must be thread-safe and have no stats
+} CMap_t;
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_chmap_init(CMap_t *map, const size_t nsegs, const size_t ksize, const size_t vsize);
+DSC_DECL DscError_t     dsc_chmap_init_alloc(CMap_t *map, const size_t nsegs, const size_t ksize, const size_t vsize, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_chmap_destroy(CMap_t *map);
+DSC_DECL DscError_t     dsc_chmap_add_entry(CMap_t *map, const void* const key, const void* const value);
+DSC_DECL DscError_t     dsc_chmap_replace_entry(CMap_t *map, const void* const key, const void* const value);
+DSC_DECL DscError_t     dsc_chmap_remove_entry(CMap_t *map, const void* const key);
+DSC_DECL DscError_t     dsc_chmap_retrieve_value(CMap_t *map, const void* const key, void *value);
+DSC_DECL bool           dsc_chmap_contains_key(CMap_t *map, const void* const key);
+DSC_DECL size_t         dsc_chmap_count(CMap_t *map);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // CHMAP_H
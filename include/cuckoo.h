@@ -0,0 +1,48 @@
+#ifndef CUCKOO_H
+#define CUCKOO_H
+
+#include "dsc_common.h"
+#include "dsc_alloc.h"
+#include "buffer.h"
+#include "hash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_CUCKOO_SLOTS 4 // Fingerprints per bucket; a bucket is one 64-bit word
+
+/*
+ * Cuckoo filter. Each key is reduced to a 16-bit fingerprint stored in one of two buckets, the
+ * second derived from the first and the fingerprint alone, so fingerprints can be moved between
+ * their buckets without the key. Unlike a Bloom filter, keys can be removed.
+ */
+typedef struct {
+    Buffer_t  buckets;  // nbuckets buckets of DSC_CUCKOO_SLOTS 16-bit fingerprints (0 = empty)
+    size_t    mask;     // Number of buckets - 1 (the number of buckets is a power of two)
+    size_t    count;    // Number of fingerprints stored
+    size_t    ksize;    // Size of each key in bytes (0 if keys are NUL-terminated strings)
+    hash_func hash;     // Hashes keys
+    uint64_t  rng;      // State of the generator that picks fingerprints to relocate
+    size_t    victim;   // Bucket of the fingerprint that could not be placed
+    uint16_t  victim_fp; // Fingerprint that could not be placed, or 0 if there is none
+} Cuckoo_t;
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_cuckoo_init(Cuckoo_t *filter, const size_t nkeys, const size_t ksize, hash_func hash);
+DSC_DECL DscError_t     dsc_cuckoo_init_alloc(Cuckoo_t *filter, const size_t nkeys, const size_t ksize, hash_func hash, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_cuckoo_destroy(Cuckoo_t *filter);
+DSC_DECL DscError_t     dsc_cuckoo_add(Cuckoo_t *filter, const void* const key);
+DSC_DECL bool           dsc_cuckoo_contains(const Cuckoo_t* const filter, const void* const key);
+DSC_DECL DscError_t     dsc_cuckoo_remove(Cuckoo_t *filter, const void* const key);
+
+static inline size_t dsc_cuckoo_count(const Cuckoo_t* const filter) {
+    return filter->count;
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // CUCKOO_H
@@ -0,0 +1,42 @@
+#ifndef DLL_H
+#define DLL_H
+
+#include "dsc_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/*
+ * Circular doubly linked list with a sentinel head. Nodes are never allocated by the list, so
+ * a struct DLLNode can be embedded in the object it links; linking and unlinking are O(1) and
+ * never fail. An unlinked node points at itself.
+ */
+typedef struct DLLNode {
+    void *data;           // Pointer to the node's data (unused by the head)
+    struct DLLNode *prev; // Pointer to the previous node (the last node, for the head)
+    struct DLLNode *next; // Pointer to the next node (the first node, for the head)
+} *DLLNode_t;
+
+// Forward function declarations
+
+DSC_DECL void           dsc_dll_init(DLLNode_t node, void *data);
+DSC_DECL void           dsc_dll_insert_after(DLLNode_t pos, DLLNode_t node);
+DSC_DECL void           dsc_dll_append(DLLNode_t head, DLLNode_t node);
+DSC_DECL void           dsc_dll_unlink(DLLNode_t node);
+DSC_DECL void           dsc_dll_splice(DLLNode_t dst, DLLNode_t src);
+DSC_DECL size_t         dsc_dll_nelem(const DLLNode_t head);
+
+static inline bool dsc_dll_empty(const DLLNode_t head) {
+    return head->next == head;
+}
+
+static inline bool dsc_dll_linked(const DLLNode_t node) {
+    return node->next != node;
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // DLL_H
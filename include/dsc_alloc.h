@@ -0,0 +1,113 @@
+#ifndef DSC_ALLOC_H
+#define DSC_ALLOC_H
+
+#include "dsc_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Counters updated by every container that uses an allocator with stats attached.
+// They are plain (non-atomic) integers, so give each container its own DscStats_t
+// if containers are used from different threads.
+typedef struct {
+    size_t allocs;     // Number of successful allocations, including reallocations
+    size_t frees;      // Number of blocks freed
+    size_t bytes;      // Bytes currently allocated
+    size_t peak_bytes; // High-water mark of bytes
+    size_t resizes;    // Number of times a container resized its storage
+    size_t lookups;    // Number of hash lookups performed
+    size_t probes;     // Total slots inspected by hash lookups (probes / lookups = mean probe length)
+} DscStats_t;
+
+typedef struct {
+    void *(*alloc)(void *ctx, size_t size);                                   // Required
+    void *(*realloc)(void *ctx, void *ptr, size_t old_size, size_t new_size); // Required
+    void  (*free)(void *ctx, void *ptr, size_t size);                         // Required
+    void       *ctx;   // Passed as the first argument to each callback (e.g. an arena)
+    DscStats_t *stats; // Optional counters; may be NULL
+} DscAllocator_t;
+
+/*
+ * A NULL allocator is valid everywhere one is accepted and means malloc/realloc/free.
+ * Containers route all of their heap traffic through the helpers below.
+ */
+
+static inline void _dsc_stats_alloc(DscStats_t *stats, const size_t size) {
+    ++stats->allocs;
+    stats->bytes += size;
+    if (stats->bytes > stats->peak_bytes) {
+        stats->peak_bytes = stats->bytes;
+    }
+}
+
+static inline void *dsc_alloc(const DscAllocator_t* const alloc, const size_t size) {
+    if (alloc == NULL) {
+        return malloc(size);
+    }
+
+    void *ptr = alloc->alloc(alloc->ctx, size);
+    if (ptr != NULL && alloc->stats != NULL) {
+        _dsc_stats_alloc(alloc->stats, size);
+    }
+    return ptr;
+}
+
+static inline void *dsc_calloc(const DscAllocator_t* const alloc, const size_t nmemb, const size_t size) {
+    if (alloc == NULL) {
+        return calloc(nmemb, size);
+    } else if (size != 0 && nmemb > SIZE_MAX / size) {
+        return NULL; // The total would overflow, as calloc() reports
+    }
+
+    void *ptr = dsc_alloc(alloc, nmemb * size);
+    if (ptr != NULL) {
+        memset(ptr, 0, nmemb * size);
+    }
+    return ptr;
+}
+
+static inline void *dsc_realloc(
+    const DscAllocator_t* const alloc,
+    void *ptr,
+    const size_t old_size,
+    const size_t new_size
+) {
+    if (alloc == NULL) {
+        return realloc(ptr, new_size);
+    }
+
+    void *new_ptr = alloc->realloc(alloc->ctx, ptr, old_size, new_size);
+    if (new_ptr != NULL && alloc->stats != NULL) {
+        _dsc_stats_alloc(alloc->stats, new_size);
+        alloc->stats->bytes -= old_size;
+    }
+    return new_ptr;
+}
+
+static inline void dsc_free(const DscAllocator_t* const alloc, void *ptr, const size_t size) {
+    if (ptr == NULL) {
+        return;
+    } else if (alloc == NULL) {
+        free(ptr);
+        return;
+    }
+
+    alloc->free(alloc->ctx, ptr, size);
+    if (alloc->stats != NULL) {
+        ++alloc->stats->frees;
+        alloc->stats->bytes -= size;
+    }
+}
+
+#define DSC_STATS_ADD(alloc, field, n) do { \
+    if ((alloc) != NULL && (alloc)->stats != NULL) { \
+        (alloc)->stats->field += (n); \
+    } \
+} while (0)
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // DSC_ALLOC_H
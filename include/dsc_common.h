@@ -19,6 +19,13 @@
 extern "C" {
 #endif // __cplusplus
 
+// Marks the public API; everything else is hidden when building with -fvisibility=hidden
+#if defined(__GNUC__) || defined(__clang__)
+#define DSC_DECL __attribute__((visibility("default")))
+#else
+#define DSC_DECL
+#endif
+
 // Errors align with those defined in errno.h
 typedef enum {
     DSC_EFAIL       = -1,   // General purpose error
@@ -36,51 +43,43 @@ typedef enum {
     DSC_ERROR
 } DscLogLevel_t;
 
-#if defined(__GNUC__)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-function"
-#elif defined(__clang__)
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wunused-function"
-#endif
-
-static void _dsc_log(
+typedef void (* dsc_log_sink)(
+    void *ctx,
+    const DscLogLevel_t level,
     const char *file,
     const char *func,
     const int line,
-    const char *msg,
-    const DscLogLevel_t level
-) {
-    const char* header;
-    switch (level) {
-        case DSC_NOTE:
-            header = strdup("NOTE");
-            break;
-        case DSC_WARNING:
-            header = strdup("WARNING");
-            break;
-        case DSC_ERROR:
-            header = strdup("ERROR");
-            break;
-    }
+    const char *msg
+);
 
-    fprintf((level == DSC_NOTE) ? stdout : stderr,
-        "\n=========== %s ===========\n"
-        "Logger: %s\n"
-        "File: %s, Function: %s, Line: %d\n",
-        header, msg, file, func, line
-    );
-}
+// Compile-time log levels; these mirror DscLogLevel_t so that they can be tested with #if
+#define DSC_LOG_LEVEL_NOTE    0
+#define DSC_LOG_LEVEL_WARNING 1
+#define DSC_LOG_LEVEL_ERROR   2
+#define DSC_LOG_LEVEL_OFF     3
 
-#if defined(__GNUC__)
-#pragma GCC diagnostic pop
-#elif defined(__clang__)
-#pragma clang diagnostic pop
-#endif
+// Messages below DSC_LOG_LEVEL are compiled out. Define it as DSC_LOG_LEVEL_OFF to remove all logging.
+#ifndef DSC_LOG_LEVEL
+#ifdef DEBUG
+#define DSC_LOG_LEVEL DSC_LOG_LEVEL_NOTE
+#else
+#define DSC_LOG_LEVEL DSC_LOG_LEVEL_ERROR
+#endif // DEBUG
+#endif // DSC_LOG_LEVEL
+
+DSC_DECL void           _dsc_log(const char *file, const char *func, const int line, const char *msg, const DscLogLevel_t level);
+DSC_DECL void           dsc_log_set_sink(dsc_log_sink sink, void *ctx);
+DSC_DECL void           dsc_log_set_rate_limit(const unsigned max_per_sec);
 
+#if DSC_LOG_LEVEL >= DSC_LOG_LEVEL_OFF
+#define DSC_LOG(msg, level) do { } while (0)
+#else
 #define DSC_LOG(msg, level) do { \
-    _dsc_log((__FILE__), (__func__), (__LINE__), (msg), (level)); \
+    if ((int)(level) >= DSC_LOG_LEVEL) { \
+        _dsc_log((__FILE__), (__func__), (__LINE__), (msg), (level)); \
+    } \
 } while (0)
+#endif // DSC_LOG_LEVEL
 
 #ifdef __cplusplus
 }
@@ -7,6 +7,9 @@
 extern "C" {
 #endif // __cplusplus
 
+// Signature shared by the hash functions below; containers that accept one default to fnv1a_hash()
+typedef uint32_t (*hash_func)(const void *data, const size_t size);
+
 /**
  * @brief Produces a 32-bit hash for a generic byte stream using FNV-1a hash.
  * @since 06-09-2025
@@ -14,7 +17,7 @@ extern "C" {
  * @param[in] size The size of __data__ in bytes
  * @returns The 32-bit hash
  */
-static uint32_t fnv1a_hash(const void *data, const size_t size) {
+static inline uint32_t fnv1a_hash(const void *data, const size_t size) {
     const uint8_t *bytes = (const uint8_t *)data;
     uint32_t hash = 2166136261; // FNV offset basis
 
@@ -26,6 +29,84 @@ static uint32_t fnv1a_hash(const void *data, const size_t size) {
     return hash;
 }
 
+/**
+ * @brief Produces a 32-bit hash for a generic byte stream using MurmurHash3 (x86_32, seed 0).
+ * Reads four bytes per step, so it is faster than fnv1a_hash() on longer keys.
+ * @since 19-10-2026
+ * @param[in] data The data being hashed
+ * @param[in] size The size of __data__ in bytes
+ * @returns The 32-bit hash
+ */
+static inline uint32_t murmur3_hash(const void *data, const size_t size) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t hash = 0;
+    uint32_t k;
+    size_t i = 0;
+
+    for (; i + 4 <= size; i += 4) {
+        memcpy(&k, bytes + i, sizeof(k));
+        k *= 0xCC9E2D51;
+        k = (k << 15) | (k >> 17);
+        hash ^= k * 0x1B873593;
+        hash = (hash << 13) | (hash >> 19);
+        hash = hash * 5 + 0xE6546B64;
+    }
+
+    k = 0;
+    switch (size & 3) {
+        case 3: k ^= (uint32_t)bytes[i + 2] << 16; // Fall through
+        case 2: k ^= (uint32_t)bytes[i + 1] << 8;  // Fall through
+        case 1:
+            k ^= bytes[i];
+            k *= 0xCC9E2D51;
+            k = (k << 15) | (k >> 17);
+            hash ^= k * 0x1B873593;
+    }
+
+    hash ^= (uint32_t)size;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6B;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+/**
+ * @brief Spreads a hash over 64 well-mixed bits (splitmix64 finalizer), for callers that derive
+ * several independent indices from one hash.
+ * @since 19-10-2026
+ * @param[in] hash The hash, e.g. from fnv1a_hash()
+ * @returns The mixed 64-bit value
+ */
+static inline uint64_t mix64_hash(const uint64_t hash) {
+    uint64_t z = hash + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Hashes a key of up to eight bytes (e.g. an integer or an Intern_t ID) by mixing it as
+ * one word, which is much cheaper than hashing it byte by byte. Longer keys fall back to
+ * murmur3_hash().
+ * @since 19-10-2026
+ * @param[in] data The data being hashed
+ * @param[in] size The size of __data__ in bytes
+ * @returns The 32-bit hash
+ */
+static inline uint32_t int_hash(const void *data, const size_t size) {
+    uint64_t word = 0;
+
+    if (size > sizeof(word)) {
+        return murmur3_hash(data, size);
+    }
+    memcpy(&word, data, size);
+
+    return (uint32_t)mix64_hash(word);
+}
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
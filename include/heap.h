@@ -0,0 +1,58 @@
+#ifndef HEAP_H
+#define HEAP_H
+
+#include "dsc_common.h"
+#include "dsc_alloc.h"
+#include "buffer.h"
+#include "parallel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_HEAP_NO_HANDLE SIZE_MAX
+
+/*
+ * Array-based d-ary min-heap: the element that orders first according to cmp is on top.
+ * A wider node (d = 4 by default) makes the heap shallower and keeps a node's children in
+ * one or two cache lines, which outweighs the extra comparisons once the heap is large.
+ */
+typedef struct {
+    Buffer_t     data;     // Elements in heap order; its size is the capacity
+    Buffer_t     handles;  // Handle of the element at each position (only when tracking handles)
+    Buffer_t     slots;    // Position of each live handle, or the next free handle
+    size_t       nelem;    // Number of elements
+    size_t       nhandles; // Number of handles ever handed out
+    size_t       free;     // First free handle, or DSC_HEAP_NO_HANDLE
+    size_t       arity;    // Number of children per node
+    compare_func cmp;      // Orders two elements, like the comparator passed to qsort()
+    bool         reverse;  // Puts the element that orders last on top instead
+    bool         track;    // Whether handles are maintained (see dsc_heap_track_handles())
+} Heap_t;
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_heap_init(Heap_t *heap, const uint8_t tsize, const size_t arity, compare_func cmp);
+DSC_DECL DscError_t     dsc_heap_init_alloc(Heap_t *heap, const uint8_t tsize, const size_t arity, compare_func cmp, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_heap_destroy(Heap_t *heap);
+DSC_DECL DscError_t     dsc_heap_track_handles(Heap_t *heap);
+DSC_DECL DscError_t     dsc_heap_push(Heap_t *heap, const void* const elem, size_t *handle);
+DSC_DECL DscError_t     dsc_heap_pop(Heap_t *heap, void *out);
+DSC_DECL DscError_t     dsc_heap_update(Heap_t *heap, const size_t handle, const void* const elem);
+DSC_DECL DscError_t     dsc_heap_remove(Heap_t *heap, const size_t handle);
+DSC_DECL DscError_t     dsc_heap_heapify(Heap_t *heap, const void* const base, const size_t nelem);
+DSC_DECL size_t         dsc_heap_topk(const void* const base, const size_t nelem, const uint8_t tsize, const size_t k, compare_func cmp, void *out);
+
+static inline const void *dsc_heap_peek(const Heap_t* const heap) {
+    return (heap->nelem != 0) ? heap->data.base : NULL;
+}
+
+static inline size_t dsc_heap_nelem(const Heap_t* const heap) {
+    return heap->nelem;
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // HEAP_H
@@ -2,7 +2,9 @@
 #define HMAP_H
 
 #include "dsc_common.h"
+#include "buffer.h"
 #include "map.h"
+#include "snapshot.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -10,13 +12,25 @@ extern "C" {
 
 // Forward function declarations
 
-DscError_t     dsc_hmap_init(Map_t *map, const size_t nelem);
-DscError_t     dsc_hmap_add_entry(Map_t map, const void* const key, const void* const value);
-DscError_t     dsc_hmap_replace_entry(Map_t map, const void* const key, const void* const value);
-DscError_t     dsc_hmap_remove_entry(Map_t map, const void* const key);
-Buffer_t       dsc_hmap_retrieve_value(const Map_t map, const void* const key);
-bool           dsc_hmap_contains_key(const Map_t map, const void* const key);
-bool           dsc_hmap_contains_value(const Map_t map, const void* const value);
+DSC_DECL DscError_t     dsc_hmap_init(Map_t *map, const size_t nelem, const size_t ksize, const size_t vsize);
+DSC_DECL DscError_t     dsc_hmap_init_alloc(Map_t *map, const size_t nelem, const size_t ksize, const size_t vsize, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_hmap_set_resize(Map_t *map, const MapResize_t resize);
+DSC_DECL DscError_t     dsc_hmap_set_hash(Map_t *map, const hash_func hash);
+DSC_DECL DscError_t     dsc_hmap_destroy(Map_t *map);
+DSC_DECL DscError_t     dsc_hmap_add_entry(Map_t *map, const void* const key, const void* const value);
+DSC_DECL DscError_t     dsc_hmap_add_many(Map_t *map, const void* const keys, const void* const values, const size_t n, const size_t nthreads);
+DSC_DECL DscError_t     dsc_hmap_replace_entry(Map_t *map, const void* const key, const void* const value);
+DSC_DECL DscError_t     dsc_hmap_remove_entry(Map_t *map, const void* const key);
+DSC_DECL Buffer_t       dsc_hmap_retrieve_value(const Map_t* const map, const void* const key);
+DSC_DECL bool           dsc_hmap_contains_key(const Map_t* const map, const void* const key);
+DSC_DECL size_t         dsc_hmap_retrieve_many(const Map_t* const map, const void* const keys, const size_t n, void **values);
+DSC_DECL size_t         dsc_hmap_contains_many(const Map_t* const map, const void* const keys, const size_t n, bool *found);
+DSC_DECL bool           dsc_hmap_contains_value(const Map_t* const map, const void* const value);
+DSC_DECL size_t         dsc_hmap_next_entries(const Map_t* const map, size_t *pos, const KV_t **entries, const size_t max);
+DSC_DECL DscError_t     dsc_hmap_save(const Map_t* const map, const char *path);
+DSC_DECL DscError_t     dsc_hmap_load(Map_t *map, const Snapshot_t* const snap, const DscAllocator_t *alloc);
+DSC_DECL Buffer_t       dsc_hmap_snapshot_retrieve_value(const Snapshot_t* const snap, const void* const key);
+DSC_DECL bool           dsc_hmap_snapshot_contains_key(const Snapshot_t* const snap, const void* const key);
 
 #ifdef __cplusplus
 }
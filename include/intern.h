@@ -0,0 +1,49 @@
+#ifndef INTERN_H
+#define INTERN_H
+
+#include "dsc_common.h"
+#include "dsc_alloc.h"
+#include "buffer.h"
+#include "hash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/*
+ * String interning pool. Each distinct string is copied once into a single arena and given a
+ * 32-bit ID; IDs are dense (0, 1, 2, ...) and never change, so they can stand in for the string
+ * as a map key (see dsc_hmap_set_hash() and int_hash()).
+ */
+typedef struct {
+    Buffer_t chars;  // Arena holding every string, NUL-terminated, back to back
+    Buffer_t offs;   // offs[id]: offset of string id in chars
+    Buffer_t index;  // Open-addressed table; each slot holds a string's hash above its id + 1 (0 = empty)
+    size_t   mask;   // Number of index slots - 1 (the number of slots is a power of two)
+    size_t   used;   // Bytes of chars in use
+    size_t   count;  // Number of strings interned, which is also the next ID
+} Intern_t;
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_intern_init(Intern_t *pool, const size_t nstrings);
+DSC_DECL DscError_t     dsc_intern_init_alloc(Intern_t *pool, const size_t nstrings, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_intern_destroy(Intern_t *pool);
+DSC_DECL DscError_t     dsc_intern_add(Intern_t *pool, const char *str, uint32_t *id);
+DSC_DECL DscError_t     dsc_intern_find(const Intern_t* const pool, const char *str, uint32_t *id);
+DSC_DECL const char    *dsc_intern_str(const Intern_t* const pool, const uint32_t id);
+
+static inline size_t dsc_intern_count(const Intern_t* const pool) {
+    return pool->count;
+}
+
+// Bytes of string data held by the pool, including terminators
+static inline size_t dsc_intern_bytes(const Intern_t* const pool) {
+    return pool->used;
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // INTERN_H
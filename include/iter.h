@@ -0,0 +1,65 @@
+#ifndef ITER_H
+#define ITER_H
+
+#include "dsc_common.h"
+#include "buffer.h"
+#include "stack.h"
+#include "ll.h"
+#include "dll.h"
+#include "map.h"
+#include "btree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_ITER_BATCH 64 // Suggested number of element pointers to ask dsc_iter_next() for
+
+typedef struct Iter Iter_t;
+typedef size_t (* iter_func)(Iter_t *iter, void **elems, const size_t max);
+
+/*
+ * Streaming iterator over any container. Each dsc_iter_next() call hands back a batch of
+ * pointers to the container's elements, so a pipeline stage can walk a list, map or tree
+ * without copying it and without paying a call per element. The container must not be
+ * modified while it is being iterated over. An iterator over a tree holds a cursor, which must
+ * not be copied by value, so neither may the iterator. If that cursor runs out of memory, the
+ * walk ends early and dsc_iter_destroy() reports DSC_ENOMEM.
+ */
+struct Iter {
+    iter_func     next;   // Fills in the next batch for the kind of container being walked
+    const void   *src;    // The container
+    void         *node;   // Next node of a linked list (NULL at the end)
+    size_t        pos;    // Next element of a buffer or slot of a map
+    BTreeCursor_t cursor; // In-order position in a tree
+};
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_iter_buf(Iter_t *iter, const Buffer_t* const buf);
+DSC_DECL DscError_t     dsc_iter_stack(Iter_t *iter, const Stack_t* const stack);
+DSC_DECL DscError_t     dsc_iter_ll(Iter_t *iter, const LLNode_t head);
+DSC_DECL DscError_t     dsc_iter_dll(Iter_t *iter, const DLLNode_t head);
+DSC_DECL DscError_t     dsc_iter_hmap(Iter_t *iter, const Map_t* const map);
+DSC_DECL DscError_t     dsc_iter_btree(Iter_t *iter, const BTreeNode_t root);
+DSC_DECL DscError_t     dsc_iter_destroy(Iter_t *iter);
+
+/**
+ * @brief Fetches the next batch of element pointers. What an element pointer points at depends
+ * on the container: an element of a buffer or stack, the data of a list or tree node, or the
+ * KV_t of a map entry.
+ * @since 19-10-2026
+ * @param[in/out] iter The iterator
+ * @param[out] elems Receives up to max element pointers
+ * @param[in] max The capacity of elems
+ * @returns The number of pointers stored, which is 0 once the container has been exhausted
+ */
+static inline size_t dsc_iter_next(Iter_t *iter, void **elems, const size_t max) {
+    return iter->next(iter, elems, max);
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // ITER_H
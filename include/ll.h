@@ -2,6 +2,7 @@
 #define LL_H
 
 #include "dsc_common.h"
+#include "dsc_alloc.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -10,17 +11,19 @@ extern "C" {
 typedef struct LLNode {
     void *data;          // Pointer to the node's data
     struct LLNode *next; // Pointer to next node in the list
+    const DscAllocator_t *alloc; // Allocator used for this node and the nodes appended after it
 } *LLNode_t;
 
 // Forward function declarations
 
-LLNode_t       dsc_ll_create(void* data);
-DscError_t     dsc_ll_destroy(LLNode_t head);
-DscError_t     dsc_ll_append(LLNode_t head, void* data);
-DscError_t     dsc_ll_insert(LLNode_t head, const LLNode_t node, const unsigned idx);
-DscError_t     dsc_ll_remove(LLNode_t head, const unsigned idx);
-LLNode_t       dsc_ll_peek(const LLNode_t head, const unsigned idx);
-size_t         dsc_ll_nelem(const LLNode_t head);
+DSC_DECL LLNode_t       dsc_ll_create(void* data);
+DSC_DECL LLNode_t       dsc_ll_create_alloc(void* data, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_ll_destroy(LLNode_t head);
+DSC_DECL DscError_t     dsc_ll_append(LLNode_t head, void* data);
+DSC_DECL DscError_t     dsc_ll_insert(LLNode_t head, const LLNode_t node, const unsigned idx);
+DSC_DECL DscError_t     dsc_ll_remove(LLNode_t head, const unsigned idx);
+DSC_DECL LLNode_t       dsc_ll_peek(const LLNode_t head, const unsigned idx);
+DSC_DECL size_t         dsc_ll_nelem(const LLNode_t head);
 
 #ifdef __cplusplus
 }
@@ -7,21 +7,34 @@ extern "C" {
 
 #include <stddef.h>
 
-// Method used for when hash collisions occur
+#include "dsc_alloc.h"
+#include "hash.h"
+
+// How the slot array grows once it passes its load factor
 typedef enum {
-    BUCKETS,    // Use buckets i.e., value points to a linked list
-    INCREMENTAL // Continue iterating until a free slot is available
-} MapMethod_t;
+    RESIZE_BLOCKING,   // Move every entry into the new slot array during the insert that triggers it
+    RESIZE_INCREMENTAL // Keep both slot arrays and move a bounded number of slots per update
+} MapResize_t;
 
 typedef struct {
     void *key;
     void *value;
 } KV_t;
 
+// Hash map using open addressing; collisions are resolved by linear probing
 typedef struct {
     KV_t  *base;                // Pointer to the base address of the map
     size_t nelem;               // Number of slots allocated; not the number of KV pairs
-    const MapMethod_t method;   // Mapping method (use buckets or increment when collision occurs)
+    size_t count;               // Number of KV pairs currently stored in the map
+    size_t ntomb;               // Number of slots holding a removed entry (tombstone)
+    size_t ksize;               // Size of each key in bytes (0 if keys are NUL-terminated strings)
+    size_t vsize;               // Size of each value in bytes
+    const DscAllocator_t *alloc; // Allocator for the slots and entries (NULL for malloc)
+    MapResize_t resize;         // Growth policy (RESIZE_BLOCKING by default)
+    hash_func hash;             // Hash for keys (fnv1a_hash() by default)
+    KV_t  *old_base;            // Slot array being drained by an incremental resize (NULL if none)
+    size_t old_nelem;           // Number of slots in old_base
+    size_t migrated;            // Number of slots of old_base that have been drained so far
 } Map_t;
 
 #ifdef __cplusplus
@@ -0,0 +1,73 @@
+#ifndef PACKED_H
+#define PACKED_H
+
+#include "dsc_common.h"
+#include "dsc_alloc.h"
+#include "buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_PACKED_BLOCK 128 // Values per block; each block has its own base and bit width
+
+// Header of one block of a PackedArray_t
+typedef struct {
+    uint64_t base;  // Smallest value in the block; the others are stored as offsets from it
+    uint32_t word;  // Index of the block's first word in the packed bits
+    uint32_t width; // Bits per offset (0 to 64)
+} PackedBlock_t;
+
+/*
+ * Read-only array of 64-bit integers compressed with frame-of-reference bit packing. Values are
+ * split into blocks of DSC_PACKED_BLOCK, and each block stores its offsets from its smallest
+ * value in just enough bits for the largest. Sorted ID lists and clustered values shrink the
+ * most. Any element can still be read in constant time with dsc_packed_get().
+ */
+typedef struct {
+    Buffer_t words;  // Packed offsets of every block, back to back, followed by two zero words
+    Buffer_t blocks; // One PackedBlock_t per block
+    size_t   nelem;  // Number of values
+} PackedArray_t;
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_packed_init(PackedArray_t *arr, const uint64_t *values, const size_t nelem);
+DSC_DECL DscError_t     dsc_packed_init_alloc(PackedArray_t *arr, const uint64_t *values, const size_t nelem, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_packed_destroy(PackedArray_t *arr);
+DSC_DECL size_t         dsc_packed_decode(const PackedArray_t* const arr, const size_t start, const size_t n, uint64_t *out);
+DSC_DECL size_t         dsc_packed_lower_bound(const PackedArray_t* const arr, const uint64_t key);
+
+/**
+ * @brief Reads value i in constant time: one block header and at most two words.
+ * @since 19-10-2026
+ * @param[in] arr The array
+ * @param[in] i The index of the value, which must be less than the number of values
+ * @returns The value
+ */
+static inline uint64_t dsc_packed_get(const PackedArray_t* const arr, const size_t i) {
+    const PackedBlock_t *blk = &((const PackedBlock_t*)arr->blocks.base)[i / DSC_PACKED_BLOCK];
+    const uint64_t *words = (const uint64_t*)arr->words.base + blk->word;
+    const size_t bit = (i % DSC_PACKED_BLOCK) * blk->width;
+    const unsigned s = (unsigned)(bit & 63);
+    const uint64_t mask = (blk->width < 64) ? (UINT64_C(1) << blk->width) - 1 : UINT64_MAX;
+
+    // The second word supplies the bits that straddle into it; shifted out entirely when s is 0
+    const uint64_t v = (words[bit >> 6] >> s) | ((words[(bit >> 6) + 1] << 1) << (63 - s));
+    return blk->base + (v & mask);
+}
+
+static inline size_t dsc_packed_nelem(const PackedArray_t* const arr) {
+    return arr->nelem;
+}
+
+// Bytes used by the packed values and block headers
+static inline size_t dsc_packed_bytes(const PackedArray_t* const arr) {
+    return arr->words.bsize + arr->blocks.bsize;
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // PACKED_H
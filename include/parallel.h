@@ -0,0 +1,27 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "dsc_common.h"
+#include "pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Runs one share of a parallel job. idx is in [0, nthreads); the caller's thread runs idx 0.
+typedef void (* parallel_func)(void *ctx, const size_t idx, const size_t nthreads);
+typedef int  (* compare_func)(const void *lhs, const void *rhs);
+
+// Forward function declarations
+
+DSC_DECL size_t         dsc_parallel_nthreads(const size_t nthreads);
+DSC_DECL DscError_t     dsc_parallel_run(parallel_func func, void *ctx, const size_t nthreads);
+DSC_DECL DscError_t     dsc_parallel_sort(void *base, const size_t nelem, const size_t size, compare_func cmp, const size_t nthreads);
+DSC_DECL DscError_t     dsc_parallel_for(const size_t n, const size_t grain, range_func func, void *ctx);
+DSC_DECL void           dsc_parallel_set_pool(ThreadPool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // PARALLEL_H
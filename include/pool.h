@@ -0,0 +1,68 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include "dsc_common.h"
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_POOL_DEQUE 1024 // Capacity of each worker's deque; a full deque stops further splitting
+
+// Processes the indices [lo, hi) of a dsc_pool_for() job
+typedef void (* range_func)(void *ctx, const size_t lo, const size_t hi);
+
+typedef struct PoolJob PoolJob_t;
+struct ThreadPool;
+
+/*
+ * Chase-Lev work-stealing deque. The owner pushes and pops at the bottom, other threads steal
+ * from the top. Entries index the task table of the current job. top and bottom are kept on
+ * separate cache lines from each other and from the neighbouring deques.
+ */
+typedef struct {
+    int64_t  top;
+    uint8_t  pad0[64 - sizeof(int64_t)];
+    int64_t  bottom;
+    uint8_t  pad1[64 - sizeof(int64_t)];
+    uint32_t ring[DSC_POOL_DEQUE];
+    uint64_t rng;  // Picks the next victim to steal from
+    struct ThreadPool *pool; // Pool the deque belongs to
+} PoolDeque_t;
+
+/*
+ * Fixed set of worker threads that share dsc_pool_for() jobs by work stealing. The thread that
+ * submits a job works on it too, using the last deque, so a pool of n threads starts n - 1.
+ */
+typedef struct ThreadPool {
+    PoolDeque_t    *deques;   // One per thread, the submitting thread's last
+    pthread_t      *threads;  // Worker threads
+    size_t          nthreads; // Threads working on each job, including the submitting thread
+    size_t          nstarted; // Worker threads actually started
+    pthread_mutex_t lock;     // Guards job, generation, busy and stop
+    pthread_cond_t  wake;     // Signalled when a job is posted or the pool stops
+    pthread_cond_t  done;     // Signalled when the last worker leaves a job
+    pthread_mutex_t submit;   // Held for the duration of a job; jobs do not overlap
+    PoolJob_t      *job;      // Job in progress, or NULL
+    uint64_t        generation; // Incremented for every job posted
+    size_t          busy;     // Workers still inside the current job
+    bool            stop;     // Set when the pool is being destroyed
+} ThreadPool_t;
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_pool_init(ThreadPool_t *pool, const size_t nthreads);
+DSC_DECL DscError_t     dsc_pool_destroy(ThreadPool_t *pool);
+DSC_DECL DscError_t     dsc_pool_for(ThreadPool_t *pool, const size_t n, const size_t grain, range_func func, void *ctx);
+
+static inline size_t dsc_pool_nthreads(const ThreadPool_t* const pool) {
+    return pool->nthreads;
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // POOL_H
@@ -0,0 +1,55 @@
+#ifndef RCU_BTREE_H
+#define RCU_BTREE_H
+
+#include "dsc_common.h"
+#include "btree.h"
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_RCU_NLIMBO 3
+
+// Per-thread read-side state. Register one per thread that reads the tree.
+typedef struct RcuReader {
+    uint64_t epoch;         // Epoch observed by the current read section, or 0 outside of one
+    struct RcuReader *next; // Next registered reader
+} __attribute__((aligned(64))) RcuReader_t;
+
+// Nodes unlinked during one epoch, freed once no reader can still reach them
+typedef struct {
+    BTreeNode_t *nodes;
+    size_t       count;
+    size_t       cap;
+} RcuLimbo_t;
+
+typedef struct {
+    BTreeNode_t     root;    // Published root (NULL while empty); read and written atomically
+    uint64_t        epoch;   // Global epoch, starting at 1
+    RcuReader_t    *readers; // Registered readers
+    pthread_mutex_t wlock;   // Serializes writers, registration, and reclamation
+    RcuLimbo_t      limbo[DSC_RCU_NLIMBO]; // Retired nodes, indexed by the epoch they were retired in
+    RcuLimbo_t      path;    // Scratch space reused by writers for the path being copied
+    RcuLimbo_t      copies;  // Scratch space reused by writers for the copies of that path
+    SearchMethod_t  method;  // Search method given to every node
+    const DscAllocator_t *alloc; // Allocator for the nodes; called by writers only
+} RcuBTree_t;
+
+// Forward function declarations
+
+DSC_DECL DscError_t        dsc_rcu_btree_init(RcuBTree_t *tree, const SearchMethod_t method, const DscAllocator_t *alloc);
+DSC_DECL DscError_t        dsc_rcu_btree_destroy(RcuBTree_t *tree);
+DSC_DECL DscError_t        dsc_rcu_btree_register(RcuBTree_t *tree, RcuReader_t *reader);
+DSC_DECL DscError_t        dsc_rcu_btree_unregister(RcuBTree_t *tree, RcuReader_t *reader);
+DSC_DECL BTreeNode_t       dsc_rcu_btree_read_begin(RcuBTree_t *tree, RcuReader_t *reader);
+DSC_DECL void              dsc_rcu_btree_read_end(RcuReader_t *reader);
+DSC_DECL DscError_t        dsc_rcu_btree_add(RcuBTree_t *tree, void *data, size_t *id, insert_func func);
+DSC_DECL DscError_t        dsc_rcu_btree_remove(RcuBTree_t *tree, search_func func);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // RCU_BTREE_H
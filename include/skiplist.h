@@ -0,0 +1,66 @@
+#ifndef SKIPLIST_H
+#define SKIPLIST_H
+
+#include "dsc_common.h"
+#include "dsc_alloc.h"
+#include "parallel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_SKIP_MAXLEVEL 32
+
+/*
+ * A node is followed in memory by its key and then its value. Links are read and written
+ * atomically, so readers may walk the list while other threads insert into it.
+ */
+typedef struct SkipNode {
+    uint32_t height;          // Number of levels the node is linked into
+    struct SkipNode *next[];  // Successor at each level
+} *SkipNode_t;
+
+typedef struct {
+    SkipNode_t head;   // Sentinel linked into every level; holds no key
+    uint32_t   level;  // Number of levels in use
+    size_t     count;  // Number of entries
+    size_t     ksize;  // Size of each key in bytes
+    size_t     vsize;  // Size of each value in bytes
+    size_t     voff;   // Offset of the value from the key, padded for alignment
+    compare_func cmp;  // Orders two keys, like the comparator passed to qsort()
+    const DscAllocator_t *alloc; // Allocator for the nodes
+} SkipList_t;
+
+typedef void (* skip_visit_func)(const void *key, void *value, void *ctx);
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_skiplist_init(SkipList_t *list, const size_t ksize, const size_t vsize, compare_func cmp);
+DSC_DECL DscError_t     dsc_skiplist_init_alloc(SkipList_t *list, const size_t ksize, const size_t vsize, compare_func cmp, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_skiplist_destroy(SkipList_t *list);
+DSC_DECL DscError_t     dsc_skiplist_add(SkipList_t *list, const void* const key, const void* const value);
+DSC_DECL DscError_t     dsc_skiplist_add_concurrent(SkipList_t *list, const void* const key, const void* const value);
+DSC_DECL DscError_t     dsc_skiplist_remove(SkipList_t *list, const void* const key);
+DSC_DECL void*          dsc_skiplist_find(const SkipList_t* const list, const void* const key);
+DSC_DECL SkipNode_t     dsc_skiplist_first(const SkipList_t* const list);
+DSC_DECL SkipNode_t     dsc_skiplist_lower_bound(const SkipList_t* const list, const void* const key);
+DSC_DECL SkipNode_t     dsc_skiplist_next(const SkipNode_t node);
+DSC_DECL DscError_t     dsc_skiplist_range(const SkipList_t* const list, const void* const lo, const void* const hi, skip_visit_func func, void *ctx);
+
+static inline const void *dsc_skiplist_key(const SkipNode_t node) {
+    return &node->next[node->height];
+}
+
+static inline void *dsc_skiplist_value(const SkipList_t* const list, const SkipNode_t node) {
+    return (uint8_t*)&node->next[node->height] + list->voff;
+}
+
+static inline size_t dsc_skiplist_count(const SkipList_t* const list) {
+    return __atomic_load_n(&list->count, __ATOMIC_RELAXED);
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // SKIPLIST_H
@@ -0,0 +1,46 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "dsc_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_SNAPSHOT_MAGIC   "DSCSNAP"
+#define DSC_SNAPSHOT_VERSION 1
+#define DSC_SNAPSHOT_ENDIAN  0x01020304u
+
+typedef enum {
+    SNAPSHOT_HMAP  = 1, // Written by dsc_hmap_save()
+    SNAPSHOT_BTREE = 2  // Written by dsc_btree_save()
+} SnapshotKind_t;
+
+// Common prefix of every snapshot. Sections that follow it are addressed by byte offsets from
+// the start of the image rather than by pointers, so an image can be mapped at any address.
+typedef struct {
+    char     magic[8]; // DSC_SNAPSHOT_MAGIC
+    uint32_t endian;   // DSC_SNAPSHOT_ENDIAN in the writer's byte order
+    uint32_t version;  // DSC_SNAPSHOT_VERSION
+    uint32_t kind;     // A SnapshotKind_t
+    uint32_t reserved; // Always 0
+    uint64_t size;     // Size of the whole image in bytes
+} SnapshotHeader_t;
+
+typedef struct {
+    const uint8_t *base;   // Start of the image
+    size_t         size;   // Size of the image in bytes
+    size_t         msize;  // Length (in bytes) of the mapping; 0 unless opened by dsc_snapshot_open()
+} Snapshot_t;
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_snapshot_open(Snapshot_t *snap, const char *path);
+DSC_DECL DscError_t     dsc_snapshot_from(Snapshot_t *snap, const void *base, const size_t size);
+DSC_DECL DscError_t     dsc_snapshot_close(Snapshot_t *snap);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,38 @@
+#ifndef SORT_H
+#define SORT_H
+
+#include "dsc_common.h"
+#include "dsc_alloc.h"
+#include "buffer.h"
+#include "parallel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// How dsc_sort_radix() interprets each element
+typedef enum {
+    RADIX_UNSIGNED, // Unsigned integer of 1, 2, 4 or 8 bytes
+    RADIX_SIGNED    // Two's complement integer of 1, 2, 4 or 8 bytes
+} RadixKind_t;
+
+/*
+ * Sorting and searching over a Buffer_t, whose elements are tsize bytes each. Comparison sorts
+ * take a compare_func like qsort(); dsc_sort_radix() needs no comparison at all and is the
+ * fastest choice for integer elements.
+ */
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_sort(Buffer_t *buf, compare_func cmp);
+DSC_DECL DscError_t     dsc_sort_array(void *base, const size_t nelem, const size_t size, compare_func cmp);
+DSC_DECL DscError_t     dsc_sort_stable(Buffer_t *buf, compare_func cmp);
+DSC_DECL DscError_t     dsc_sort_radix(Buffer_t *buf, const RadixKind_t kind);
+DSC_DECL DscError_t     dsc_sort_parallel(Buffer_t *buf, compare_func cmp, const size_t nthreads);
+DSC_DECL size_t         dsc_lower_bound(const Buffer_t* const buf, const void* const key, compare_func cmp);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // SORT_H
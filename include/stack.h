@@ -8,15 +8,26 @@
 extern "C" {
 #endif // __cplusplus
 
-typedef Buffer_t Stack_t; // Stack is basically just a dynamic array
+// Stack is basically just a dynamic array (inline until it outgrows DSC_BUF_SMALL bytes). Like
+// any SmallBuffer_t, it must not be copied or moved by value.
+typedef SmallBuffer_t Stack_t;
 
 // Forward function declarations
 
-DscError_t     dsc_stack_init(Stack_t *stack, void *data, const uint8_t tsize);
-DscError_t     dsc_stack_push(Stack_t *stack, void *data);
-DscError_t     dsc_stack_pop(Stack_t *stack);
-void*          dsc_stack_peek(const Stack_t* const stack);
-size_t         dsc_stack_nelem(const Stack_t* const stack);
+DSC_DECL DscError_t     dsc_stack_init(Stack_t *stack, void *data, const uint8_t tsize);
+DSC_DECL DscError_t     dsc_stack_init_alloc(Stack_t *stack, void *data, const uint8_t tsize, const DscAllocator_t *alloc);
+DSC_DECL DscError_t     dsc_stack_destroy(Stack_t *stack);
+DSC_DECL DscError_t     dsc_stack_push(Stack_t *stack, void *data);
+DSC_DECL DscError_t     dsc_stack_pop(Stack_t *stack);
+
+static inline void *dsc_stack_peek(const Stack_t* const stack) {
+    size_t nelem = dsc_buf_nelem(&stack->buf);
+    return (uint8_t*)stack->buf.base + ((nelem - 1) * stack->buf.tsize);
+}
+
+static inline size_t dsc_stack_nelem(const Stack_t* const stack) {
+    return dsc_buf_nelem(&stack->buf);
+}
 
 #ifdef __cplusplus
 }
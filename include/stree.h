@@ -0,0 +1,36 @@
+#ifndef STREE_H
+#define STREE_H
+
+#include "dsc_common.h"
+#include "buffer.h"
+#include "btree.h"
+#include "parallel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/*
+ * Static search tree over a read-only sorted set. The elements are stored in Eytzinger (BFS)
+ * order: the children of index k live at 2k and 2k + 1, so the first levels of every search
+ * share a handful of cache lines and the next levels can be prefetched before they are needed.
+ */
+typedef struct {
+    Buffer_t     data;  // Elements in Eytzinger order from index 1; index 0 is unused
+    size_t       nelem; // Number of elements
+    compare_func cmp;   // Orders two elements, like the comparator passed to qsort()
+} STree_t;
+
+// Forward function declarations
+
+DSC_DECL DscError_t     dsc_stree_from_sorted(STree_t *tree, const Buffer_t* const sorted, compare_func cmp);
+DSC_DECL DscError_t     dsc_stree_from_btree(STree_t *tree, const BTreeNode_t root, const size_t dsize, compare_func cmp);
+DSC_DECL DscError_t     dsc_stree_destroy(STree_t *tree);
+DSC_DECL const void*    dsc_stree_lower_bound(const STree_t* const tree, const void* const key);
+DSC_DECL const void*    dsc_stree_find(const STree_t* const tree, const void* const key);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // STREE_H
@@ -0,0 +1,63 @@
+#ifndef TWHEEL_H
+#define TWHEEL_H
+
+#include "dsc_common.h"
+#include "dll.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#define DSC_TWHEEL_LEVELS 4
+#define DSC_TWHEEL_BITS   8
+#define DSC_TWHEEL_SLOTS  (1 << DSC_TWHEEL_BITS)
+
+typedef struct Timer Timer_t;
+
+typedef void (*timer_func)(Timer_t *timer, void *ctx);
+
+/*
+ * A timeout owned by the caller, usually embedded in the object it times out. The wheel only
+ * links and unlinks it, so scheduling never allocates.
+ */
+struct Timer {
+    struct DLLNode link;    // Links the timer into its slot; link.data points back at the timer
+    uint64_t       expires; // Tick at which the timer fires
+    timer_func     func;    // Called when the timer fires
+    void          *ctx;     // Passed as the second argument to func
+};
+
+/*
+ * Hierarchical timing wheel. Level 0 has one slot per tick for the next 256 ticks; each level
+ * above covers 256 times the span of the one below, so four levels reach 2^32 ticks ahead.
+ * Scheduling and cancelling are O(1). A timer sits in a coarse slot until the wheel turns far
+ * enough, then cascades into a finer one; every timer of a level-0 slot expires together.
+ */
+typedef struct {
+    struct DLLNode slots[DSC_TWHEEL_LEVELS][DSC_TWHEEL_SLOTS];         // Pending timers, by level and slot
+    uint64_t       occupied[DSC_TWHEEL_LEVELS][DSC_TWHEEL_SLOTS / 64]; // Slots that may hold timers
+    uint64_t       tick;                                               // Next tick to expire
+    size_t         count;                                              // Number of pending timers
+} TimerWheel_t;
+
+// Forward function declarations
+
+DSC_DECL void           dsc_timer_init(Timer_t *timer, timer_func func, void *ctx);
+DSC_DECL DscError_t     dsc_twheel_init(TimerWheel_t *wheel, const uint64_t now);
+DSC_DECL DscError_t     dsc_twheel_schedule(TimerWheel_t *wheel, Timer_t *timer, const uint64_t expires);
+DSC_DECL DscError_t     dsc_twheel_cancel(TimerWheel_t *wheel, Timer_t *timer);
+DSC_DECL size_t         dsc_twheel_advance(TimerWheel_t *wheel, const uint64_t now);
+
+static inline bool dsc_timer_pending(const Timer_t* const timer) {
+    return dsc_dll_linked((DLLNode_t)&timer->link);
+}
+
+static inline size_t dsc_twheel_count(const TimerWheel_t* const wheel) {
+    return wheel->count;
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // TWHEEL_H
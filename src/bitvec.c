@@ -0,0 +1,344 @@
+/**
+ * @file bitvec.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a static bitvector with constant time rank and fast select.
+*/
+
+#include "bitvec.h"
+
+#define DSC_BITVEC_BLOCK_WORDS 8 // Words per rank block (512 bits)
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+/*
+ * Popcount kernels. The rank and select bodies are written once and inlined into a plain copy
+ * and a copy built for the popcnt instruction (plus pdep, for select), which is picked at
+ * runtime; without it __builtin_popcountll() is a library call.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define DSC_BITVEC_POPCNT 1
+#include <immintrin.h>
+#else
+#define DSC_BITVEC_POPCNT 0
+#endif
+
+/**
+ * Set bits in the words of block b before word k (1 to 7). Counts for words 1 to 7 are packed
+ * 9 bits apiece into the block's second rank word; for k = 0 the shift lands on the unused top
+ * bit, which is always 0 (see Vigna, "Broadword Implementation of Rank/Select Queries").
+ */
+static inline size_t _dsc_bitvec_sub(const uint64_t *ranks, const size_t b, const size_t k) {
+    const uint64_t t = (uint64_t)k - 1;
+    return (size_t)((ranks[2 * b + 1] >> ((t + ((t >> 60) & 8)) * 9)) & 0x1FF);
+}
+
+static inline size_t _dsc_bitvec_rank_impl(const BitVec_t* const bv, const size_t i) {
+    const uint64_t *words = bv->bits.base;
+    const uint64_t *ranks = bv->ranks.base;
+    const size_t w = i >> 6;
+    const size_t b = w / DSC_BITVEC_BLOCK_WORDS;
+    const uint64_t below = words[w] & ((UINT64_C(1) << (i & 63)) - 1);
+
+    return (size_t)ranks[2 * b] + _dsc_bitvec_sub(ranks, b, w % DSC_BITVEC_BLOCK_WORDS)
+        + (size_t)__builtin_popcountll(below);
+}
+
+// Position of set bit number r (from 0) within word, which has more than r set bits
+static inline unsigned _dsc_bitvec_select_word(uint64_t word, size_t r) {
+    unsigned shift = 0;
+
+    for (;;) {
+        const size_t c = (size_t)__builtin_popcountll(word & 0xFF);
+        if (r < c) {
+            break;
+        }
+        r -= c;
+        word >>= 8;
+        shift += 8;
+    }
+    for (; r != 0; --r) {
+        word &= word - 1;
+    }
+
+    return shift + (unsigned)__builtin_ctzll(word);
+}
+
+/**
+ * Finds the word holding set bit number k and stores in *rem how many set bits of that word
+ * come before it.
+ */
+static inline size_t _dsc_bitvec_select_find(const BitVec_t* const bv, const size_t k, size_t *rem) {
+    const uint64_t *ranks = bv->ranks.base;
+    const size_t *samples = bv->samples.base;
+    const size_t j = k / DSC_BITVEC_SAMPLE;
+    size_t lo = samples[j];
+    size_t hi = samples[j + 1];
+
+    // Last block in [lo, hi] with no more than k set bits before it
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo + 1) / 2;
+        if (ranks[2 * mid] <= k) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+
+    // Last word of the block with no more than r set bits before it; counted without branching
+    const size_t r = k - (size_t)ranks[2 * lo];
+    size_t w = 0;
+    for (size_t i = 1; i < DSC_BITVEC_BLOCK_WORDS; ++i) {
+        w += (_dsc_bitvec_sub(ranks, lo, i) <= r);
+    }
+    *rem = r - _dsc_bitvec_sub(ranks, lo, w);
+
+    return lo * DSC_BITVEC_BLOCK_WORDS + w;
+}
+
+static inline size_t _dsc_bitvec_select_impl(const BitVec_t* const bv, const size_t k) {
+    size_t rem;
+    const size_t word = _dsc_bitvec_select_find(bv, k, &rem);
+    return (word << 6) + _dsc_bitvec_select_word(((const uint64_t*)bv->bits.base)[word], rem);
+}
+
+#if DSC_BITVEC_POPCNT
+
+__attribute__((target("popcnt")))
+static size_t _dsc_bitvec_rank_popcnt(const BitVec_t* const bv, const size_t i) {
+    return _dsc_bitvec_rank_impl(bv, i);
+}
+
+// pdep deposits a single bit onto the position of set bit number rem, selecting it directly
+__attribute__((target("popcnt,bmi2")))
+static size_t _dsc_bitvec_select_bmi2(const BitVec_t* const bv, const size_t k) {
+    size_t rem;
+    const size_t word = _dsc_bitvec_select_find(bv, k, &rem);
+    const uint64_t bits = ((const uint64_t*)bv->bits.base)[word];
+    return (word << 6) + (size_t)__builtin_ctzll(_pdep_u64(UINT64_C(1) << rem, bits));
+}
+
+static bool _dsc_bitvec_has_popcnt(void) {
+    return __builtin_cpu_supports("popcnt");
+}
+
+static bool _dsc_bitvec_has_bmi2(void) {
+    return __builtin_cpu_supports("popcnt") && __builtin_cpu_supports("bmi2");
+}
+
+#endif // DSC_BITVEC_POPCNT
+
+static size_t _dsc_bitvec_nwords(const size_t nbits) {
+    return (nbits + 63) / 64;
+}
+
+static size_t _dsc_bitvec_nblocks(const size_t nbits) {
+    // One more than needed for the bits, so that rank(nbits) has a block to read
+    return _dsc_bitvec_nwords(nbits) / DSC_BITVEC_BLOCK_WORDS + 1;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Initializes a bitvector of nbits bits, all clear.
+ * @since 19-10-2026
+ * @param[out] bv The bitvector
+ * @param[in] nbits The number of bits
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_bitvec_init(BitVec_t *bv, const size_t nbits) {
+    return dsc_bitvec_init_alloc(bv, nbits, NULL);
+}
+
+/**
+ * @brief Initializes a bitvector of nbits bits, all clear, whose storage comes from alloc.
+ * @since 19-10-2026
+ * @param[out] bv The bitvector
+ * @param[in] nbits The number of bits
+ * @param[in] alloc The allocator (NULL for malloc)
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_bitvec_init_alloc(BitVec_t *bv, const size_t nbits, const DscAllocator_t *alloc) {
+    if (bv == NULL) {
+        DSC_LOG("The bitvector points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    memset(bv, 0, sizeof(BitVec_t));
+    if (dsc_buf_init_alloc(&bv->bits, _dsc_bitvec_nwords(nbits) + 1, sizeof(uint64_t), alloc) != DSC_EOK
+        || dsc_buf_init_alloc(&bv->ranks, 2 * _dsc_bitvec_nblocks(nbits), sizeof(uint64_t), alloc) != DSC_EOK
+        || dsc_buf_init_alloc(&bv->samples, 2, sizeof(size_t), alloc) != DSC_EOK
+    ) {
+        dsc_buf_destroy(&bv->bits);
+        dsc_buf_destroy(&bv->ranks);
+        DSC_LOG("Failed to allocate memory for dsc bitvector", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+    dsc_buf_fill(&bv->bits, 0);
+    dsc_buf_fill(&bv->ranks, 0);
+    dsc_buf_fill(&bv->samples, 0);
+    bv->nbits = nbits;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Frees the bitvector's storage.
+ * @since 19-10-2026
+ * @param[in] bv The bitvector
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_bitvec_destroy(BitVec_t *bv) {
+    if (bv == NULL || bv->bits.base == NULL) {
+        DSC_LOG("The bitvector points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    dsc_buf_destroy(&bv->bits);
+    dsc_buf_destroy(&bv->ranks);
+    dsc_buf_destroy(&bv->samples);
+    bv->nbits = 0;
+    bv->ones = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Sets or clears bit i. Rank and select reflect the change after the next build.
+ * @since 19-10-2026
+ * @param[in] bv The bitvector
+ * @param[in] i The index of the bit
+ * @param[in] value The new value of the bit
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_bitvec_set(BitVec_t *bv, const size_t i, const bool value) {
+    if (bv == NULL || bv->bits.base == NULL) {
+        DSC_LOG("The bitvector points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (i >= bv->nbits) {
+        DSC_LOG("The bit index is outside the bounds of the bitvector", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    uint64_t *word = &((uint64_t*)bv->bits.base)[i >> 6];
+    const uint64_t mask = UINT64_C(1) << (i & 63);
+    *word = value ? (*word | mask) : (*word & ~mask);
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Builds the rank and select index over the current bits. Time is linear in the
+ * number of bits.
+ * @since 19-10-2026
+ * @param[in] bv The bitvector
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_bitvec_build(BitVec_t *bv) {
+    if (bv == NULL || bv->bits.base == NULL) {
+        DSC_LOG("The bitvector points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const uint64_t *words = bv->bits.base;
+    uint64_t *ranks = bv->ranks.base;
+    const size_t nwords = _dsc_bitvec_nwords(bv->nbits);
+    const size_t nblocks = _dsc_bitvec_nblocks(bv->nbits);
+    size_t total = 0;
+
+    for (size_t b = 0; b < nblocks; ++b) {
+        const size_t first = b * DSC_BITVEC_BLOCK_WORDS;
+        uint64_t sub = 0;
+        size_t in = 0;
+
+        for (size_t k = 0; k < DSC_BITVEC_BLOCK_WORDS; ++k) {
+            if (k != 0) {
+                sub |= (uint64_t)in << (9 * (k - 1));
+            }
+            if (first + k < nwords) {
+                in += (size_t)__builtin_popcountll(words[first + k]);
+            }
+        }
+        ranks[2 * b] = total;
+        ranks[2 * b + 1] = sub;
+        total += in;
+    }
+    bv->ones = total;
+
+    // One sample per DSC_BITVEC_SAMPLE set bits, then the last block to bound the final search
+    const size_t nsamples = (total + DSC_BITVEC_SAMPLE - 1) / DSC_BITVEC_SAMPLE + 1;
+    if (dsc_buf_resize(&bv->samples, nsamples) != DSC_EOK) {
+        DSC_LOG("Failed to allocate memory for dsc bitvector", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    size_t *samples = bv->samples.base;
+    size_t next = 0;
+    for (size_t b = 0; b < nblocks; ++b) {
+        const size_t end = (b + 1 < nblocks) ? (size_t)ranks[2 * (b + 1)] : total;
+        while (next * DSC_BITVEC_SAMPLE < end) {
+            samples[next++] = b;
+        }
+    }
+    samples[next] = nblocks - 1;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Counts the set bits before position i, in constant time.
+ * @since 19-10-2026
+ * @param[in] bv The bitvector, which must have been built
+ * @param[in] i A position from 0 to the number of bits
+ * @returns The number of set bits in [0, i)
+ */
+size_t dsc_bitvec_rank(const BitVec_t* const bv, const size_t i) {
+    if (bv == NULL || bv->bits.base == NULL || i > bv->nbits) {
+        DSC_LOG("The bit index is outside the bounds of the bitvector", DSC_ERROR);
+        return 0;
+    }
+
+#if DSC_BITVEC_POPCNT
+    if (_dsc_bitvec_has_popcnt()) {
+        return _dsc_bitvec_rank_popcnt(bv, i);
+    }
+#endif // DSC_BITVEC_POPCNT
+
+    return _dsc_bitvec_rank_impl(bv, i);
+}
+
+/**
+ * @brief Finds the position of set bit number k, counting from 0, so that
+ * dsc_bitvec_rank(bv, dsc_bitvec_select(bv, k)) == k. The search is confined to the blocks
+ * between two samples, then to a single block.
+ * @since 19-10-2026
+ * @param[in] bv The bitvector, which must have been built
+ * @param[in] k The number of the set bit
+ * @returns The position of the bit, or the number of bits if fewer than k + 1 bits are set
+ */
+size_t dsc_bitvec_select(const BitVec_t* const bv, const size_t k) {
+    if (bv == NULL || bv->bits.base == NULL) {
+        DSC_LOG("The bitvector points to an invalid address", DSC_ERROR);
+        return 0;
+    } else if (k >= bv->ones) {
+        return bv->nbits;
+    }
+
+#if DSC_BITVEC_POPCNT
+    if (_dsc_bitvec_has_bmi2()) {
+        return _dsc_bitvec_select_bmi2(bv, k);
+    }
+#endif // DSC_BITVEC_POPCNT
+
+    return _dsc_bitvec_select_impl(bv, k);
+}
@@ -0,0 +1,254 @@
+/**
+ * @file bloom.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a split-block Bloom filter for approximate set membership.
+*/
+
+#include "bloom.h"
+
+#define DSC_BLOOM_BLOCK (DSC_BLOOM_WORDS * sizeof(uint32_t))
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+// Odd multipliers that pick the bit set in each word of a block
+static const uint32_t _dsc_bloom_salts[DSC_BLOOM_WORDS] = {
+    0x47B6137B, 0x44974D91, 0x8824AD5B, 0xA2B7289D, 0x705495C7, 0x2DF1424B, 0x9EFC4947, 0x5C6BFB31
+};
+
+static size_t _dsc_bloom_klen(const Bloom_t* const bloom, const void* const key) {
+    return (bloom->ksize != 0) ? bloom->ksize : strlen((const char*)key) + 1;
+}
+
+/**
+ * The upper half of the mixed hash picks the block (by multiply-shift, so any number of blocks
+ * works) and the lower half picks the bits within it.
+ */
+static inline uint32_t *_dsc_bloom_block(const Bloom_t* const bloom, const uint64_t mixed) {
+    const size_t idx = (size_t)(((mixed >> 32) * (uint64_t)bloom->nblocks) >> 32);
+    return bloom->blocks + idx * DSC_BLOOM_WORDS;
+}
+
+static void _dsc_bloom_add_scalar(uint32_t *block, const uint32_t bits) {
+    for (size_t i = 0; i < DSC_BLOOM_WORDS; ++i) {
+        block[i] |= 1u << ((bits * _dsc_bloom_salts[i]) >> 27);
+    }
+}
+
+static bool _dsc_bloom_test_scalar(const uint32_t *block, const uint32_t bits) {
+    for (size_t i = 0; i < DSC_BLOOM_WORDS; ++i) {
+        if (!(block[i] & (1u << ((bits * _dsc_bloom_salts[i]) >> 27)))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Vector kernels. With AVX2 (checked at runtime) all eight words of a block are handled at
+ * once; otherwise, and on other architectures, the scalar loops above are used.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define DSC_BLOOM_SIMD 1
+#include <immintrin.h>
+#else
+#define DSC_BLOOM_SIMD 0
+#endif
+
+#if DSC_BLOOM_SIMD
+
+__attribute__((target("avx2")))
+static inline __m256i _dsc_bloom_mask_avx2(const uint32_t bits) {
+    const __m256i salts = _mm256_loadu_si256((const __m256i*)_dsc_bloom_salts);
+    const __m256i shifts = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int)bits), salts), 27);
+    return _mm256_sllv_epi32(_mm256_set1_epi32(1), shifts);
+}
+
+__attribute__((target("avx2")))
+static void _dsc_bloom_add_avx2(uint32_t *block, const uint32_t bits) {
+    const __m256i words = _mm256_load_si256((const __m256i*)block);
+    _mm256_store_si256((__m256i*)block, _mm256_or_si256(words, _dsc_bloom_mask_avx2(bits)));
+}
+
+__attribute__((target("avx2")))
+static bool _dsc_bloom_test_avx2(const uint32_t *block, const uint32_t bits) {
+    // testc is set when every bit of the mask is also set in the block
+    return _mm256_testc_si256(_mm256_load_si256((const __m256i*)block), _dsc_bloom_mask_avx2(bits)) != 0;
+}
+
+static bool _dsc_bloom_has_avx2(void) {
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif // DSC_BLOOM_SIMD
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Initializes an empty filter sized for an expected number of keys.
+ * @since 19-10-2026
+ * @param[out] bloom The filter
+ * @param[in] nkeys The number of keys the filter is sized for
+ * @param[in] bits_per_key Bits of filter per key; at nkeys keys, 10 gives a false positive rate
+ *            of about 1.3% and 16 about 0.15%
+ * @param[in] ksize The size of each key in bytes (0 if keys are NUL-terminated strings)
+ * @param[in] hash The hash function (NULL for fnv1a_hash())
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_bloom_init(
+    Bloom_t *bloom,
+    const size_t nkeys,
+    const size_t bits_per_key,
+    const size_t ksize,
+    hash_func hash
+) {
+    return dsc_bloom_init_alloc(bloom, nkeys, bits_per_key, ksize, hash, NULL);
+}
+
+/**
+ * @brief Initializes an empty filter whose storage comes from alloc.
+ * @since 19-10-2026
+ * @param[out] bloom The filter
+ * @param[in] nkeys The number of keys the filter is sized for
+ * @param[in] bits_per_key Bits of filter per key
+ * @param[in] ksize The size of each key in bytes (0 if keys are NUL-terminated strings)
+ * @param[in] hash The hash function (NULL for fnv1a_hash())
+ * @param[in] alloc The allocator (NULL for malloc)
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_bloom_init_alloc(
+    Bloom_t *bloom,
+    const size_t nkeys,
+    const size_t bits_per_key,
+    const size_t ksize,
+    hash_func hash,
+    const DscAllocator_t *alloc
+) {
+    if (bloom == NULL || bits_per_key == 0) {
+        DSC_LOG("The filter points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    memset(bloom, 0, sizeof(Bloom_t));
+    const size_t nbits = ((nkeys != 0) ? nkeys : 1) * bits_per_key;
+    bloom->nblocks = (nbits + DSC_BLOOM_BLOCK * 8 - 1) / (DSC_BLOOM_BLOCK * 8);
+    bloom->ksize = ksize;
+    bloom->hash = (hash != NULL) ? hash : fnv1a_hash;
+
+    const size_t bsize = (bloom->nblocks + 1) * DSC_BLOOM_BLOCK;
+    if (dsc_buf_init_alloc(&bloom->data, bsize, sizeof(uint8_t), alloc) != DSC_EOK) {
+        return DSC_ENOMEM;
+    }
+    dsc_buf_fill(&bloom->data, 0);
+
+    const uintptr_t base = (uintptr_t)bloom->data.base;
+    bloom->blocks = (uint32_t*)((base + DSC_BLOOM_BLOCK - 1) & ~(uintptr_t)(DSC_BLOOM_BLOCK - 1));
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Frees the filter's storage.
+ * @since 19-10-2026
+ * @param[in] bloom The filter
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_bloom_destroy(Bloom_t *bloom) {
+    if (bloom == NULL || bloom->blocks == NULL) {
+        DSC_LOG("The filter points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    dsc_buf_destroy(&bloom->data);
+    bloom->blocks = NULL;
+    bloom->count = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Adds a key by its hash, for callers that already hashed it with bloom->hash.
+ * @since 19-10-2026
+ * @param[in] bloom The filter
+ * @param[in] hash The key's hash
+ */
+void dsc_bloom_add_hash(Bloom_t *bloom, const uint32_t hash) {
+    const uint64_t mixed = mix64_hash(hash);
+    uint32_t *block = _dsc_bloom_block(bloom, mixed);
+
+#if DSC_BLOOM_SIMD
+    if (_dsc_bloom_has_avx2()) {
+        _dsc_bloom_add_avx2(block, (uint32_t)mixed);
+        ++bloom->count;
+        return;
+    }
+#endif // DSC_BLOOM_SIMD
+
+    _dsc_bloom_add_scalar(block, (uint32_t)mixed);
+    ++bloom->count;
+}
+
+/**
+ * @brief Tests a key by its hash, for callers that already hashed it with bloom->hash.
+ * @since 19-10-2026
+ * @param[in] bloom The filter
+ * @param[in] hash The key's hash
+ * @returns False if the key was definitely never added, true if it probably was
+ */
+bool dsc_bloom_contains_hash(const Bloom_t* const bloom, const uint32_t hash) {
+    const uint64_t mixed = mix64_hash(hash);
+    const uint32_t *block = _dsc_bloom_block(bloom, mixed);
+
+#if DSC_BLOOM_SIMD
+    if (_dsc_bloom_has_avx2()) {
+        return _dsc_bloom_test_avx2(block, (uint32_t)mixed);
+    }
+#endif // DSC_BLOOM_SIMD
+
+    return _dsc_bloom_test_scalar(block, (uint32_t)mixed);
+}
+
+/**
+ * @brief Adds a key to the filter.
+ * @since 19-10-2026
+ * @param[in] bloom The filter
+ * @param[in] key A pointer to the key
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_bloom_add(Bloom_t *bloom, const void* const key) {
+    if (bloom == NULL || bloom->blocks == NULL || key == NULL) {
+        DSC_LOG("The filter points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    dsc_bloom_add_hash(bloom, bloom->hash(key, _dsc_bloom_klen(bloom, key)));
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Tests whether a key may have been added. There are no false negatives; the false
+ * positive rate depends on the bits per key and on how many keys were added.
+ * @since 19-10-2026
+ * @param[in] bloom The filter
+ * @param[in] key A pointer to the key
+ * @returns False if the key was definitely never added, true if it probably was
+ */
+bool dsc_bloom_contains(const Bloom_t* const bloom, const void* const key) {
+    if (bloom == NULL || bloom->blocks == NULL || key == NULL) {
+        DSC_LOG("The filter points to an invalid address", DSC_ERROR);
+        return false;
+    }
+
+    return dsc_bloom_contains_hash(bloom, bloom->hash(key, _dsc_bloom_klen(bloom, key)));
+}
@@ -7,6 +7,56 @@
  */
 
 #include "btree.h"
+#include "parallel.h"
+#include "snapshot_internal.h"
+
+#define DSC_BTREE_NIL UINT32_MAX
+
+/*
+ * Snapshot layout: a BTreeSnapshot_t, then nnodes BTreeSnapNode_t in pre-order (so the root is
+ * node 0), then each node's data in the same order at a stride of dsize rounded up to 8 bytes.
+ */
+typedef struct {
+    SnapshotHeader_t hdr;
+    uint64_t nnodes;    // Number of nodes
+    uint64_t dsize;     // Bytes of data stored per node
+    uint64_t nodes_off; // Offset of the node table
+    uint64_t data_off;  // Offset of the data of node 0
+} BTreeSnapshot_t;
+
+typedef struct {
+    uint64_t id;    // The node's id
+    uint32_t left;  // Index of the left child, or DSC_BTREE_NIL
+    uint32_t right; // Index of the right child, or DSC_BTREE_NIL
+} BTreeSnapNode_t;
+
+// A subtree left for a worker thread while the top levels of a tree are built or destroyed
+typedef struct {
+    BTreeNode_t *link; // Where the subtree is linked into the top levels
+    size_t       lo;   // First element of the subtree
+    size_t       hi;   // One past the last element of the subtree
+} BTreeHole_t;
+
+typedef struct {
+    uint8_t       *base;   // Sorted elements
+    size_t         size;   // Size of each element
+    SearchMethod_t method; // Search method of every node
+    const DscAllocator_t *alloc; // Allocator of every node
+    BTreeHole_t   *holes;  // Subtrees built by the workers
+    size_t         nholes; // Number of subtrees
+    int            failed; // Set by a worker that ran out of memory
+} BTreeBuild_t;
+
+typedef struct {
+    BTreeNode_t *roots;  // Subtrees destroyed by the workers
+    size_t       nroots; // Number of subtrees
+} BTreeDestroy_t;
+
+typedef struct {
+    BTreeNode_t node;   // Node waiting to be numbered
+    size_t      parent; // Index of its parent in the node table
+    bool        left;   // True if it is its parent's left child
+} BTreeSnapTodo_t;
 
 /*
  * ===============================
@@ -77,7 +127,7 @@ static BTreeNode_t _dsc_btree_peek_parent_dfs(
     switch (func(root)) {
         case SEARCH_EQ: {
             if (root == prev_node) {
-                DSC_LOG("Tried finding parent for the root node", DSC_WARNING);
+                DSC_LOG("Tried finding parent for the root node", DSC_NOTE);
                 return NULL;
             } else {
                 return prev_node;
@@ -104,6 +154,280 @@ static BTreeNode_t _dsc_btree_peek_parent_dfs(
     }
 }
 
+static size_t _dsc_btree_stride(const size_t dsize) {
+    return (dsize + 7) & ~(size_t)7;
+}
+
+static const BTreeSnapshot_t *_dsc_btree_snapshot(const Snapshot_t* const snap) {
+    const BTreeSnapshot_t *hdr = _dsc_snapshot_section(snap, SNAPSHOT_BTREE, sizeof(BTreeSnapshot_t));
+    if (hdr == NULL) {
+        return NULL;
+    } else if (hdr->nnodes == 0 || hdr->nnodes >= DSC_BTREE_NIL
+        || hdr->nodes_off > snap->size || hdr->data_off > snap->size
+        || hdr->nnodes > (snap->size - hdr->nodes_off) / sizeof(BTreeSnapNode_t)
+        || (hdr->dsize != 0 && hdr->nnodes > (snap->size - hdr->data_off) / _dsc_btree_stride(hdr->dsize))
+    ) {
+        DSC_LOG("The binary tree snapshot is corrupt", DSC_ERROR);
+        return NULL;
+    }
+    return hdr;
+}
+
+/**
+ * Numbers the nodes of the tree in pre-order without recursing, since trees built from sorted
+ * input degenerate into lists. Returns the nodes in order and fills *table with their links.
+ */
+static BTreeNode_t *_dsc_btree_number(const BTreeNode_t root, BTreeSnapNode_t **table, size_t *nnodes) {
+    size_t cap = 64, ntodo = 0, n = 0;
+    BTreeNode_t *order = malloc(cap * sizeof(*order));
+    BTreeSnapNode_t *nodes = malloc(cap * sizeof(*nodes));
+    BTreeSnapTodo_t *todo = malloc(cap * sizeof(*todo));
+
+    if (order == NULL || nodes == NULL || todo == NULL) {
+        goto fail;
+    }
+
+    todo[ntodo++] = (BTreeSnapTodo_t){ root, DSC_BTREE_NIL, false };
+    while (ntodo != 0) {
+        const BTreeSnapTodo_t cur = todo[--ntodo];
+
+        // Two children may be pushed per node, so the todo stack never outgrows cap + 1
+        if (n == cap || ntodo + 2 > cap) {
+            cap *= 2;
+            BTreeNode_t *new_order = realloc(order, cap * sizeof(*order));
+            BTreeSnapNode_t *new_nodes = realloc(nodes, cap * sizeof(*nodes));
+            BTreeSnapTodo_t *new_todo = realloc(todo, cap * sizeof(*todo));
+            order = (new_order != NULL) ? new_order : order;
+            nodes = (new_nodes != NULL) ? new_nodes : nodes;
+            todo = (new_todo != NULL) ? new_todo : todo;
+            if (new_order == NULL || new_nodes == NULL || new_todo == NULL) {
+                goto fail;
+            }
+        }
+
+        if (n >= DSC_BTREE_NIL - 1) {
+            DSC_LOG("The binary tree has too many nodes for a snapshot", DSC_ERROR);
+            goto fail;
+        }
+        if (cur.parent != DSC_BTREE_NIL) {
+            if (cur.left) {
+                nodes[cur.parent].left = (uint32_t)n;
+            } else {
+                nodes[cur.parent].right = (uint32_t)n;
+            }
+        }
+        order[n] = cur.node;
+        nodes[n] = (BTreeSnapNode_t){ cur.node->id, DSC_BTREE_NIL, DSC_BTREE_NIL };
+
+        // Push right first so that the left subtree is numbered next
+        if (cur.node->right != NULL) {
+            todo[ntodo++] = (BTreeSnapTodo_t){ cur.node->right, n, false };
+        }
+        if (cur.node->left != NULL) {
+            todo[ntodo++] = (BTreeSnapTodo_t){ cur.node->left, n, true };
+        }
+        ++n;
+    }
+
+    free(todo);
+    *table = nodes;
+    *nnodes = n;
+    return order;
+
+fail:
+    free(order);
+    free(nodes);
+    free(todo);
+    return NULL;
+}
+
+// Levels built or destroyed serially so that roughly four subtrees are left per thread
+static size_t _dsc_btree_split_depth(const size_t nthreads) {
+    size_t depth = 2;
+    while (((size_t)1 << depth) < nthreads * 4) {
+        ++depth;
+    }
+    return depth;
+}
+
+/**
+ * Builds a balanced subtree from elements [lo, hi) by making the middle element the root.
+ * Each node's id is the index of its element. On failure nothing is left allocated.
+ */
+static bool _dsc_btree_build_range(
+    const BTreeBuild_t* const job,
+    const size_t lo,
+    const size_t hi,
+    BTreeNode_t *out
+) {
+    *out = NULL;
+    if (lo >= hi) {
+        return true;
+    }
+
+    size_t mid = lo + (hi - lo) / 2;
+    BTreeNode_t node = dsc_btree_create_alloc(job->base + mid * job->size, &mid, job->method, job->alloc);
+    if (node == NULL) {
+        return false;
+    }
+
+    if (!_dsc_btree_build_range(job, lo, mid, &node->left)
+        || !_dsc_btree_build_range(job, mid + 1, hi, &node->right)
+    ) {
+        if (node->left != NULL) {
+            dsc_btree_destroy(node->left);
+        }
+        dsc_free(job->alloc, node, sizeof(struct BTreeNode));
+        return false;
+    }
+    *out = node;
+
+    return true;
+}
+
+// As _dsc_btree_build_range(), but stops depth levels down and records the rest as holes
+static bool _dsc_btree_build_top(
+    BTreeBuild_t *job,
+    const size_t lo,
+    const size_t hi,
+    const size_t depth,
+    BTreeNode_t *out
+) {
+    *out = NULL;
+    if (lo >= hi) {
+        return true;
+    } else if (depth == 0) {
+        job->holes[job->nholes++] = (BTreeHole_t){ out, lo, hi };
+        return true;
+    }
+
+    size_t mid = lo + (hi - lo) / 2;
+    BTreeNode_t node = dsc_btree_create_alloc(job->base + mid * job->size, &mid, job->method, job->alloc);
+    if (node == NULL) {
+        return false;
+    }
+    *out = node;
+
+    // A partially built top is torn down by the caller, so there is nothing to undo here
+    return _dsc_btree_build_top(job, lo, mid, depth - 1, &node->left)
+        && _dsc_btree_build_top(job, mid + 1, hi, depth - 1, &node->right);
+}
+
+static void _dsc_btree_build_worker(void *ctx, const size_t idx, const size_t nthreads) {
+    BTreeBuild_t *job = ctx;
+
+    for (size_t i = idx; i < job->nholes; i += nthreads) {
+        const BTreeHole_t hole = job->holes[i];
+        if (__atomic_load_n(&job->failed, __ATOMIC_RELAXED)
+            || !_dsc_btree_build_range(job, hole.lo, hole.hi, hole.link)
+        ) {
+            __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+static void _dsc_btree_destroy_worker(void *ctx, const size_t idx, const size_t nthreads) {
+    BTreeDestroy_t *job = ctx;
+
+    for (size_t i = idx; i < job->nroots; i += nthreads) {
+        dsc_btree_destroy(job->roots[i]);
+    }
+}
+
+// On failure the cursor is left past the end with its status set, so that the walk stops
+static bool _dsc_btree_cursor_push(BTreeCursor_t *cursor, const BTreeNode_t node) {
+    if ((cursor->depth + 1) * sizeof(BTreeNode_t) > cursor->path.buf.bsize
+        && dsc_buf_resize(&cursor->path.buf, cursor->depth * 2 + 1) != DSC_EOK
+    ) {
+        DSC_LOG("Failed to allocate memory for dsc btree cursor", DSC_ERROR);
+        cursor->node = NULL;
+        cursor->depth = 0;
+        cursor->status = DSC_ENOMEM;
+        return false;
+    }
+
+    ((BTreeNode_t*)cursor->path.buf.base)[cursor->depth++] = node;
+    return true;
+}
+
+// Moves the cursor onto the nearest pending ancestor, or past the end if there is none
+static BTreeNode_t _dsc_btree_cursor_pop(BTreeCursor_t *cursor) {
+    cursor->node = (cursor->depth != 0) ? ((BTreeNode_t*)cursor->path.buf.base)[--cursor->depth] : NULL;
+    return cursor->node;
+}
+
+static bool _dsc_btree_cursor_push_left(BTreeCursor_t *cursor, BTreeNode_t node) {
+    for (; node != NULL; node = node->left) {
+        if (!_dsc_btree_cursor_push(cursor, node)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The path spills through the tree's allocator, like the nodes themselves
+static DscError_t _dsc_btree_cursor_init(BTreeCursor_t *cursor, const BTreeNode_t root) {
+    if (cursor == NULL) {
+        DSC_LOG("The cursor points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    cursor->node = NULL;
+    cursor->depth = 0;
+    cursor->status = DSC_EOK;
+    return dsc_buf_init_inline(&cursor->path, 0, sizeof(BTreeNode_t), (root != NULL) ? root->alloc : NULL);
+}
+
+/**
+ * Descends from root towards the bound, pushing every node the bound lies to the left of (or on,
+ * when inclusive), since those are the in-order successors of everything below them. The last
+ * node pushed is the bound itself.
+ */
+static BTreeNode_t _dsc_btree_cursor_seek(
+    BTreeCursor_t *cursor,
+    BTreeNode_t node,
+    search_func func,
+    const bool inclusive
+) {
+    if (_dsc_btree_cursor_init(cursor, node) != DSC_EOK) {
+        return NULL;
+    } else if (func == NULL) {
+        DSC_LOG("The search function points to an invalid address", DSC_ERROR);
+        return NULL;
+    }
+
+    while (node != NULL) {
+        const SearchCmp_t cmp = func(node);
+        if (cmp == SEARCH_LT || (inclusive && cmp == SEARCH_EQ)) {
+            if (!_dsc_btree_cursor_push(cursor, node)) {
+                return NULL;
+            }
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+
+    return _dsc_btree_cursor_pop(cursor);
+}
+
+// The bound without a cursor: the last node the descent would have pushed
+static BTreeNode_t _dsc_btree_bound(BTreeNode_t node, search_func func, const bool inclusive) {
+    BTreeNode_t bound = NULL;
+
+    while (node != NULL) {
+        const SearchCmp_t cmp = func(node);
+        if (cmp == SEARCH_LT || (inclusive && cmp == SEARCH_EQ)) {
+            bound = node;
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+
+    return bound;
+}
+
 /*
  * ===============================
  *       Public Functions
@@ -122,10 +446,28 @@ BTreeNode_t dsc_btree_create(
     void *data,
     size_t *id,
     const SearchMethod_t method
+) {
+    return dsc_btree_create_alloc(data, id, method, NULL);
+}
+
+/**
+ * @brief Create the root node for a binary tree whose nodes come from a custom allocator.
+ * @since 19-10-2026
+ * @param[in] data A pointer to the initial data used in the root node
+ * @param[in] id Optional id for the root node
+ * @param[in] method Method of traversing the tree when doing searches
+ * @param[in] alloc The allocator used for every node of the tree (NULL for malloc)
+ * @returns The newly allocated root node for the tree
+ */
+BTreeNode_t dsc_btree_create_alloc(
+    void *data,
+    size_t *id,
+    const SearchMethod_t method,
+    const DscAllocator_t *alloc
 ) {
     BTreeNode_t root = NULL;
 
-    root = malloc(sizeof(struct BTreeNode));
+    root = dsc_alloc(alloc, sizeof(struct BTreeNode));
     if (root == NULL) {
         DSC_LOG("Failed to allocate memory for dsc btree node", DSC_ERROR);
         return NULL;
@@ -140,6 +482,7 @@ BTreeNode_t dsc_btree_create(
     root->method = method;
     root->left = NULL;
     root->right = NULL;
+    root->alloc = alloc;
 
     return root;
 }
@@ -165,7 +508,7 @@ DscError_t dsc_btree_destroy(BTreeNode_t root) {
     if (root->right != NULL) {
         dsc_btree_destroy(root->right);
     }
-    free(root);
+    dsc_free(root->alloc, root, sizeof(struct BTreeNode));
 
     return DSC_EOK;
 }
@@ -190,7 +533,10 @@ DscError_t dsc_btree_add(
         return DSC_EINVAL;
     }
 
-    BTreeNode_t new_node = dsc_btree_create(data, id, root->method);
+    BTreeNode_t new_node = dsc_btree_create_alloc(data, id, root->method, root->alloc);
+    if (new_node == NULL) {
+        return DSC_ENOMEM;
+    }
     return _dsc_btree_add(root, new_node, func);
 }
 
@@ -213,7 +559,6 @@ DscError_t dsc_btree_remove(BTreeNode_t root, search_func func) {
     node = dsc_btree_peek(root, func);
 
     if (node == NULL) {
-        DSC_LOG("No matching nodes were found for removal", DSC_WARNING);
         return DSC_EFAIL;
     } else {
         // We should inform the parent that its child has been deleted
@@ -265,7 +610,7 @@ BTreeNode_t dsc_btree_peek_parent(BTreeNode_t root, search_func func) {
         DSC_LOG("The node points to an invalid address", DSC_ERROR);
         return NULL;
     } else if (root->left == NULL && root->right == NULL) {
-        DSC_LOG("The binary tree provided has no children", DSC_WARNING);
+        DSC_LOG("The binary tree provided has no children", DSC_NOTE);
         return NULL;
     }
 
@@ -278,15 +623,88 @@ BTreeNode_t dsc_btree_peek_parent(BTreeNode_t root, search_func func) {
 }
 
 /**
- * @brief Flattens the tree into a list ordered according to method.
+ * @brief Returns the first node, in order, that is not to the left of the target described by func.
+ * @since 19-10-2026
+ * @param[in] root The root node of the tree
+ * @param[in] func Compares the target against a node (SEARCH_LT if the target sorts before it)
+ * @returns The lower bound, or NULL if every node sorts before the target
+ */
+BTreeNode_t dsc_btree_lower_bound(const BTreeNode_t root, search_func func) {
+    if (root == NULL || func == NULL) {
+        DSC_LOG("The node points to an invalid address", DSC_ERROR);
+        return NULL;
+    }
+
+    return _dsc_btree_bound(root, func, true);
+}
+
+/**
+ * @brief Returns the first node, in order, that the target described by func sorts before.
+ * @since 19-10-2026
+ * @param[in] root The root node of the tree
+ * @param[in] func Compares the target against a node (SEARCH_LT if the target sorts before it)
+ * @returns The upper bound, or NULL if no node sorts after the target
+ */
+BTreeNode_t dsc_btree_upper_bound(const BTreeNode_t root, search_func func) {
+    if (root == NULL || func == NULL) {
+        DSC_LOG("The node points to an invalid address", DSC_ERROR);
+        return NULL;
+    }
+
+    return _dsc_btree_bound(root, func, false);
+}
+
+/**
+ * @brief Visits, in order, every node in [lo, hi). The scan seeks to lo in O(log n) and then
+ * only walks the nodes it visits, so it costs O(log n + k) for k visited nodes on a balanced tree.
+ * @since 19-10-2026
+ * @param[in] root The root node of the tree
+ * @param[in] lo Compares the inclusive lower bound against a node
+ * @param[in] hi Compares the exclusive upper bound against a node
+ * @param[in] func Called for each node in the range
+ * @param[in] ctx Passed through to func
+ * @returns DSC_ENOMEM if the cursor ran out of memory before the end of the range, otherwise a
+ *          DscError_t exit status code
+ */
+DscError_t dsc_btree_range(
+    const BTreeNode_t root,
+    search_func lo,
+    search_func hi,
+    visit_func func,
+    void *ctx
+) {
+    BTreeCursor_t cursor;
+
+    if (root == NULL || lo == NULL || hi == NULL || func == NULL) {
+        DSC_LOG("The node points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    for (BTreeNode_t node = dsc_btree_cursor_lower_bound(&cursor, root, lo);
+        node != NULL && hi(node) == SEARCH_GT;
+        node = dsc_btree_cursor_next(&cursor)
+    ) {
+        func(node, ctx);
+    }
+
+    // A cursor that ran out of memory stops early, so the range may only have been partly visited
+    const DscError_t status = cursor.status;
+    dsc_btree_cursor_destroy(&cursor);
+    return status;
+}
+
+/**
+ * @brief Flattens the tree into a list of its nodes in order.
  * @since 24-02-2024
  * @param[in] root The root node of the tree
  * @param[in/out] list A pointer to an allocated memory region of
  *                sufficient size for each node in the tree
- * @param[in] The size of the list in bytes
- * @param[in] method The depth-first-search method by which the list will be ordered
+ * @returns DSC_ENOMEM if the cursor ran out of memory before the last node (list is then only
+ *          partly filled), otherwise a DscError_t exit status code
  */
-DscError_t dsc_btree_flatten(const BTreeNode_t root, const BTreeNode_t *list) {
+DscError_t dsc_btree_flatten(const BTreeNode_t root, BTreeNode_t *list) {
+    BTreeCursor_t cursor;
+
     if (root == NULL) {
         DSC_LOG("The node points to an invalid address", DSC_ERROR);
         return DSC_EINVAL;
@@ -297,6 +715,445 @@ DscError_t dsc_btree_flatten(const BTreeNode_t root, const BTreeNode_t *list) {
         return DSC_EINVAL;
     }
 
-    DSC_LOG("Implement me", DSC_ERROR);
-    assert(false);
+    for (BTreeNode_t node = dsc_btree_cursor_first(&cursor, root);
+        node != NULL;
+        node = dsc_btree_cursor_next(&cursor)
+    ) {
+        *list++ = node;
+    }
+
+    const DscError_t status = cursor.status;
+    dsc_btree_cursor_destroy(&cursor);
+    return status;
+}
+
+/**
+ * @brief Places a cursor on the first node of the tree in order.
+ * @since 19-10-2026
+ * @param[out] cursor The cursor; release it with dsc_btree_cursor_destroy()
+ * @param[in] root The root node of the tree
+ * @returns The first node, or NULL if the tree is empty or memory ran out (cursor->status is
+ *          then DSC_ENOMEM)
+ */
+BTreeNode_t dsc_btree_cursor_first(BTreeCursor_t *cursor, const BTreeNode_t root) {
+    if (_dsc_btree_cursor_init(cursor, root) != DSC_EOK || !_dsc_btree_cursor_push_left(cursor, root)) {
+        return NULL;
+    }
+
+    return _dsc_btree_cursor_pop(cursor);
+}
+
+/**
+ * @brief Places a cursor on the lower bound (see dsc_btree_lower_bound()).
+ * @since 19-10-2026
+ * @param[out] cursor The cursor; release it with dsc_btree_cursor_destroy()
+ * @param[in] root The root node of the tree
+ * @param[in] func Compares the target against a node (SEARCH_LT if the target sorts before it)
+ * @returns The node the cursor is on, or NULL if there is none or memory ran out (cursor->status
+ *          is then DSC_ENOMEM)
+ */
+BTreeNode_t dsc_btree_cursor_lower_bound(BTreeCursor_t *cursor, const BTreeNode_t root, search_func func) {
+    return _dsc_btree_cursor_seek(cursor, root, func, true);
+}
+
+/**
+ * @brief Places a cursor on the upper bound (see dsc_btree_upper_bound()).
+ * @since 19-10-2026
+ * @param[out] cursor The cursor; release it with dsc_btree_cursor_destroy()
+ * @param[in] root The root node of the tree
+ * @param[in] func Compares the target against a node (SEARCH_LT if the target sorts before it)
+ * @returns The node the cursor is on, or NULL if there is none or memory ran out (cursor->status
+ *          is then DSC_ENOMEM)
+ */
+BTreeNode_t dsc_btree_cursor_upper_bound(BTreeCursor_t *cursor, const BTreeNode_t root, search_func func) {
+    return _dsc_btree_cursor_seek(cursor, root, func, false);
+}
+
+/**
+ * @brief Moves a cursor to the next node in order. Each step costs O(1) amortized.
+ * @since 19-10-2026
+ * @param[in/out] cursor The cursor
+ * @returns The next node, or NULL once the cursor has moved past the last node or memory ran out
+ *          (cursor->status is then DSC_ENOMEM)
+ */
+BTreeNode_t dsc_btree_cursor_next(BTreeCursor_t *cursor) {
+    if (cursor == NULL || cursor->node == NULL) {
+        return NULL;
+    }
+
+    if (!_dsc_btree_cursor_push_left(cursor, cursor->node->right)) {
+        return NULL;
+    }
+
+    return _dsc_btree_cursor_pop(cursor);
+}
+
+/**
+ * @brief Releases the memory held by a cursor.
+ * @since 19-10-2026
+ * @param[in] cursor The cursor
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_btree_cursor_destroy(BTreeCursor_t *cursor) {
+    if (cursor == NULL) {
+        DSC_LOG("The cursor points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    cursor->node = NULL;
+    cursor->depth = 0;
+    return dsc_buf_destroy(&cursor->path.buf);
+}
+
+/**
+ * @brief Writes the tree to a snapshot file that can later be mapped with dsc_snapshot_open() and
+ * searched in place. The file is written beside path and renamed over it once complete.
+ * @since 19-10-2026
+ * @param[in] root The root node of the tree
+ * @param[in] dsize The number of bytes copied from each node's data (0 to save only the shape and ids)
+ * @param[in] path The path of the snapshot file
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_btree_save(const BTreeNode_t root, const size_t dsize, const char *path) {
+    static const uint8_t zeros[8] = { 0 };
+    BTreeSnapshot_t hdr;
+    BTreeSnapNode_t *nodes = NULL;
+    char *tmp_path = NULL;
+    size_t nnodes = 0;
+    bool ok = true;
+
+    if (root == NULL || path == NULL) {
+        DSC_LOG("The node points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    BTreeNode_t *order = _dsc_btree_number(root, &nodes, &nnodes);
+    if (order == NULL) {
+        DSC_LOG("Failed to allocate memory for binary tree snapshot", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    const size_t stride = _dsc_btree_stride(dsize);
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.nnodes = nnodes;
+    hdr.dsize = dsize;
+    hdr.nodes_off = sizeof(hdr);
+    hdr.data_off = sizeof(hdr) + nnodes * sizeof(BTreeSnapNode_t);
+    _dsc_snapshot_header(&hdr.hdr, SNAPSHOT_BTREE, hdr.data_off + nnodes * stride);
+
+    FILE *file = _dsc_snapshot_create(path, &tmp_path);
+    if (file == NULL) {
+        free(order);
+        free(nodes);
+        return DSC_EFAIL;
+    }
+
+    ok = fwrite(&hdr, sizeof(hdr), 1, file) == 1
+        && fwrite(nodes, sizeof(BTreeSnapNode_t), nnodes, file) == nnodes;
+    for (size_t i = 0; ok && dsize != 0 && i < nnodes; ++i) {
+        if (order[i]->data == NULL) {
+            DSC_LOG("A node without data cannot be saved with a non-zero dsize", DSC_ERROR);
+            ok = false;
+            break;
+        }
+        ok = fwrite(order[i]->data, 1, dsize, file) == dsize
+            && fwrite(zeros, 1, stride - dsize, file) == stride - dsize;
+    }
+    free(order);
+    free(nodes);
+
+    return _dsc_snapshot_commit(file, tmp_path, path, ok);
+}
+
+/**
+ * @brief Rebuilds a tree from a snapshot. The data of each node points into the snapshot rather
+ * than being copied, so the snapshot must stay open until the tree is destroyed.
+ * @since 19-10-2026
+ * @param[in] snap A snapshot written by dsc_btree_save()
+ * @param[in] method The method used when searching the new tree
+ * @param[in] alloc The allocator used for the new nodes (NULL for malloc)
+ * @returns The root node of the new tree, or NULL on failure
+ */
+BTreeNode_t dsc_btree_load(const Snapshot_t* const snap, const SearchMethod_t method, const DscAllocator_t *alloc) {
+    const BTreeSnapshot_t *hdr = _dsc_btree_snapshot(snap);
+    if (hdr == NULL) {
+        return NULL;
+    }
+
+    const BTreeSnapNode_t *table = (const BTreeSnapNode_t*)(snap->base + hdr->nodes_off);
+    const size_t stride = _dsc_btree_stride(hdr->dsize);
+    BTreeNode_t *nodes = calloc(hdr->nnodes, sizeof(BTreeNode_t));
+    if (nodes == NULL) {
+        DSC_LOG("Failed to allocate memory for binary tree", DSC_ERROR);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < hdr->nnodes; ++i) {
+        size_t id = (size_t)table[i].id;
+        void *data = (hdr->dsize != 0) ? (void*)(snap->base + hdr->data_off + i * stride) : NULL;
+        nodes[i] = dsc_btree_create_alloc(data, &id, method, alloc);
+        if (nodes[i] == NULL) {
+            for (size_t j = 0; j < i; ++j) {
+                dsc_free(alloc, nodes[j], sizeof(struct BTreeNode));
+            }
+            free(nodes);
+            return NULL;
+        }
+    }
+
+    /*
+     * Children always follow their parent in pre-order, which rules out cycles, and no node may
+     * have two parents. A snapshot that breaks either rule is rejected rather than loaded in part.
+     */
+    bool *linked = calloc(hdr->nnodes, sizeof(bool));
+    bool corrupt = (linked == NULL);
+    for (size_t i = 0; i < hdr->nnodes && !corrupt; ++i) {
+        const uint32_t links[2] = { table[i].left, table[i].right };
+        BTreeNode_t *children[2] = { &nodes[i]->left, &nodes[i]->right };
+        for (size_t c = 0; c < 2 && !corrupt; ++c) {
+            if (links[c] == DSC_BTREE_NIL) {
+                continue;
+            } else if (links[c] <= i || links[c] >= hdr->nnodes || linked[links[c]]) {
+                DSC_LOG("The binary tree snapshot is corrupt", DSC_ERROR);
+                corrupt = true;
+            } else {
+                linked[links[c]] = true;
+                *children[c] = nodes[links[c]];
+            }
+        }
+    }
+
+    if (corrupt) {
+        if (linked == NULL) {
+            DSC_LOG("Failed to allocate memory for binary tree", DSC_ERROR);
+        }
+        for (size_t i = 0; i < hdr->nnodes; ++i) {
+            dsc_free(alloc, nodes[i], sizeof(struct BTreeNode));
+        }
+        free(linked);
+        free(nodes);
+        return NULL;
+    }
+
+    BTreeNode_t root = nodes[0];
+    free(linked);
+    free(nodes);
+
+    return root;
+}
+
+/**
+ * @brief Searches a snapshot in place. The node passed to func is a temporary whose data points
+ * into the snapshot; its left and right links are always NULL.
+ * @since 19-10-2026
+ * @param[in] snap A snapshot written by dsc_btree_save()
+ * @param[in] func Pointer to the search function
+ * @param[out] id Receives the id of the matching node (may be NULL)
+ * @returns The matching node's data inside the snapshot, or NULL if no node matched
+ */
+const void *dsc_btree_snapshot_peek(const Snapshot_t* const snap, search_func func, size_t *id) {
+    const BTreeSnapshot_t *hdr = _dsc_btree_snapshot(snap);
+    if (hdr == NULL) {
+        return NULL;
+    }
+
+    const BTreeSnapNode_t *table = (const BTreeSnapNode_t*)(snap->base + hdr->nodes_off);
+    const size_t stride = _dsc_btree_stride(hdr->dsize);
+    struct BTreeNode node = { 0 };
+    size_t idx = 0;
+
+    while (idx < hdr->nnodes) {
+        node.id = (size_t)table[idx].id;
+        node.data = (hdr->dsize != 0) ? (void*)(snap->base + hdr->data_off + idx * stride) : NULL;
+
+        const size_t prev = idx;
+        switch (func(&node)) {
+            case SEARCH_EQ: {
+                if (id != NULL) {
+                    *id = node.id;
+                }
+                return node.data;
+            }
+            case SEARCH_LT: {
+                idx = table[idx].left;
+                break;
+            }
+            case SEARCH_GT: {
+                idx = table[idx].right;
+                break;
+            }
+            default: {
+                DSC_LOG("Invalid branch arm", DSC_ERROR);
+                return NULL;
+            }
+        }
+
+        // Children always follow their parent, so a backwards link can only come from corruption
+        if (idx != DSC_BTREE_NIL && idx <= prev) {
+            DSC_LOG("The binary tree snapshot is corrupt", DSC_ERROR);
+            return NULL;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Builds a balanced tree from an array that is already sorted, in O(n). Node i holds a
+ * pointer to element i (the elements are not copied) and has an id of i.
+ * @since 19-10-2026
+ * @param[in] base The sorted elements
+ * @param[in] nelem The number of elements
+ * @param[in] size The size of each element in bytes
+ * @param[in] method The search method of every node
+ * @param[in] alloc The allocator of every node (NULL for malloc)
+ * @returns The root node of the new tree, or NULL on failure
+ */
+BTreeNode_t dsc_btree_build_from_sorted(
+    void *base,
+    const size_t nelem,
+    const size_t size,
+    const SearchMethod_t method,
+    const DscAllocator_t *alloc
+) {
+    BTreeBuild_t job = { base, size, method, alloc, NULL, 0, 0 };
+    BTreeNode_t root = NULL;
+
+    if (base == NULL || nelem == 0) {
+        DSC_LOG("The array points to an invalid address", DSC_ERROR);
+        return NULL;
+    }
+
+    _dsc_btree_build_range(&job, 0, nelem, &root);
+
+    return root;
+}
+
+/**
+ * @brief Sorts an array in place and builds a balanced tree from it, using several threads for
+ * both steps. The allocator is called from every thread, so it must be thread-safe.
+ * @since 19-10-2026
+ * @param[in/out] base The elements, which are left sorted
+ * @param[in] nelem The number of elements
+ * @param[in] size The size of each element in bytes
+ * @param[in] cmp The element comparison, as for qsort(); it must agree with the search function
+ * @param[in] nthreads The number of threads, or 0 for one per online CPU
+ * @param[in] method The search method of every node
+ * @param[in] alloc The allocator of every node and of the build's scratch memory (NULL for malloc)
+ * @returns The root node of the new tree, or NULL on failure
+ */
+BTreeNode_t dsc_btree_build(
+    void *base,
+    const size_t nelem,
+    const size_t size,
+    compare_func cmp,
+    const size_t nthreads,
+    const SearchMethod_t method,
+    const DscAllocator_t *alloc
+) {
+    const size_t n = dsc_parallel_nthreads(nthreads);
+    BTreeBuild_t job = { base, size, method, alloc, NULL, 0, 0 };
+    BTreeNode_t root = NULL;
+
+    if (base == NULL || nelem == 0 || cmp == NULL) {
+        DSC_LOG("The array points to an invalid address", DSC_ERROR);
+        return NULL;
+    } else if (dsc_parallel_sort(base, nelem, size, cmp, n) != DSC_EOK) {
+        return NULL;
+    } else if (n == 1) {
+        _dsc_btree_build_range(&job, 0, nelem, &root);
+        return root;
+    }
+
+    const size_t depth = _dsc_btree_split_depth(n);
+    const size_t hsize = ((size_t)1 << depth) * sizeof(BTreeHole_t);
+    job.holes = dsc_alloc(alloc, hsize);
+    if (job.holes == NULL) {
+        DSC_LOG("Failed to allocate memory for btree build", DSC_ERROR);
+        return NULL;
+    }
+
+    if (!_dsc_btree_build_top(&job, 0, nelem, depth, &root)
+        || dsc_parallel_run(_dsc_btree_build_worker, &job, n) != DSC_EOK
+    ) {
+        job.failed = 1; // Holes that were never filled are still NULL, so root can be destroyed
+    }
+    dsc_free(alloc, job.holes, hsize);
+
+    if (job.failed) {
+        DSC_LOG("Failed to allocate memory for dsc btree node", DSC_ERROR);
+        if (root != NULL) {
+            dsc_btree_destroy(root);
+        }
+        return NULL;
+    }
+
+    return root;
+}
+
+/**
+ * @brief Destroys a tree using several threads. The top few levels are freed by the calling
+ * thread and the subtrees below them are shared between the workers.
+ * @since 19-10-2026
+ * @param[in] root The root node of the tree
+ * @param[in] nthreads The number of threads, or 0 for one per online CPU
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_btree_destroy_parallel(BTreeNode_t root, const size_t nthreads) {
+    const size_t n = dsc_parallel_nthreads(nthreads);
+
+    if (root == NULL) {
+        DSC_LOG("The node points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (n == 1) {
+        return dsc_btree_destroy(root);
+    }
+
+    // The root is freed along with the top levels, so its allocator is kept for the scratch arrays
+    const DscAllocator_t *alloc = root->alloc;
+    const size_t width = (size_t)1 << _dsc_btree_split_depth(n);
+    BTreeNode_t *top = dsc_alloc(alloc, width * sizeof(BTreeNode_t));
+    BTreeNode_t *level = dsc_alloc(alloc, width * sizeof(BTreeNode_t));
+    BTreeNode_t *next = dsc_alloc(alloc, width * sizeof(BTreeNode_t));
+    if (top == NULL || level == NULL || next == NULL) {
+        dsc_free(alloc, top, width * sizeof(BTreeNode_t));
+        dsc_free(alloc, level, width * sizeof(BTreeNode_t));
+        dsc_free(alloc, next, width * sizeof(BTreeNode_t));
+        return dsc_btree_destroy(root);
+    }
+
+    // Walk down level by level until the next level would no longer fit
+    size_t ntop = 0, nlevel = 1;
+    level[0] = root;
+    while (nlevel != 0 && nlevel * 2 <= width && ntop + nlevel < width) {
+        size_t nnext = 0;
+        for (size_t i = 0; i < nlevel; ++i) {
+            top[ntop++] = level[i];
+            if (level[i]->left != NULL) {
+                next[nnext++] = level[i]->left;
+            }
+            if (level[i]->right != NULL) {
+                next[nnext++] = level[i]->right;
+            }
+        }
+        BTreeNode_t *swap = level;
+        level = next;
+        next = swap;
+        nlevel = nnext;
+    }
+
+    for (size_t i = 0; i < ntop; ++i) {
+        dsc_free(top[i]->alloc, top[i], sizeof(struct BTreeNode));
+    }
+    // If the threads cannot be started, the remaining subtrees are destroyed on this one instead
+    BTreeDestroy_t job = { level, nlevel };
+    if (dsc_parallel_run(_dsc_btree_destroy_worker, &job, n) != DSC_EOK) {
+        _dsc_btree_destroy_worker(&job, 0, 1);
+    }
+
+    dsc_free(alloc, top, width * sizeof(BTreeNode_t));
+    dsc_free(alloc, level, width * sizeof(BTreeNode_t));
+    dsc_free(alloc, next, width * sizeof(BTreeNode_t));
+
+    return DSC_EOK;
 }
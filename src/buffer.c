@@ -7,6 +7,328 @@
 */
 
 #include "buffer.h"
+#include "buffer_internal.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+// Mappings cover at least one page so that empty buffers still have a valid base address
+static size_t _dsc_buf_page_round(const size_t bsize) {
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t len = (bsize != 0) ? bsize : 1;
+    return (len + page - 1) & ~(page - 1);
+}
+
+static void _dsc_buf_advise(const Buffer_t* const buf) {
+    if (buf->flags & DSC_BUF_HUGEPAGE) {
+        // Only a hint; kernels built without transparent huge pages reject it
+        (void)madvise(buf->base, buf->msize, MADV_HUGEPAGE);
+    }
+}
+
+static DscError_t _dsc_buf_map(Buffer_t *buf, const size_t bsize, const int fd, const unsigned flags) {
+    const size_t msize = _dsc_buf_page_round(bsize);
+    int mflags = (fd < 0) ? (MAP_PRIVATE | MAP_ANONYMOUS) : MAP_SHARED;
+    if (flags & DSC_BUF_POPULATE) {
+        mflags |= MAP_POPULATE;
+    }
+
+    void *base = mmap(NULL, msize, PROT_READ | PROT_WRITE, mflags, fd, 0);
+    if (base == MAP_FAILED) {
+        DSC_LOG("Failed to map memory for dsc buffer", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    buf->base = base;
+    buf->bsize = bsize;
+    buf->msize = msize;
+    buf->fd = fd;
+    buf->flags = flags;
+    buf->alloc = NULL;
+    _dsc_buf_advise(buf);
+
+    return DSC_EOK;
+}
+
+// Grows or shrinks a mapped buffer without copying; the file (if any) is resized to match
+static DscError_t _dsc_buf_remap(Buffer_t *buf, const size_t bsize) {
+    const size_t msize = _dsc_buf_page_round(bsize);
+
+    if (buf->backing == BUF_FILE && bsize > buf->bsize && ftruncate(buf->fd, (off_t)bsize) != 0) {
+        DSC_LOG("Failed to grow the file backing dsc buffer", DSC_ERROR);
+        return DSC_EFAIL;
+    }
+
+    if (msize != buf->msize) {
+        void *base = mremap(buf->base, buf->msize, msize, MREMAP_MAYMOVE);
+        if (base == MAP_FAILED) {
+            DSC_LOG("Failed to remap memory for dsc buffer", DSC_ERROR);
+            return DSC_ENOMEM;
+        }
+        buf->base = base;
+        buf->msize = msize;
+        _dsc_buf_advise(buf);
+    }
+
+    if (buf->backing == BUF_FILE && bsize < buf->bsize && ftruncate(buf->fd, (off_t)bsize) != 0) {
+        DSC_LOG("Failed to shrink the file backing dsc buffer", DSC_ERROR);
+        return DSC_EFAIL;
+    }
+    buf->bsize = bsize;
+
+    return DSC_EOK;
+}
+
+// Resizes an inline buffer, moving its contents to the heap if they no longer fit
+static DscError_t _dsc_buf_spill(Buffer_t *buf, const size_t bsize) {
+    if (bsize <= DSC_BUF_SMALL) {
+        buf->bsize = bsize;
+        return DSC_EOK;
+    }
+
+    void *base = dsc_alloc(buf->alloc, bsize);
+    if (base == NULL) {
+        DSC_LOG("Failed to allocate memory for dsc buffer", DSC_ERROR);
+        return DSC_EFAIL;
+    }
+    memcpy(base, buf->base, buf->bsize);
+    buf->base = base;
+    buf->bsize = bsize;
+    buf->backing = BUF_HEAP;
+    DSC_STATS_ADD(buf->alloc, resizes, 1);
+
+    return DSC_EOK;
+}
+
+/*
+ * Element kernels. Elements of 1, 2, 4, 8 or 16 bytes are handled 32 bytes at a time with AVX2
+ * when the CPU supports it (checked at runtime) and 16 bytes at a time with SSE2 otherwise.
+ * Every other element size, and every other architecture, uses the scalar loops.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define DSC_BUF_SIMD 1
+#include <immintrin.h>
+#else
+#define DSC_BUF_SIMD 0
+#endif
+
+// Set through _dsc_buf_set_kernel()
+static BufKernel_t _dsc_buf_kernel = BUF_KERNEL_AUTO;
+
+static bool _dsc_buf_simd_width(const uint8_t tsize) {
+    return _dsc_buf_kernel != BUF_KERNEL_SCALAR
+        && (tsize == 1 || tsize == 2 || tsize == 4 || tsize == 8 || tsize == 16);
+}
+
+// Writes elem to every element by doubling the filled prefix; any element size works
+static void _dsc_buf_fill_scalar(uint8_t *base, const size_t bsize, const void* const elem, const uint8_t tsize) {
+    if (bsize < tsize) {
+        return;
+    }
+
+    memcpy(base, elem, tsize);
+    size_t filled = tsize;
+    while (filled < bsize) {
+        const size_t n = (filled < bsize - filled) ? filled : bsize - filled;
+        memcpy(base + filled, base, n);
+        filled += n;
+    }
+}
+
+static size_t _dsc_buf_find_scalar(
+    const uint8_t *base,
+    const size_t nelem,
+    const void* const elem,
+    const uint8_t tsize
+) {
+    for (size_t i = 0; i < nelem; ++i) {
+        if (memcmp(base + i * tsize, elem, tsize) == 0) {
+            return i;
+        }
+    }
+    return nelem;
+}
+
+static size_t _dsc_buf_count_scalar(
+    const uint8_t *base,
+    const size_t nelem,
+    const void* const elem,
+    const uint8_t tsize
+) {
+    size_t count = 0;
+    for (size_t i = 0; i < nelem; ++i) {
+        count += (memcmp(base + i * tsize, elem, tsize) == 0);
+    }
+    return count;
+}
+
+#if DSC_BUF_SIMD
+
+// Repeats elem across 32 bytes; tsize must divide 32
+static void _dsc_buf_pattern(uint8_t pattern[32], const void* const elem, const uint8_t tsize) {
+    for (size_t off = 0; off < 32; off += tsize) {
+        memcpy(pattern + off, elem, tsize);
+    }
+}
+
+/**
+ * Returns a byte mask of the lanes that equal the pattern. Comparing at the element's width
+ * (or 32 bits at a time and folding pairs for 64-bit elements, which SSE2 cannot compare
+ * directly) means that a matching element sets all of its bytes in the mask.
+ */
+static inline unsigned _dsc_buf_eq_sse2(const __m128i v, const __m128i pat, const uint8_t tsize) {
+    switch (tsize) {
+        case 1:
+            return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, pat));
+        case 2:
+            return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi16(v, pat));
+        case 4:
+            return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi32(v, pat));
+        case 8: {
+            const __m128i eq = _mm_cmpeq_epi32(v, pat);
+            return (unsigned)_mm_movemask_epi8(_mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1))));
+        }
+        default: {
+            const unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, pat));
+            return (mask == 0xFFFF) ? mask : 0;
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+static inline unsigned _dsc_buf_eq_avx2(const __m256i v, const __m256i pat, const uint8_t tsize) {
+    switch (tsize) {
+        case 1:
+            return (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, pat));
+        case 2:
+            return (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi16(v, pat));
+        case 4:
+            return (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi32(v, pat));
+        case 8:
+            return (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi64(v, pat));
+        default: {
+            const unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, pat));
+            return ((mask & 0xFFFFu) == 0xFFFFu ? 0xFFFFu : 0) | ((mask >> 16) == 0xFFFFu ? 0xFFFF0000u : 0);
+        }
+    }
+}
+
+static void _dsc_buf_fill_sse2(uint8_t *base, const size_t bsize, const void* const elem, const uint8_t tsize) {
+    uint8_t pattern[32];
+    size_t off = 0;
+
+    _dsc_buf_pattern(pattern, elem, tsize);
+    const __m128i pat = _mm_loadu_si128((const __m128i*)pattern);
+    for (; off + 16 <= bsize; off += 16) {
+        _mm_storeu_si128((__m128i*)(base + off), pat);
+    }
+    memcpy(base + off, pattern, bsize - off);
+}
+
+__attribute__((target("avx2")))
+static void _dsc_buf_fill_avx2(uint8_t *base, const size_t bsize, const void* const elem, const uint8_t tsize) {
+    uint8_t pattern[32];
+    size_t off = 0;
+
+    _dsc_buf_pattern(pattern, elem, tsize);
+    const __m256i pat = _mm256_loadu_si256((const __m256i*)pattern);
+    for (; off + 64 <= bsize; off += 64) {
+        _mm256_storeu_si256((__m256i*)(base + off), pat);
+        _mm256_storeu_si256((__m256i*)(base + off + 32), pat);
+    }
+    for (; off + 32 <= bsize; off += 32) {
+        _mm256_storeu_si256((__m256i*)(base + off), pat);
+    }
+    memcpy(base + off, pattern, bsize - off);
+}
+
+static size_t _dsc_buf_find_sse2(const uint8_t *base, const size_t nelem, const void* const elem, const uint8_t tsize) {
+    uint8_t pattern[32];
+    const size_t bsize = nelem * tsize;
+    size_t off = 0;
+
+    _dsc_buf_pattern(pattern, elem, tsize);
+    const __m128i pat = _mm_loadu_si128((const __m128i*)pattern);
+    for (; off + 16 <= bsize; off += 16) {
+        const unsigned mask = _dsc_buf_eq_sse2(_mm_loadu_si128((const __m128i*)(base + off)), pat, tsize);
+        if (mask != 0) {
+            return (off + (size_t)__builtin_ctz(mask)) / tsize;
+        }
+    }
+
+    const size_t idx = off / tsize;
+    return idx + _dsc_buf_find_scalar(base + off, nelem - idx, elem, tsize);
+}
+
+__attribute__((target("avx2")))
+static size_t _dsc_buf_find_avx2(const uint8_t *base, const size_t nelem, const void* const elem, const uint8_t tsize) {
+    uint8_t pattern[32];
+    const size_t bsize = nelem * tsize;
+    size_t off = 0;
+
+    _dsc_buf_pattern(pattern, elem, tsize);
+    const __m256i pat = _mm256_loadu_si256((const __m256i*)pattern);
+    for (; off + 32 <= bsize; off += 32) {
+        const unsigned mask = _dsc_buf_eq_avx2(_mm256_loadu_si256((const __m256i*)(base + off)), pat, tsize);
+        if (mask != 0) {
+            return (off + (size_t)__builtin_ctz(mask)) / tsize;
+        }
+    }
+
+    const size_t idx = off / tsize;
+    return idx + _dsc_buf_find_scalar(base + off, nelem - idx, elem, tsize);
+}
+
+static size_t _dsc_buf_count_sse2(const uint8_t *base, const size_t nelem, const void* const elem, const uint8_t tsize) {
+    uint8_t pattern[32];
+    const size_t bsize = nelem * tsize;
+    size_t off = 0;
+    size_t nbits = 0;
+
+    _dsc_buf_pattern(pattern, elem, tsize);
+    const __m128i pat = _mm_loadu_si128((const __m128i*)pattern);
+    for (; off + 16 <= bsize; off += 16) {
+        nbits += (size_t)__builtin_popcount(_dsc_buf_eq_sse2(_mm_loadu_si128((const __m128i*)(base + off)), pat, tsize));
+    }
+
+    const size_t idx = off / tsize;
+    return nbits / tsize + _dsc_buf_count_scalar(base + off, nelem - idx, elem, tsize);
+}
+
+__attribute__((target("avx2,popcnt")))
+static size_t _dsc_buf_count_avx2(const uint8_t *base, const size_t nelem, const void* const elem, const uint8_t tsize) {
+    uint8_t pattern[32];
+    const size_t bsize = nelem * tsize;
+    size_t off = 0;
+    size_t nbits = 0;
+
+    _dsc_buf_pattern(pattern, elem, tsize);
+    const __m256i pat = _mm256_loadu_si256((const __m256i*)pattern);
+    for (; off + 32 <= bsize; off += 32) {
+        nbits += (size_t)__builtin_popcount(_dsc_buf_eq_avx2(_mm256_loadu_si256((const __m256i*)(base + off)), pat, tsize));
+    }
+
+    const size_t idx = off / tsize;
+    return nbits / tsize + _dsc_buf_count_scalar(base + off, nelem - idx, elem, tsize);
+}
+
+static bool _dsc_buf_has_avx2(void) {
+    return _dsc_buf_kernel == BUF_KERNEL_AUTO
+        && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+}
+
+#endif // DSC_BUF_SIMD
+
+void _dsc_buf_set_kernel(const BufKernel_t kernel) {
+    _dsc_buf_kernel = kernel;
+}
 
 /*
  * ===============================
@@ -23,14 +345,199 @@
  * @returns DSC_EFAIL if buffer could not be initialized, otherwise returns DSC_EOK
  */
 DscError_t dsc_buf_init(Buffer_t *buf, const size_t nelem, const uint8_t tsize) {
+    return dsc_buf_init_alloc(buf, nelem, tsize, NULL);
+}
+
+/**
+ * @brief Initializes a general purpose buffer whose memory comes from a custom allocator.
+ * @since 19-10-2026
+ * @param[in/out] buf The Buffer_t object to be initialized
+ * @param[in] nelem The initial number of elements that the buffer shall contain
+ * @param[in] tsize The size (in bytes) of the datatype used for the buffer
+ * @param[in] alloc The allocator used for the lifetime of the buffer (NULL for malloc)
+ * @returns DSC_EFAIL if buffer could not be initialized, otherwise returns DSC_EOK
+ */
+DscError_t dsc_buf_init_alloc(
+    Buffer_t *buf,
+    const size_t nelem,
+    const uint8_t tsize,
+    const DscAllocator_t *alloc
+) {
     const size_t bsize = nelem * tsize;
-    buf->base = malloc(bsize);
+    buf->base = dsc_alloc(alloc, bsize);
     if (buf->base == NULL) {
         DSC_LOG("Failed to allocate memory for dsc buffer", DSC_ERROR);
         return DSC_EFAIL;
     }
     buf->bsize = bsize;
     buf->tsize = tsize;
+    buf->alloc = alloc;
+    buf->backing = BUF_HEAP;
+    buf->msize = 0;
+    buf->fd = -1;
+    buf->flags = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Initializes a buffer whose first DSC_BUF_SMALL bytes live inside the SmallBuffer_t, so
+ * that small buffers never touch the allocator. The buffer moves to the heap the first time it
+ * is resized beyond DSC_BUF_SMALL bytes; from then on sbuf->buf behaves like any heap buffer.
+ * While inline, sbuf->buf.base points into the struct itself, so the SmallBuffer_t must not be
+ * copied or moved by value; use dsc_buf_copy() instead.
+ * @since 19-10-2026
+ * @param[in/out] sbuf The SmallBuffer_t object to be initialized
+ * @param[in] nelem The initial number of elements that the buffer shall contain
+ * @param[in] tsize The size (in bytes) of the datatype used for the buffer
+ * @param[in] alloc The allocator used once the buffer spills to the heap (NULL for malloc)
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_buf_init_inline(
+    SmallBuffer_t *sbuf,
+    const size_t nelem,
+    const uint8_t tsize,
+    const DscAllocator_t *alloc
+) {
+    if (sbuf == NULL || tsize == 0) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (nelem * tsize > DSC_BUF_SMALL) {
+        return dsc_buf_init_alloc(&sbuf->buf, nelem, tsize, alloc);
+    }
+
+    Buffer_t *buf = &sbuf->buf;
+    buf->base = sbuf->small;
+    buf->bsize = nelem * tsize;
+    buf->tsize = tsize;
+    buf->alloc = alloc;
+    buf->backing = BUF_INLINE;
+    buf->msize = 0;
+    buf->fd = -1;
+    buf->flags = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Initializes a buffer backed by an anonymous memory mapping. Resizing such a
+ * buffer remaps its pages with mremap instead of copying them.
+ * @since 19-10-2026
+ * @param[in/out] buf The Buffer_t object to be initialized
+ * @param[in] nelem The initial number of elements that the buffer shall contain
+ * @param[in] tsize The size (in bytes) of the datatype used for the buffer
+ * @param[in] flags A combination of DSC_BUF_HUGEPAGE and DSC_BUF_POPULATE
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_buf_init_mmap(Buffer_t *buf, const size_t nelem, const uint8_t tsize, const unsigned flags) {
+    if (buf == NULL || tsize == 0) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    buf->tsize = tsize;
+    buf->backing = BUF_ANON;
+    return _dsc_buf_map(buf, nelem * tsize, -1, flags);
+}
+
+/**
+ * @brief Initializes a buffer backed by a shared mapping of the file at path. Writes to the
+ * buffer land in the file, so a later call can map the same contents without reading them.
+ * @since 19-10-2026
+ * @param[in/out] buf The Buffer_t object to be initialized
+ * @param[in] path The file to map; it is created if it does not exist
+ * @param[in] nelem The number of elements the file shall hold, or 0 to map the file at its current size
+ * @param[in] tsize The size (in bytes) of the datatype used for the buffer
+ * @param[in] flags A combination of DSC_BUF_HUGEPAGE and DSC_BUF_POPULATE
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_buf_map_file(
+    Buffer_t *buf,
+    const char *path,
+    const size_t nelem,
+    const uint8_t tsize,
+    const unsigned flags
+) {
+    struct stat st;
+
+    if (buf == NULL || path == NULL || tsize == 0) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        DSC_LOG("Failed to open the file backing dsc buffer", DSC_ERROR);
+        return DSC_EFAIL;
+    }
+
+    if (fstat(fd, &st) != 0) {
+        DSC_LOG("Failed to stat the file backing dsc buffer", DSC_ERROR);
+        close(fd);
+        return DSC_EFAIL;
+    }
+
+    const size_t bsize = (nelem != 0) ? nelem * tsize : ((size_t)st.st_size / tsize) * tsize;
+    if ((size_t)st.st_size != bsize && ftruncate(fd, (off_t)bsize) != 0) {
+        DSC_LOG("Failed to resize the file backing dsc buffer", DSC_ERROR);
+        close(fd);
+        return DSC_EFAIL;
+    }
+
+    buf->tsize = tsize;
+    buf->backing = BUF_FILE;
+    DscError_t status = _dsc_buf_map(buf, bsize, fd, flags);
+    if (status != DSC_EOK) {
+        close(fd);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Flushes a file-backed buffer to disk. Other buffers are left untouched.
+ * @since 19-10-2026
+ * @param[in] buf A pointer to the buffer being flushed
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_buf_sync(const Buffer_t* const buf) {
+    if (buf == NULL || buf->base == NULL) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    if (buf->backing == BUF_FILE && msync(buf->base, buf->msize, MS_SYNC) != 0) {
+        DSC_LOG("Failed to flush the file backing dsc buffer", DSC_ERROR);
+        return DSC_EFAIL;
+    }
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Frees the buffer's memory region.
+ * @since 19-10-2026
+ * @param[in] buf A pointer to the buffer being destroyed
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_buf_destroy(Buffer_t *buf) {
+    if (buf == NULL) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    if (buf->backing == BUF_HEAP) {
+        dsc_free(buf->alloc, buf->base, buf->bsize);
+    } else if (buf->backing != BUF_INLINE && buf->base != NULL) {
+        munmap(buf->base, buf->msize);
+        if (buf->backing == BUF_FILE) {
+            close(buf->fd);
+        }
+        buf->msize = 0;
+        buf->fd = -1;
+    }
+    buf->base = NULL;
+    buf->bsize = 0;
 
     return DSC_EOK;
 }
@@ -44,12 +551,21 @@ DscError_t dsc_buf_init(Buffer_t *buf, const size_t nelem, const uint8_t tsize)
  */
 DscError_t dsc_buf_resize(Buffer_t *buf, const size_t nelem) {
     const size_t bsize = nelem * buf->tsize;
-    buf->base = realloc(buf->base, bsize);
-    if (buf->base == NULL) {
+    if (buf->backing == BUF_INLINE) {
+        return _dsc_buf_spill(buf, bsize);
+    } else if (buf->backing != BUF_HEAP) {
+        return _dsc_buf_remap(buf, bsize);
+    }
+
+    // On failure the buffer keeps its old region, which the caller still has to destroy
+    void *base = dsc_realloc(buf->alloc, buf->base, buf->bsize, bsize);
+    if (base == NULL && bsize != 0) {
         DSC_LOG("Failed to allocate memory for dsc buffer", DSC_ERROR);
         return DSC_EFAIL;
     }
+    buf->base = base;
     buf->bsize = bsize;
+    DSC_STATS_ADD(buf->alloc, resizes, 1);
 
     return DSC_EOK;
 }
@@ -72,16 +588,128 @@ DscError_t dsc_buf_fill(Buffer_t *buf, const uint8_t byte) {
 }
 
 /**
- * @brief Returns the number of elements that the buffer can fit.
- * @since 04/06/2022
- * @param[in] buf The buffer whos capacity is being checked
- * @returns The capacity of the buffer or DSC_EFAIL upon failure
+ * @brief Writes the element pointed to by elem to every element of the buffer.
+ * @since 19-10-2026
+ * @param[in] buf A pointer to the buffer being filled
+ * @param[in] elem A pointer to an element of buf->tsize bytes
+ * @returns A DscError_t object containing the exit status code
  */
-size_t dsc_buf_nelem(const Buffer_t* const buf) {
-    if (buf->base == NULL) {
-        DSC_LOG("The buffer points to an invalid baseess", DSC_ERROR);
-        return DSC_EFAIL;
+DscError_t dsc_buf_fill_elem(Buffer_t *buf, const void* const elem) {
+    if (buf == NULL || buf->base == NULL || elem == NULL || buf->tsize == 0) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EFAULT;
+    }
+
+#if DSC_BUF_SIMD
+    if (_dsc_buf_simd_width(buf->tsize)) {
+        if (_dsc_buf_has_avx2()) {
+            _dsc_buf_fill_avx2(buf->base, buf->bsize, elem, buf->tsize);
+        } else {
+            _dsc_buf_fill_sse2(buf->base, buf->bsize, elem, buf->tsize);
+        }
+        return DSC_EOK;
+    }
+#endif // DSC_BUF_SIMD
+
+    _dsc_buf_fill_scalar(buf->base, buf->bsize, elem, buf->tsize);
+    return DSC_EOK;
+}
+
+/**
+ * @brief Copies the contents of src into dst, resizing dst to the same number of elements.
+ * @since 19-10-2026
+ * @param[in] dst A pointer to the destination buffer
+ * @param[in] src A pointer to the source buffer
+ * @returns DSC_EINVAL if the buffers hold different types, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_buf_copy(Buffer_t *dst, const Buffer_t* const src) {
+    if (dst == NULL || src == NULL || dst->base == NULL || src->base == NULL) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EFAULT;
+    }
+
+    if (dst->tsize != src->tsize) {
+        DSC_LOG("Cannot copy between buffers of different types", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    if (dst->bsize != src->bsize) {
+        DscError_t status = dsc_buf_resize(dst, dsc_buf_nelem(src));
+        if (status != DSC_EOK) {
+            return status;
+        }
+    }
+
+    memmove(dst->base, src->base, src->bsize);
+    return DSC_EOK;
+}
+
+/**
+ * @brief Compares two buffers byte-wise, like memcmp; a prefix orders before the longer buffer.
+ * @since 19-10-2026
+ * @param[in] lhs A pointer to the first buffer
+ * @param[in] rhs A pointer to the second buffer
+ * @returns A negative value, zero or a positive value if lhs orders before, equal to or after rhs
+ */
+int dsc_buf_compare(const Buffer_t* const lhs, const Buffer_t* const rhs) {
+    const size_t n = (lhs->bsize < rhs->bsize) ? lhs->bsize : rhs->bsize;
+    const int cmp = (n != 0) ? memcmp(lhs->base, rhs->base, n) : 0;
+
+    if (cmp != 0) {
+        return cmp;
+    }
+    return (lhs->bsize > rhs->bsize) - (lhs->bsize < rhs->bsize);
+}
+
+/**
+ * @brief Returns the index of the first element equal to elem.
+ * @since 19-10-2026
+ * @param[in] buf A pointer to the buffer being searched
+ * @param[in] elem A pointer to an element of buf->tsize bytes
+ * @returns The index of the match, or the buffer's element count if there is none (0 if the
+ *          buffer is invalid)
+ */
+size_t dsc_buf_find(const Buffer_t* const buf, const void* const elem) {
+    if (buf == NULL || buf->base == NULL || elem == NULL || buf->tsize == 0) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return 0;
+    }
+
+    const size_t nelem = buf->bsize / buf->tsize;
+
+#if DSC_BUF_SIMD
+    if (_dsc_buf_simd_width(buf->tsize)) {
+        return _dsc_buf_has_avx2()
+            ? _dsc_buf_find_avx2(buf->base, nelem, elem, buf->tsize)
+            : _dsc_buf_find_sse2(buf->base, nelem, elem, buf->tsize);
+    }
+#endif // DSC_BUF_SIMD
+
+    return _dsc_buf_find_scalar(buf->base, nelem, elem, buf->tsize);
+}
+
+/**
+ * @brief Counts the elements equal to elem.
+ * @since 19-10-2026
+ * @param[in] buf A pointer to the buffer being searched
+ * @param[in] elem A pointer to an element of buf->tsize bytes
+ * @returns The number of matching elements (0 if the buffer is invalid)
+ */
+size_t dsc_buf_count(const Buffer_t* const buf, const void* const elem) {
+    if (buf == NULL || buf->base == NULL || elem == NULL || buf->tsize == 0) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return 0;
+    }
+
+    const size_t nelem = buf->bsize / buf->tsize;
+
+#if DSC_BUF_SIMD
+    if (_dsc_buf_simd_width(buf->tsize)) {
+        return _dsc_buf_has_avx2()
+            ? _dsc_buf_count_avx2(buf->base, nelem, elem, buf->tsize)
+            : _dsc_buf_count_sse2(buf->base, nelem, elem, buf->tsize);
     }
+#endif // DSC_BUF_SIMD
 
-    return (buf->bsize / buf->tsize);
+    return _dsc_buf_count_scalar(buf->base, nelem, elem, buf->tsize);
 }
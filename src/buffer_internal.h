@@ -0,0 +1,21 @@
+#ifndef BUFFER_INTERNAL_H
+#define BUFFER_INTERNAL_H
+
+#include "buffer.h"
+
+/*
+ * Library-internal declarations for buffer.c. Nothing here is part of the public API or
+ * installed with it.
+ */
+
+// Most capable element kernels dsc_buf_fill_elem(), dsc_buf_find() and dsc_buf_count() may use
+typedef enum {
+    BUF_KERNEL_AUTO,  // AVX2 when the CPU has it, else SSE2 (the default)
+    BUF_KERNEL_SSE2,  // SSE2 even on CPUs with AVX2
+    BUF_KERNEL_SCALAR // The portable loops only
+} BufKernel_t;
+
+// Caps the element kernels so that tests reach every path on any CPU; not thread-safe
+void _dsc_buf_set_kernel(const BufKernel_t kernel);
+
+#endif // BUFFER_INTERNAL_H
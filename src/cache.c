@@ -0,0 +1,492 @@
+/**
+ * @file cache.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a bounded cache with LRU, CLOCK and TinyLFU policies over a slab of entries.
+*/
+
+#include "cache.h"
+#include "hash.h"
+
+#define DSC_CACHE_ALIGN        8
+#define DSC_CACHE_SKETCH_DEPTH 4
+#define DSC_CACHE_SKETCH_WIDTH 4  // Sketch counters per table slot, i.e. at least 8 per entry
+#define DSC_CACHE_SKETCH_MAX   15 // Counters saturate here, so four bits per counter would do
+#define DSC_CACHE_SKETCH_AGE   10 // The sketch is aged after this many increments per entry
+
+// Header at the start of each slab entry; the key follows it and the value follows the key
+typedef struct {
+    uint32_t prev; // Next more recently used entry, or DSC_CACHE_NIL
+    uint32_t next; // Next less recently used entry (or next unused one), or DSC_CACHE_NIL
+    uint32_t hash; // fnv1a_hash() of the key
+    uint8_t  ref;  // Referenced since the clock hand last passed (CACHE_CLOCK)
+} CacheEntry_t;
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static inline size_t _dsc_cache_align(const size_t n) {
+    return (n + (DSC_CACHE_ALIGN - 1)) & ~((size_t)DSC_CACHE_ALIGN - 1);
+}
+
+static inline CacheEntry_t *_dsc_cache_entry(const Cache_t* const cache, const uint32_t i) {
+    return (CacheEntry_t*)((uint8_t*)cache->slab.base + (size_t)i * cache->stride);
+}
+
+static inline uint8_t *_dsc_cache_key(const CacheEntry_t* const entry) {
+    return (uint8_t*)entry + sizeof(CacheEntry_t);
+}
+
+static inline uint8_t *_dsc_cache_value(const Cache_t* const cache, const CacheEntry_t* const entry) {
+    return (uint8_t*)entry + cache->voff;
+}
+
+static inline uint32_t *_dsc_cache_table(const Cache_t* const cache) {
+    return cache->index.base;
+}
+
+static inline size_t _dsc_cache_mask(const Cache_t* const cache) {
+    return cache->index.bsize / sizeof(uint32_t) - 1;
+}
+
+/**
+ * Returns the table slot that refers to key, or the empty slot that ends its probe sequence.
+ * The table is at most half full, so a probe always reaches an empty slot.
+ */
+static size_t _dsc_cache_probe(const Cache_t* const cache, const void* const key, const uint32_t hash) {
+    const uint32_t *table = _dsc_cache_table(cache);
+    const size_t mask = _dsc_cache_mask(cache);
+    size_t pos = hash & mask;
+    size_t n = 1;
+
+    for (; table[pos] != 0; pos = (pos + 1) & mask, ++n) {
+        const CacheEntry_t *entry = _dsc_cache_entry(cache, table[pos] - 1);
+        if (entry->hash == hash && memcmp(_dsc_cache_key(entry), key, cache->ksize) == 0) {
+            break;
+        }
+    }
+    DSC_STATS_ADD(cache->slab.alloc, lookups, 1);
+    DSC_STATS_ADD(cache->slab.alloc, probes, n);
+
+    return pos;
+}
+
+/**
+ * Empties a table slot by shifting later members of its probe run back into the gap, which
+ * keeps every run contiguous without leaving tombstones behind.
+ */
+static void _dsc_cache_erase(Cache_t *cache, size_t pos) {
+    uint32_t *table = _dsc_cache_table(cache);
+    const size_t mask = _dsc_cache_mask(cache);
+
+    for (size_t next = (pos + 1) & mask; table[next] != 0; next = (next + 1) & mask) {
+        const size_t home = _dsc_cache_entry(cache, table[next] - 1)->hash & mask;
+        // The entry at next may only move back if its home slot does not lie in (pos, next]
+        if (((next - home) & mask) >= ((next - pos) & mask)) {
+            table[pos] = table[next];
+            pos = next;
+        }
+    }
+    table[pos] = 0;
+}
+
+static void _dsc_cache_unlink(Cache_t *cache, const uint32_t i) {
+    CacheEntry_t *entry = _dsc_cache_entry(cache, i);
+
+    if (entry->prev != DSC_CACHE_NIL) {
+        _dsc_cache_entry(cache, entry->prev)->next = entry->next;
+    } else {
+        cache->head = entry->next;
+    }
+    if (entry->next != DSC_CACHE_NIL) {
+        _dsc_cache_entry(cache, entry->next)->prev = entry->prev;
+    } else {
+        cache->tail = entry->prev;
+    }
+}
+
+static void _dsc_cache_push_front(Cache_t *cache, const uint32_t i) {
+    CacheEntry_t *entry = _dsc_cache_entry(cache, i);
+
+    entry->prev = DSC_CACHE_NIL;
+    entry->next = cache->head;
+    if (cache->head != DSC_CACHE_NIL) {
+        _dsc_cache_entry(cache, cache->head)->prev = i;
+    } else {
+        cache->tail = i;
+    }
+    cache->head = i;
+}
+
+// Records a use of an entry that is already cached
+static void _dsc_cache_touch(Cache_t *cache, const uint32_t i) {
+    if (cache->policy == CACHE_CLOCK) {
+        _dsc_cache_entry(cache, i)->ref = 1;
+    } else if (cache->head != i) {
+        _dsc_cache_unlink(cache, i);
+        _dsc_cache_push_front(cache, i);
+    }
+}
+
+// Picks the entry to drop for a new key; the cache must be full
+static uint32_t _dsc_cache_victim(Cache_t *cache) {
+    if (cache->policy != CACHE_CLOCK) {
+        return cache->tail;
+    }
+
+    // Give each referenced entry a second chance; this ends within one revolution
+    for (;;) {
+        CacheEntry_t *entry = _dsc_cache_entry(cache, cache->hand);
+        const uint32_t i = cache->hand;
+        cache->hand = (cache->hand + 1 < cache->capacity) ? cache->hand + 1 : 0;
+        if (!entry->ref) {
+            return i;
+        }
+        entry->ref = 0;
+    }
+}
+
+/**
+ * Finds the sketch counters of hash. The key's hash is remixed into two independent halves and
+ * row r uses h1 + r * h2, so two keys sharing one counter rarely share the others.
+ */
+static void _dsc_cache_sketch_pos(const Cache_t* const cache, const uint32_t hash, size_t pos[DSC_CACHE_SKETCH_DEPTH]) {
+    uint64_t z = (uint64_t)hash * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+
+    const size_t h1 = (size_t)(uint32_t)z;
+    const size_t h2 = (size_t)(z >> 32) | 1;
+    for (size_t row = 0; row < DSC_CACHE_SKETCH_DEPTH; ++row) {
+        pos[row] = (h1 + row * h2) & (cache->sketch.bsize - 1);
+    }
+}
+
+static uint8_t _dsc_cache_estimate(const Cache_t* const cache, const size_t pos[DSC_CACHE_SKETCH_DEPTH]) {
+    const uint8_t *counters = cache->sketch.base;
+    uint8_t freq = DSC_CACHE_SKETCH_MAX;
+
+    for (size_t row = 0; row < DSC_CACHE_SKETCH_DEPTH; ++row) {
+        freq = (counters[pos[row]] < freq) ? counters[pos[row]] : freq;
+    }
+
+    return freq;
+}
+
+// Estimates how often the key with hash was used recently
+static uint8_t _dsc_cache_frequency(const Cache_t* const cache, const uint32_t hash) {
+    size_t pos[DSC_CACHE_SKETCH_DEPTH];
+
+    _dsc_cache_sketch_pos(cache, hash, pos);
+    return _dsc_cache_estimate(cache, pos);
+}
+
+/**
+ * Counts one use of hash in the count-min sketch. Only the counters holding the current estimate
+ * are raised (a conservative update), which keeps keys that share counters with popular ones from
+ * inheriting their counts. Once the sketch has taken a fixed number of increments per entry every
+ * counter is halved, so that keys which were popular long ago lose their advantage over keys that
+ * are popular now.
+ */
+static void _dsc_cache_record(Cache_t *cache, const uint32_t hash) {
+    uint8_t *counters = cache->sketch.base;
+    size_t pos[DSC_CACHE_SKETCH_DEPTH];
+
+    _dsc_cache_sketch_pos(cache, hash, pos);
+    const uint8_t freq = _dsc_cache_estimate(cache, pos);
+    if (freq < DSC_CACHE_SKETCH_MAX) {
+        for (size_t row = 0; row < DSC_CACHE_SKETCH_DEPTH; ++row) {
+            if (counters[pos[row]] == freq) {
+                ++counters[pos[row]];
+            }
+        }
+    }
+
+    if (++cache->samples >= cache->capacity * DSC_CACHE_SKETCH_AGE) {
+        for (size_t i = 0; i < cache->sketch.bsize; ++i) {
+            counters[i] >>= 1;
+        }
+        cache->samples /= 2;
+    }
+}
+
+// Drops entry i, which must be cached, and returns it to the unused list
+static void _dsc_cache_drop(Cache_t *cache, const uint32_t i) {
+    CacheEntry_t *entry = _dsc_cache_entry(cache, i);
+
+    _dsc_cache_erase(cache, _dsc_cache_probe(cache, _dsc_cache_key(entry), entry->hash));
+    if (cache->policy != CACHE_CLOCK) {
+        _dsc_cache_unlink(cache, i);
+    }
+    entry->next = cache->free;
+    cache->free = i;
+    --cache->count;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Initializes an empty cache.
+ * @since 19-10-2026
+ * @param[out] cache The cache
+ * @param[in] capacity The maximum number of entries
+ * @param[in] ksize The size of each key in bytes
+ * @param[in] vsize The size of each value in bytes
+ * @param[in] policy Which entry to evict once the cache is full
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_cache_init(
+    Cache_t *cache,
+    const size_t capacity,
+    const size_t ksize,
+    const size_t vsize,
+    const CachePolicy_t policy
+) {
+    return dsc_cache_init_alloc(cache, capacity, ksize, vsize, policy, NULL);
+}
+
+/**
+ * @brief Initializes an empty cache whose slab, table and sketch come from alloc.
+ * @since 19-10-2026
+ * @param[out] cache The cache
+ * @param[in] capacity The maximum number of entries
+ * @param[in] ksize The size of each key in bytes
+ * @param[in] vsize The size of each value in bytes
+ * @param[in] policy Which entry to evict once the cache is full
+ * @param[in] alloc The allocator (NULL for malloc)
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_cache_init_alloc(
+    Cache_t *cache,
+    const size_t capacity,
+    const size_t ksize,
+    const size_t vsize,
+    const CachePolicy_t policy,
+    const DscAllocator_t *alloc
+) {
+    if (cache == NULL || capacity == 0 || capacity >= DSC_CACHE_NIL || ksize == 0) {
+        DSC_LOG("The cache points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    memset(cache, 0, sizeof(Cache_t));
+    cache->capacity = capacity;
+    cache->ksize = ksize;
+    cache->vsize = vsize;
+    cache->voff = _dsc_cache_align(sizeof(CacheEntry_t) + ksize);
+    cache->stride = _dsc_cache_align(cache->voff + vsize);
+    cache->head = DSC_CACHE_NIL;
+    cache->tail = DSC_CACHE_NIL;
+    cache->policy = policy;
+
+    // Keep the table at most half full so that probe runs stay short
+    size_t nslots = 16;
+    while (nslots < capacity * 2) {
+        nslots <<= 1;
+    }
+
+    if (dsc_buf_init_alloc(&cache->slab, capacity * cache->stride, sizeof(uint8_t), alloc) != DSC_EOK) {
+        return DSC_ENOMEM;
+    }
+    if (dsc_buf_init_alloc(&cache->index, nslots, sizeof(uint32_t), alloc) != DSC_EOK) {
+        dsc_buf_destroy(&cache->slab);
+        return DSC_ENOMEM;
+    }
+    dsc_buf_fill(&cache->index, 0);
+    if (policy == CACHE_TINYLFU) {
+        if (dsc_buf_init_alloc(&cache->sketch, nslots * DSC_CACHE_SKETCH_WIDTH, sizeof(uint8_t), alloc) != DSC_EOK) {
+            dsc_buf_destroy(&cache->index);
+            dsc_buf_destroy(&cache->slab);
+            return DSC_ENOMEM;
+        }
+        dsc_buf_fill(&cache->sketch, 0);
+    }
+
+    for (size_t i = 0; i < capacity; ++i) {
+        _dsc_cache_entry(cache, (uint32_t)i)->next = (i + 1 < capacity) ? (uint32_t)(i + 1) : DSC_CACHE_NIL;
+    }
+    cache->free = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Frees the cache's storage, passing every remaining entry to the eviction callback first.
+ * @since 19-10-2026
+ * @param[in] cache The cache
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_cache_destroy(Cache_t *cache) {
+    if (cache == NULL || cache->slab.base == NULL) {
+        DSC_LOG("The cache points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    if (cache->on_evict != NULL) {
+        const uint32_t *table = _dsc_cache_table(cache);
+        for (size_t pos = 0; pos <= _dsc_cache_mask(cache); ++pos) {
+            if (table[pos] != 0) {
+                CacheEntry_t *entry = _dsc_cache_entry(cache, table[pos] - 1);
+                cache->on_evict(_dsc_cache_key(entry), _dsc_cache_value(cache, entry), cache->evict_ctx);
+            }
+        }
+    }
+
+    dsc_buf_destroy(&cache->slab);
+    dsc_buf_destroy(&cache->index);
+    if (cache->sketch.base != NULL) {
+        dsc_buf_destroy(&cache->sketch);
+    }
+    cache->count = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Installs a function that is called with each entry the cache drops on its own, i.e.
+ * when it is evicted to make room and when the cache is destroyed, so that values owning
+ * resources can release them. Entries removed with dsc_cache_remove() are not passed to it.
+ * @since 19-10-2026
+ * @param[in] cache The cache
+ * @param[in] func The callback, or NULL to remove it
+ * @param[in] ctx Passed as the last argument to func
+ */
+void dsc_cache_on_evict(Cache_t *cache, cache_evict_func func, void *ctx) {
+    cache->on_evict = func;
+    cache->evict_ctx = ctx;
+}
+
+/**
+ * @brief Looks a key up and, on a hit, marks its entry as recently used. O(1).
+ * @since 19-10-2026
+ * @param[in] cache The cache
+ * @param[in] key A pointer to the key
+ * @returns A pointer to the cached value, valid until the next dsc_cache_put() or
+ *          dsc_cache_remove(), or NULL on a miss
+ */
+void *dsc_cache_get(Cache_t *cache, const void* const key) {
+    if (cache == NULL || cache->slab.base == NULL || key == NULL) {
+        DSC_LOG("The cache points to an invalid address", DSC_ERROR);
+        return NULL;
+    }
+
+    const uint32_t hash = fnv1a_hash(key, cache->ksize);
+    if (cache->policy == CACHE_TINYLFU) {
+        _dsc_cache_record(cache, hash);
+    }
+
+    const uint32_t slot = _dsc_cache_table(cache)[_dsc_cache_probe(cache, key, hash)];
+    if (slot == 0) {
+        ++cache->stats.misses;
+        return NULL;
+    }
+
+    ++cache->stats.hits;
+    _dsc_cache_touch(cache, slot - 1);
+
+    return _dsc_cache_value(cache, _dsc_cache_entry(cache, slot - 1));
+}
+
+/**
+ * @brief Copies a key/value pair into the cache, overwriting the value if the key is already
+ * cached. A full cache evicts an entry first; under CACHE_TINYLFU a new key that is used no more
+ * often than the would-be victim is not admitted, which is counted in stats.rejections. O(1).
+ * @since 19-10-2026
+ * @param[in] cache The cache
+ * @param[in] key A pointer to the key
+ * @param[in] value A pointer to the value (may be NULL to leave it zeroed)
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_cache_put(Cache_t *cache, const void* const key, const void* const value) {
+    if (cache == NULL || cache->slab.base == NULL || key == NULL) {
+        DSC_LOG("The cache points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const uint32_t hash = fnv1a_hash(key, cache->ksize);
+    if (cache->policy == CACHE_TINYLFU) {
+        _dsc_cache_record(cache, hash);
+    }
+
+    size_t pos = _dsc_cache_probe(cache, key, hash);
+    uint32_t *table = _dsc_cache_table(cache);
+    if (table[pos] != 0) {
+        CacheEntry_t *entry = _dsc_cache_entry(cache, table[pos] - 1);
+        if (value != NULL) {
+            memcpy(_dsc_cache_value(cache, entry), value, cache->vsize);
+        }
+        _dsc_cache_touch(cache, table[pos] - 1);
+        return DSC_EOK;
+    }
+
+    if (cache->count == cache->capacity) {
+        const uint32_t victim = _dsc_cache_victim(cache);
+        CacheEntry_t *entry = _dsc_cache_entry(cache, victim);
+        if (cache->policy == CACHE_TINYLFU
+            && _dsc_cache_frequency(cache, hash) <= _dsc_cache_frequency(cache, entry->hash)
+        ) {
+            ++cache->stats.rejections;
+            return DSC_EOK;
+        }
+
+        if (cache->on_evict != NULL) {
+            cache->on_evict(_dsc_cache_key(entry), _dsc_cache_value(cache, entry), cache->evict_ctx);
+        }
+        _dsc_cache_drop(cache, victim);
+        ++cache->stats.evictions;
+        // Erasing the victim may have shifted the new key's probe run
+        pos = _dsc_cache_probe(cache, key, hash);
+    }
+
+    const uint32_t i = cache->free;
+    CacheEntry_t *entry = _dsc_cache_entry(cache, i);
+    cache->free = entry->next;
+
+    entry->hash = hash;
+    entry->ref = 0;
+    memcpy(_dsc_cache_key(entry), key, cache->ksize);
+    if (value != NULL) {
+        memcpy(_dsc_cache_value(cache, entry), value, cache->vsize);
+    } else {
+        memset(_dsc_cache_value(cache, entry), 0, cache->vsize);
+    }
+    if (cache->policy != CACHE_CLOCK) {
+        _dsc_cache_push_front(cache, i);
+    }
+    table[pos] = i + 1;
+    ++cache->count;
+    ++cache->stats.inserts;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Removes a key from the cache. O(1).
+ * @since 19-10-2026
+ * @param[in] cache The cache
+ * @param[in] key A pointer to the key
+ * @returns DSC_ENODATA if the key is not cached, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_cache_remove(Cache_t *cache, const void* const key) {
+    if (cache == NULL || cache->slab.base == NULL || key == NULL) {
+        DSC_LOG("The cache points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const uint32_t slot = _dsc_cache_table(cache)[_dsc_cache_probe(cache, key, fnv1a_hash(key, cache->ksize))];
+    if (slot == 0) {
+        return DSC_ENODATA;
+    }
+    _dsc_cache_drop(cache, slot - 1);
+
+    return DSC_EOK;
+}
@@ -0,0 +1,278 @@
+/**
+ * @file chmap.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a hash map that may be shared between threads. Keys are striped over
+ * independently locked segments, so readers only contend with writers of the same segment.
+*/
+
+#include "chmap.h"
+#include "hmap.h"
+#include "hash.h"
+
+#define DSC_CHMAP_DEFAULT_SEGS 64
+#define DSC_CHMAP_MAX_SEGS     65536
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+/**
+ * Selects the segment for key. The hash is remixed so that the bits choosing the segment are
+ * independent of the low bits that choose a slot within the segment's Map_t.
+ */
+static CMapSegment_t *_dsc_chmap_segment(const CMap_t* const map, const void* const key) {
+    const size_t klen = (map->ksize != 0) ? map->ksize : strlen((const char*)key) + 1;
+    const uint32_t mixed = fnv1a_hash(key, klen) * 0x9E3779B1u;
+    return &map->segs[((uint64_t)mixed * map->nsegs) >> 32];
+}
+
+static bool _dsc_chmap_valid(const CMap_t* const map, const void* const key) {
+    if (map == NULL || map->segs == NULL || key == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return false;
+    }
+    return true;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Initializes a concurrent hash map.
+ * @since 19-10-2026
+ * @param[in/out] map The CMap_t object to be initialized
+ * @param[in] nsegs The number of independently locked segments (rounded up to a power of two),
+ *            or 0 for a default of 64. A few segments per thread keeps writers from colliding.
+ * @param[in] ksize The size (in bytes) of each key, or 0 if keys are NUL-terminated strings
+ * @param[in] vsize The size (in bytes) of each value
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_chmap_init(CMap_t *map, const size_t nsegs, const size_t ksize, const size_t vsize) {
+    return dsc_chmap_init_alloc(map, nsegs, ksize, vsize, NULL);
+}
+
+/**
+ * @brief Initializes a concurrent hash map whose segments and entries come from a custom
+ * allocator. The allocator is called from every thread that writes to the map, so it must be
+ * thread-safe, and it must not carry stats since DscStats_t counters are not atomic.
+ * @since 19-10-2026
+ * @param[in/out] map The CMap_t object to be initialized
+ * @param[in] nsegs The number of independently locked segments, or 0 for the default
+ * @param[in] ksize The size (in bytes) of each key, or 0 if keys are NUL-terminated strings
+ * @param[in] vsize The size (in bytes) of each value
+ * @param[in] alloc The allocator used for the lifetime of the map (NULL for malloc)
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_chmap_init_alloc(
+    CMap_t *map,
+    const size_t nsegs,
+    const size_t ksize,
+    const size_t vsize,
+    const DscAllocator_t *alloc
+) {
+    if (map == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (alloc != NULL && alloc->stats != NULL) {
+        DSC_LOG("Allocator stats cannot be shared between threads", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    size_t n = 1;
+    while (n < ((nsegs != 0) ? nsegs : DSC_CHMAP_DEFAULT_SEGS) && n < DSC_CHMAP_MAX_SEGS) {
+        n <<= 1;
+    }
+
+    const size_t size = n * sizeof(CMapSegment_t) + DSC_CACHELINE;
+    map->raw = dsc_alloc(alloc, size);
+    if (map->raw == NULL) {
+        DSC_LOG("Failed to allocate memory for dsc concurrent hash map", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+    map->segs = (CMapSegment_t*)(((uintptr_t)map->raw + DSC_CACHELINE - 1) & ~(uintptr_t)(DSC_CACHELINE - 1));
+    map->nsegs = n;
+    map->ksize = ksize;
+    map->vsize = vsize;
+    map->alloc = alloc;
+
+    for (size_t i = 0; i < n; ++i) {
+        DscError_t status = dsc_hmap_init_alloc(&map->segs[i].map, 0, ksize, vsize, alloc);
+        if (status != DSC_EOK || pthread_rwlock_init(&map->segs[i].lock, NULL) != 0) {
+            if (status == DSC_EOK) {
+                dsc_hmap_destroy(&map->segs[i].map);
+            }
+            for (size_t j = 0; j < i; ++j) {
+                pthread_rwlock_destroy(&map->segs[j].lock);
+                dsc_hmap_destroy(&map->segs[j].map);
+            }
+            dsc_free(alloc, map->raw, size);
+            map->segs = NULL;
+            return DSC_ENOMEM;
+        }
+    }
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Frees every segment of the map. No other thread may be using the map.
+ * @since 19-10-2026
+ * @param[in] map The map being destroyed
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_chmap_destroy(CMap_t *map) {
+    if (map == NULL || map->segs == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    for (size_t i = 0; i < map->nsegs; ++i) {
+        pthread_rwlock_destroy(&map->segs[i].lock);
+        dsc_hmap_destroy(&map->segs[i].map);
+    }
+    dsc_free(map->alloc, map->raw, map->nsegs * sizeof(CMapSegment_t) + DSC_CACHELINE);
+
+    map->segs = NULL;
+    map->raw = NULL;
+    map->nsegs = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Copies a new key/value pair into the map.
+ * @since 19-10-2026
+ * @param[in] map The map the entry is added to
+ * @param[in] key A pointer to the key
+ * @param[in] value A pointer to the value
+ * @returns DSC_EINVAL if the key is already present, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_chmap_add_entry(CMap_t *map, const void* const key, const void* const value) {
+    if (!_dsc_chmap_valid(map, key)) {
+        return DSC_EINVAL;
+    }
+
+    CMapSegment_t *seg = _dsc_chmap_segment(map, key);
+    pthread_rwlock_wrlock(&seg->lock);
+    DscError_t status = dsc_hmap_add_entry(&seg->map, key, value);
+    pthread_rwlock_unlock(&seg->lock);
+
+    return status;
+}
+
+/**
+ * @brief Overwrites the value of an existing entry.
+ * @since 19-10-2026
+ * @param[in] map The map containing the entry
+ * @param[in] key A pointer to the key
+ * @param[in] value A pointer to the new value
+ * @returns DSC_ENODATA if the key is not present, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_chmap_replace_entry(CMap_t *map, const void* const key, const void* const value) {
+    if (!_dsc_chmap_valid(map, key)) {
+        return DSC_EINVAL;
+    }
+
+    CMapSegment_t *seg = _dsc_chmap_segment(map, key);
+    pthread_rwlock_wrlock(&seg->lock);
+    DscError_t status = dsc_hmap_replace_entry(&seg->map, key, value);
+    pthread_rwlock_unlock(&seg->lock);
+
+    return status;
+}
+
+/**
+ * @brief Removes an entry from the map.
+ * @since 19-10-2026
+ * @param[in] map The map containing the entry
+ * @param[in] key A pointer to the key
+ * @returns DSC_ENODATA if the key is not present, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_chmap_remove_entry(CMap_t *map, const void* const key) {
+    if (!_dsc_chmap_valid(map, key)) {
+        return DSC_EINVAL;
+    }
+
+    CMapSegment_t *seg = _dsc_chmap_segment(map, key);
+    pthread_rwlock_wrlock(&seg->lock);
+    DscError_t status = dsc_hmap_remove_entry(&seg->map, key);
+    pthread_rwlock_unlock(&seg->lock);
+
+    return status;
+}
+
+/**
+ * @brief Copies the value associated with key. Unlike dsc_hmap_retrieve_value(), the value is
+ * copied out because another thread may replace or remove the entry once the lock is released.
+ * @since 19-10-2026
+ * @param[in] map The map being searched
+ * @param[in] key A pointer to the key
+ * @param[out] value Receives vsize bytes of the value
+ * @returns DSC_ENODATA if the key is not present, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_chmap_retrieve_value(CMap_t *map, const void* const key, void *value) {
+    if (!_dsc_chmap_valid(map, key) || value == NULL) {
+        return DSC_EINVAL;
+    }
+
+    CMapSegment_t *seg = _dsc_chmap_segment(map, key);
+    pthread_rwlock_rdlock(&seg->lock);
+    Buffer_t buf = dsc_hmap_retrieve_value(&seg->map, key);
+    if (buf.base != NULL) {
+        memcpy(value, buf.base, map->vsize);
+    }
+    pthread_rwlock_unlock(&seg->lock);
+
+    return (buf.base != NULL) ? DSC_EOK : DSC_ENODATA;
+}
+
+/**
+ * @brief Checks whether the map contains key.
+ * @since 19-10-2026
+ * @param[in] map The map being searched
+ * @param[in] key A pointer to the key
+ * @returns True if the key is present, otherwise false
+ */
+bool dsc_chmap_contains_key(CMap_t *map, const void* const key) {
+    if (!_dsc_chmap_valid(map, key)) {
+        return false;
+    }
+
+    CMapSegment_t *seg = _dsc_chmap_segment(map, key);
+    pthread_rwlock_rdlock(&seg->lock);
+    const bool found = dsc_hmap_contains_key(&seg->map, key);
+    pthread_rwlock_unlock(&seg->lock);
+
+    return found;
+}
+
+/**
+ * @brief Counts the entries of the map. Segments are visited one at a time, so the result is
+ * only exact if no other thread is writing.
+ * @since 19-10-2026
+ * @param[in] map The map being counted
+ * @returns The number of entries
+ */
+size_t dsc_chmap_count(CMap_t *map) {
+    size_t count = 0;
+
+    if (map == NULL || map->segs == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return 0;
+    }
+
+    for (size_t i = 0; i < map->nsegs; ++i) {
+        pthread_rwlock_rdlock(&map->segs[i].lock);
+        count += map->segs[i].map.count;
+        pthread_rwlock_unlock(&map->segs[i].lock);
+    }
+
+    return count;
+}
@@ -0,0 +1,289 @@
+/**
+ * @file cuckoo.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a cuckoo filter for approximate set membership with deletion.
+*/
+
+#include "cuckoo.h"
+
+#define DSC_CUCKOO_LOAD   95  // Percentage of slots filled at the requested number of keys
+#define DSC_CUCKOO_KICKS  500 // Relocations tried before an insert gives up
+#define DSC_CUCKOO_LANES  0x0001000100010001ULL
+#define DSC_CUCKOO_HIGHS  0x8000800080008000ULL
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static size_t _dsc_cuckoo_klen(const Cuckoo_t* const filter, const void* const key) {
+    return (filter->ksize != 0) ? filter->ksize : strlen((const char*)key) + 1;
+}
+
+static inline uint64_t *_dsc_cuckoo_bucket(const Cuckoo_t* const filter, const size_t i) {
+    return (uint64_t*)filter->buckets.base + i;
+}
+
+/**
+ * Returns a mask with the high bit of each 16-bit lane of bucket that holds fp (0 for an empty
+ * lane). Only the lowest flagged lane is exact, which is all the callers use; the mask is
+ * nonzero exactly when some lane holds fp.
+ */
+static inline uint64_t _dsc_cuckoo_match(const uint64_t bucket, const uint16_t fp) {
+    const uint64_t x = bucket ^ (fp * DSC_CUCKOO_LANES);
+    return (x - DSC_CUCKOO_LANES) & ~x & DSC_CUCKOO_HIGHS;
+}
+
+static inline size_t _dsc_cuckoo_lane(const uint64_t match) {
+    return (size_t)__builtin_ctzll(match) / 16;
+}
+
+static inline uint16_t _dsc_cuckoo_get(const uint64_t bucket, const size_t lane) {
+    return (uint16_t)(bucket >> (lane * 16));
+}
+
+static inline void _dsc_cuckoo_set(uint64_t *bucket, const size_t lane, const uint16_t fp) {
+    *bucket = (*bucket & ~(0xFFFFULL << (lane * 16))) | ((uint64_t)fp << (lane * 16));
+}
+
+// The alternate bucket depends only on the current one and the fingerprint, and applying it twice is a no-op
+static inline size_t _dsc_cuckoo_alt(const Cuckoo_t* const filter, const size_t i, const uint16_t fp) {
+    return (i ^ (size_t)mix64_hash(fp)) & filter->mask;
+}
+
+// Splits a key's hash into its first bucket and its nonzero fingerprint
+static void _dsc_cuckoo_locate(const Cuckoo_t* const filter, const void* const key, size_t *i, uint16_t *fp) {
+    const uint64_t mixed = mix64_hash(filter->hash(key, _dsc_cuckoo_klen(filter, key)));
+    const uint16_t bits = (uint16_t)(mixed >> 48);
+
+    *i = (size_t)mixed & filter->mask;
+    *fp = (bits != 0) ? bits : 1;
+}
+
+// Stores fp in an empty lane of bucket i; returns false if the bucket is full
+static bool _dsc_cuckoo_place(Cuckoo_t *filter, const size_t i, const uint16_t fp) {
+    uint64_t *bucket = _dsc_cuckoo_bucket(filter, i);
+    const uint64_t empty = _dsc_cuckoo_match(*bucket, 0);
+
+    if (empty == 0) {
+        return false;
+    }
+    _dsc_cuckoo_set(bucket, _dsc_cuckoo_lane(empty), fp);
+
+    return true;
+}
+
+static uint64_t _dsc_cuckoo_random(Cuckoo_t *filter) {
+    filter->rng ^= filter->rng << 13;
+    filter->rng ^= filter->rng >> 7;
+    filter->rng ^= filter->rng << 17;
+    return filter->rng;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Initializes an empty filter sized for an expected number of keys. With 16-bit
+ * fingerprints the false positive rate is roughly 0.01%.
+ * @since 19-10-2026
+ * @param[out] filter The filter
+ * @param[in] nkeys The number of keys the filter is sized for
+ * @param[in] ksize The size of each key in bytes (0 if keys are NUL-terminated strings)
+ * @param[in] hash The hash function (NULL for fnv1a_hash())
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_cuckoo_init(Cuckoo_t *filter, const size_t nkeys, const size_t ksize, hash_func hash) {
+    return dsc_cuckoo_init_alloc(filter, nkeys, ksize, hash, NULL);
+}
+
+/**
+ * @brief Initializes an empty filter whose storage comes from alloc.
+ * @since 19-10-2026
+ * @param[out] filter The filter
+ * @param[in] nkeys The number of keys the filter is sized for
+ * @param[in] ksize The size of each key in bytes (0 if keys are NUL-terminated strings)
+ * @param[in] hash The hash function (NULL for fnv1a_hash())
+ * @param[in] alloc The allocator (NULL for malloc)
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_cuckoo_init_alloc(
+    Cuckoo_t *filter,
+    const size_t nkeys,
+    const size_t ksize,
+    hash_func hash,
+    const DscAllocator_t *alloc
+) {
+    if (filter == NULL) {
+        DSC_LOG("The filter points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    memset(filter, 0, sizeof(Cuckoo_t));
+    const size_t nslots = (nkeys * 100 + DSC_CUCKOO_LOAD - 1) / DSC_CUCKOO_LOAD;
+    size_t nbuckets = 1;
+    while (nbuckets * DSC_CUCKOO_SLOTS < nslots) {
+        nbuckets <<= 1;
+    }
+
+    filter->mask = nbuckets - 1;
+    filter->ksize = ksize;
+    filter->hash = (hash != NULL) ? hash : fnv1a_hash;
+    filter->rng = 0x2545F4914F6CDD1DULL;
+    if (dsc_buf_init_alloc(&filter->buckets, nbuckets, sizeof(uint64_t), alloc) != DSC_EOK) {
+        return DSC_ENOMEM;
+    }
+    dsc_buf_fill(&filter->buckets, 0);
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Frees the filter's storage.
+ * @since 19-10-2026
+ * @param[in] filter The filter
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_cuckoo_destroy(Cuckoo_t *filter) {
+    if (filter == NULL || filter->buckets.base == NULL) {
+        DSC_LOG("The filter points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    dsc_buf_destroy(&filter->buckets);
+    filter->count = 0;
+    filter->victim_fp = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Adds a key to the filter. Adding a key twice stores it twice, and it must then be
+ * removed twice. When both of a key's buckets are full, resident fingerprints are moved to
+ * their alternate buckets to make room; if that fails the last displaced fingerprint is kept
+ * aside, so the add still succeeds, and later adds fail until a remove makes room.
+ * @since 19-10-2026
+ * @param[in] filter The filter
+ * @param[in] key A pointer to the key
+ * @returns DSC_EOVERFLOW if the filter is full, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_cuckoo_add(Cuckoo_t *filter, const void* const key) {
+    size_t i;
+    uint16_t fp;
+
+    if (filter == NULL || filter->buckets.base == NULL || key == NULL) {
+        DSC_LOG("The filter points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (filter->victim_fp != 0) {
+        return DSC_EOVERFLOW;
+    }
+
+    _dsc_cuckoo_locate(filter, key, &i, &fp);
+    if (_dsc_cuckoo_place(filter, i, fp) || _dsc_cuckoo_place(filter, (i = _dsc_cuckoo_alt(filter, i, fp)), fp)) {
+        ++filter->count;
+        return DSC_EOK;
+    }
+
+    // Evict a random resident of the (full) bucket and move it to its other bucket, repeatedly
+    for (size_t kick = 0; kick < DSC_CUCKOO_KICKS; ++kick) {
+        uint64_t *bucket = _dsc_cuckoo_bucket(filter, i);
+        const size_t lane = (size_t)(_dsc_cuckoo_random(filter) % DSC_CUCKOO_SLOTS);
+        const uint16_t evicted = _dsc_cuckoo_get(*bucket, lane);
+
+        _dsc_cuckoo_set(bucket, lane, fp);
+        fp = evicted;
+        i = _dsc_cuckoo_alt(filter, i, fp);
+        if (_dsc_cuckoo_place(filter, i, fp)) {
+            ++filter->count;
+            return DSC_EOK;
+        }
+    }
+
+    filter->victim = i;
+    filter->victim_fp = fp;
+    ++filter->count;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Tests whether a key may have been added. There are no false negatives for keys that
+ * were added and not removed.
+ * @since 19-10-2026
+ * @param[in] filter The filter
+ * @param[in] key A pointer to the key
+ * @returns False if the key is definitely absent, true if it is probably present
+ */
+bool dsc_cuckoo_contains(const Cuckoo_t* const filter, const void* const key) {
+    size_t i;
+    uint16_t fp;
+
+    if (filter == NULL || filter->buckets.base == NULL || key == NULL) {
+        DSC_LOG("The filter points to an invalid address", DSC_ERROR);
+        return false;
+    }
+
+    _dsc_cuckoo_locate(filter, key, &i, &fp);
+    const size_t alt = _dsc_cuckoo_alt(filter, i, fp);
+    if (filter->victim_fp == fp && (filter->victim == i || filter->victim == alt)) {
+        return true;
+    }
+
+    return (_dsc_cuckoo_match(*_dsc_cuckoo_bucket(filter, i), fp)
+        | _dsc_cuckoo_match(*_dsc_cuckoo_bucket(filter, alt), fp)) != 0;
+}
+
+/**
+ * @brief Removes a key from the filter. Only remove keys that were added: removing any other
+ * key may delete the fingerprint of a different key that happens to share it.
+ * @since 19-10-2026
+ * @param[in] filter The filter
+ * @param[in] key A pointer to the key
+ * @returns DSC_ENODATA if no matching fingerprint was found, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_cuckoo_remove(Cuckoo_t *filter, const void* const key) {
+    size_t i;
+    uint16_t fp;
+
+    if (filter == NULL || filter->buckets.base == NULL || key == NULL) {
+        DSC_LOG("The filter points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    _dsc_cuckoo_locate(filter, key, &i, &fp);
+    const size_t alt = _dsc_cuckoo_alt(filter, i, fp);
+    if (filter->victim_fp == fp && (filter->victim == i || filter->victim == alt)) {
+        filter->victim_fp = 0;
+        --filter->count;
+        return DSC_EOK;
+    }
+
+    uint64_t *bucket = _dsc_cuckoo_bucket(filter, i);
+    uint64_t match = _dsc_cuckoo_match(*bucket, fp);
+    if (match == 0) {
+        bucket = _dsc_cuckoo_bucket(filter, alt);
+        match = _dsc_cuckoo_match(*bucket, fp);
+        if (match == 0) {
+            return DSC_ENODATA;
+        }
+    }
+    _dsc_cuckoo_set(bucket, _dsc_cuckoo_lane(match), 0);
+    --filter->count;
+
+    // The freed lane may be where the fingerprint kept aside can go
+    if (filter->victim_fp != 0) {
+        const uint16_t vfp = filter->victim_fp;
+        const size_t vi = filter->victim;
+        if (_dsc_cuckoo_place(filter, vi, vfp) || _dsc_cuckoo_place(filter, _dsc_cuckoo_alt(filter, vi, vfp), vfp)) {
+            filter->victim_fp = 0;
+        }
+    }
+
+    return DSC_EOK;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file dll.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides APIs for managing an intrusive, circular doubly linked list.
+*/
+
+#include "dll.h"
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Initializes a node as unlinked, or a head as an empty list.
+ * @since 19-10-2026
+ * @param[out] node The node or head
+ * @param[in] data The data the node refers to (NULL for a head)
+ */
+void dsc_dll_init(DLLNode_t node, void *data) {
+    node->data = data;
+    node->prev = node;
+    node->next = node;
+}
+
+/**
+ * @brief Links node directly after pos. The node must not be linked into a list already.
+ * @since 19-10-2026
+ * @param[in] pos A node of the list, or its head to insert at the front
+ * @param[in] node The node to link
+ */
+void dsc_dll_insert_after(DLLNode_t pos, DLLNode_t node) {
+    node->prev = pos;
+    node->next = pos->next;
+    pos->next->prev = node;
+    pos->next = node;
+}
+
+/**
+ * @brief Links node at the back of the list.
+ * @since 19-10-2026
+ * @param[in] head The head of the list
+ * @param[in] node The node to link
+ */
+void dsc_dll_append(DLLNode_t head, DLLNode_t node) {
+    dsc_dll_insert_after(head->prev, node);
+}
+
+/**
+ * @brief Unlinks a node from whichever list it is in. Unlinking an unlinked node does nothing.
+ * @since 19-10-2026
+ * @param[in] node The node to unlink
+ */
+void dsc_dll_unlink(DLLNode_t node) {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    node->prev = node;
+    node->next = node;
+}
+
+/**
+ * @brief Moves every node of src to the back of dst in O(1), leaving src empty.
+ * @since 19-10-2026
+ * @param[in] dst The head of the list receiving the nodes
+ * @param[in] src The head of the list giving up its nodes
+ */
+void dsc_dll_splice(DLLNode_t dst, DLLNode_t src) {
+    if (dsc_dll_empty(src)) {
+        return;
+    }
+
+    src->next->prev = dst->prev;
+    dst->prev->next = src->next;
+    src->prev->next = dst;
+    dst->prev = src->prev;
+    src->prev = src;
+    src->next = src;
+}
+
+/**
+ * @brief Counts the nodes of a list. O(n).
+ * @since 19-10-2026
+ * @param[in] head The head of the list
+ * @returns The number of nodes, not counting the head
+ */
+size_t dsc_dll_nelem(const DLLNode_t head) {
+    size_t nelem = 0;
+    for (DLLNode_t iter = head->next; iter != head; iter = iter->next) {
+        ++nelem;
+    }
+    return nelem;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file dsc_common.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides the logging backend used by DSC_LOG.
+*/
+
+#include "dsc_common.h"
+
+#include <time.h>
+
+static const char* const _dsc_log_headers[] = { "NOTE", "WARNING", "ERROR" };
+
+static void _dsc_log_stderr(
+    void *ctx,
+    const DscLogLevel_t level,
+    const char *file,
+    const char *func,
+    const int line,
+    const char *msg
+) {
+    (void)ctx;
+    fprintf(stderr, "libdsc: %s: %s (%s:%d, %s)\n", _dsc_log_headers[level], msg, file, line, func);
+}
+
+// The sink is expected to be installed once, before the library is used from several threads
+static dsc_log_sink _dsc_sink = _dsc_log_stderr;
+static void *_dsc_sink_ctx = NULL;
+
+static unsigned _dsc_max_per_sec = 100; // 0 disables rate limiting
+static uint64_t _dsc_window = 0;        // The second that _dsc_nlogged refers to
+static unsigned _dsc_nlogged = 0;       // Messages emitted during the current window
+static unsigned _dsc_nsuppressed = 0;   // Messages dropped since the last window was reported
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static uint64_t _dsc_log_now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+    return (uint64_t)ts.tv_sec;
+}
+
+/**
+ * Returns true if a message may be emitted. Opening a new one-second window reports how many
+ * messages the previous windows dropped, so that storms are visible without flooding the sink.
+ */
+static bool _dsc_log_admit(const char *file, const char *func, const int line) {
+    const unsigned max_per_sec = __atomic_load_n(&_dsc_max_per_sec, __ATOMIC_RELAXED);
+    if (max_per_sec == 0) {
+        return true;
+    }
+
+    uint64_t now = _dsc_log_now_sec();
+    uint64_t window = __atomic_load_n(&_dsc_window, __ATOMIC_RELAXED);
+    if (now != window
+        && __atomic_compare_exchange_n(&_dsc_window, &window, now, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+    ) {
+        __atomic_store_n(&_dsc_nlogged, 0, __ATOMIC_RELAXED);
+        unsigned nsuppressed = __atomic_exchange_n(&_dsc_nsuppressed, 0, __ATOMIC_RELAXED);
+        if (nsuppressed != 0) {
+            char note[64];
+            snprintf(note, sizeof(note), "%u messages were suppressed by rate limiting", nsuppressed);
+            _dsc_sink(_dsc_sink_ctx, DSC_WARNING, file, func, line, note);
+        }
+    }
+
+    if (__atomic_add_fetch(&_dsc_nlogged, 1, __ATOMIC_RELAXED) > max_per_sec) {
+        __atomic_add_fetch(&_dsc_nsuppressed, 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Forwards a message to the installed sink. Use DSC_LOG() rather than calling this directly.
+ * @since 19-10-2026
+ * @param[in] file The file the message originates from
+ * @param[in] func The function the message originates from
+ * @param[in] line The line the message originates from
+ * @param[in] msg The message
+ * @param[in] level The severity of the message
+ */
+void _dsc_log(
+    const char *file,
+    const char *func,
+    const int line,
+    const char *msg,
+    const DscLogLevel_t level
+) {
+    if (!_dsc_log_admit(file, func, line)) {
+        return;
+    }
+
+    _dsc_sink(_dsc_sink_ctx, level, file, func, line, msg);
+}
+
+/**
+ * @brief Installs the function that receives every log message.
+ * @since 19-10-2026
+ * @param[in] sink The sink, or NULL to restore the default sink that writes one line to stderr
+ * @param[in] ctx Passed as the first argument to sink
+ */
+void dsc_log_set_sink(dsc_log_sink sink, void *ctx) {
+    _dsc_sink_ctx = ctx;
+    _dsc_sink = (sink != NULL) ? sink : _dsc_log_stderr;
+}
+
+/**
+ * @brief Caps the number of messages forwarded to the sink per second (default: 100).
+ * @since 19-10-2026
+ * @param[in] max_per_sec The cap, or 0 to forward every message
+ */
+void dsc_log_set_rate_limit(const unsigned max_per_sec) {
+    __atomic_store_n(&_dsc_max_per_sec, max_per_sec, __ATOMIC_RELAXED);
+}
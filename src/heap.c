@@ -0,0 +1,463 @@
+/**
+ * @file heap.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a d-ary heap (priority queue) stored in a Buffer_t, with optional handles
+ * for changing or removing an element after it was pushed.
+*/
+
+#include "heap.h"
+
+#define DSC_HEAP_DEFAULT_ARITY 4
+#define DSC_HEAP_MIN_CAP       16
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static inline uint8_t *_dsc_heap_at(const Heap_t* const heap, const size_t i) {
+    return (uint8_t*)heap->data.base + i * heap->data.tsize;
+}
+
+static inline size_t *_dsc_heap_handles(const Heap_t* const heap) {
+    return heap->handles.base;
+}
+
+static inline size_t *_dsc_heap_slots(const Heap_t* const heap) {
+    return heap->slots.base;
+}
+
+static inline bool _dsc_heap_before(const Heap_t* const heap, const void* const lhs, const void* const rhs) {
+    return heap->reverse ? heap->cmp(rhs, lhs) < 0 : heap->cmp(lhs, rhs) < 0;
+}
+
+// Writes elem and its handle to position i
+static inline void _dsc_heap_put(Heap_t *heap, const size_t i, const void* const elem, const size_t handle) {
+    memcpy(_dsc_heap_at(heap, i), elem, heap->data.tsize);
+    if (heap->track) {
+        _dsc_heap_handles(heap)[i] = handle;
+        _dsc_heap_slots(heap)[handle] = i;
+    }
+}
+
+static inline size_t _dsc_heap_handle_at(const Heap_t* const heap, const size_t i) {
+    return heap->track ? _dsc_heap_handles(heap)[i] : DSC_HEAP_NO_HANDLE;
+}
+
+/**
+ * Both sifts move a hole rather than swapping: each displaced element is copied once, and
+ * elem is written once into the position where the hole comes to rest.
+ */
+static void _dsc_heap_sift_up(Heap_t *heap, size_t i, const void* const elem, const size_t handle) {
+    while (i > 0) {
+        const size_t parent = (i - 1) / heap->arity;
+        if (!_dsc_heap_before(heap, elem, _dsc_heap_at(heap, parent))) {
+            break;
+        }
+        _dsc_heap_put(heap, i, _dsc_heap_at(heap, parent), _dsc_heap_handle_at(heap, parent));
+        i = parent;
+    }
+    _dsc_heap_put(heap, i, elem, handle);
+}
+
+static void _dsc_heap_sift_down(Heap_t *heap, size_t i, const void* const elem, const size_t handle) {
+    for (;;) {
+        const size_t first = i * heap->arity + 1;
+        if (first >= heap->nelem) {
+            break;
+        }
+
+        const size_t last = (first + heap->arity < heap->nelem) ? first + heap->arity : heap->nelem;
+        size_t best = first;
+        for (size_t c = first + 1; c < last; ++c) {
+            if (_dsc_heap_before(heap, _dsc_heap_at(heap, c), _dsc_heap_at(heap, best))) {
+                best = c;
+            }
+        }
+        if (!_dsc_heap_before(heap, _dsc_heap_at(heap, best), elem)) {
+            break;
+        }
+        _dsc_heap_put(heap, i, _dsc_heap_at(heap, best), _dsc_heap_handle_at(heap, best));
+        i = best;
+    }
+    _dsc_heap_put(heap, i, elem, handle);
+}
+
+// Moves elem into position i from whichever direction restores the heap order
+static void _dsc_heap_sift(Heap_t *heap, const size_t i, const void* const elem, const size_t handle) {
+    if (i > 0 && _dsc_heap_before(heap, elem, _dsc_heap_at(heap, (i - 1) / heap->arity))) {
+        _dsc_heap_sift_up(heap, i, elem, handle);
+    } else {
+        _dsc_heap_sift_down(heap, i, elem, handle);
+    }
+}
+
+static DscError_t _dsc_heap_reserve(Heap_t *heap, const size_t nelem) {
+    // A failed resize may leave the elements and their handles with different capacities
+    size_t cap = dsc_buf_nelem(&heap->data);
+    if (heap->track && dsc_buf_nelem(&heap->handles) < cap) {
+        cap = dsc_buf_nelem(&heap->handles);
+    }
+    if (nelem <= cap) {
+        return DSC_EOK;
+    }
+
+    while (cap < nelem) {
+        cap *= 2;
+    }
+    if ((dsc_buf_nelem(&heap->data) < cap && dsc_buf_resize(&heap->data, cap) != DSC_EOK)
+        || (heap->track && dsc_buf_nelem(&heap->handles) < cap && dsc_buf_resize(&heap->handles, cap) != DSC_EOK)
+    ) {
+        return DSC_ENOMEM;
+    }
+
+    return DSC_EOK;
+}
+
+static DscError_t _dsc_heap_new_handle(Heap_t *heap, size_t *handle) {
+    if (!heap->track) {
+        *handle = DSC_HEAP_NO_HANDLE;
+        return DSC_EOK;
+    } else if (heap->free != DSC_HEAP_NO_HANDLE) {
+        *handle = heap->free;
+        heap->free = _dsc_heap_slots(heap)[*handle];
+        return DSC_EOK;
+    }
+
+    if (heap->nhandles == dsc_buf_nelem(&heap->slots)
+        && dsc_buf_resize(&heap->slots, heap->nhandles * 2) != DSC_EOK
+    ) {
+        return DSC_ENOMEM;
+    }
+    *handle = heap->nhandles++;
+
+    return DSC_EOK;
+}
+
+static void _dsc_heap_free_handle(Heap_t *heap, const size_t handle) {
+    if (heap->track) {
+        _dsc_heap_slots(heap)[handle] = heap->free;
+        heap->free = handle;
+    }
+}
+
+static bool _dsc_heap_live(const Heap_t* const heap, const size_t handle) {
+    if (!heap->track || handle >= heap->nhandles) {
+        return false;
+    }
+
+    // A free handle never appears in the position table, so a stale handle fails the round trip
+    const size_t i = _dsc_heap_slots(heap)[handle];
+    return i < heap->nelem && _dsc_heap_handles(heap)[i] == handle;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Initializes an empty heap.
+ * @since 19-10-2026
+ * @param[out] heap The heap to be initialized
+ * @param[in] tsize The size (in bytes) of each element
+ * @param[in] arity The number of children per node, or 0 for the default of 4
+ * @param[in] cmp Orders two elements, like the comparator passed to qsort(); the first is on top
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_heap_init(Heap_t *heap, const uint8_t tsize, const size_t arity, compare_func cmp) {
+    return dsc_heap_init_alloc(heap, tsize, arity, cmp, NULL);
+}
+
+/**
+ * @brief Initializes an empty heap whose storage comes from a custom allocator.
+ * @since 19-10-2026
+ * @param[out] heap The heap to be initialized
+ * @param[in] tsize The size (in bytes) of each element
+ * @param[in] arity The number of children per node, or 0 for the default of 4
+ * @param[in] cmp Orders two elements, like the comparator passed to qsort(); the first is on top
+ * @param[in] alloc The allocator used for the heap's storage (NULL for malloc)
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_heap_init_alloc(
+    Heap_t *heap,
+    const uint8_t tsize,
+    const size_t arity,
+    compare_func cmp,
+    const DscAllocator_t *alloc
+) {
+    if (heap == NULL || tsize == 0 || arity == 1 || cmp == NULL) {
+        DSC_LOG("The heap points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    memset(heap, 0, sizeof(Heap_t));
+    heap->arity = (arity != 0) ? arity : DSC_HEAP_DEFAULT_ARITY;
+    heap->cmp = cmp;
+    heap->free = DSC_HEAP_NO_HANDLE;
+    if (dsc_buf_init_alloc(&heap->data, DSC_HEAP_MIN_CAP, tsize, alloc) != DSC_EOK) {
+        return DSC_ENOMEM;
+    }
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Frees the heap's storage.
+ * @since 19-10-2026
+ * @param[in] heap The heap
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_heap_destroy(Heap_t *heap) {
+    if (heap == NULL) {
+        DSC_LOG("The heap points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    dsc_buf_destroy(&heap->data);
+    if (heap->track) {
+        dsc_buf_destroy(&heap->handles);
+        dsc_buf_destroy(&heap->slots);
+        heap->track = false;
+    }
+    heap->nelem = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Makes dsc_heap_push() hand out handles, which dsc_heap_update() and dsc_heap_remove()
+ * accept. A handle stays valid until its element is popped or removed. Must be called while
+ * the heap is empty.
+ * @since 19-10-2026
+ * @param[in] heap The heap
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_heap_track_handles(Heap_t *heap) {
+    if (heap == NULL || heap->data.base == NULL || heap->nelem != 0) {
+        DSC_LOG("Handles can only be tracked from an empty heap", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (heap->track) {
+        return DSC_EOK;
+    }
+
+    const size_t cap = dsc_buf_nelem(&heap->data);
+    if (dsc_buf_init_alloc(&heap->handles, cap, sizeof(size_t), heap->data.alloc) != DSC_EOK) {
+        return DSC_ENOMEM;
+    }
+    if (dsc_buf_init_alloc(&heap->slots, cap, sizeof(size_t), heap->data.alloc) != DSC_EOK) {
+        dsc_buf_destroy(&heap->handles);
+        return DSC_ENOMEM;
+    }
+    heap->track = true;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Copies an element into the heap. O(log_d n).
+ * @since 19-10-2026
+ * @param[in] heap The heap
+ * @param[in] elem The element
+ * @param[out] handle Receives the element's handle, or DSC_HEAP_NO_HANDLE if handles are not tracked (may be NULL)
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_heap_push(Heap_t *heap, const void* const elem, size_t *handle) {
+    size_t h;
+
+    if (heap == NULL || heap->data.base == NULL || elem == NULL) {
+        DSC_LOG("The heap points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    if (_dsc_heap_reserve(heap, heap->nelem + 1) != DSC_EOK || _dsc_heap_new_handle(heap, &h) != DSC_EOK) {
+        DSC_LOG("Failed to allocate memory for dsc heap", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    _dsc_heap_sift_up(heap, heap->nelem++, elem, h);
+    if (handle != NULL) {
+        *handle = h;
+    }
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Removes the element on top of the heap. O(d log_d n).
+ * @since 19-10-2026
+ * @param[in] heap The heap
+ * @param[out] out Receives a copy of the element (may be NULL)
+ * @returns DSC_ENODATA if the heap is empty, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_heap_pop(Heap_t *heap, void *out) {
+    uint8_t last[UINT8_MAX];
+
+    if (heap == NULL || heap->data.base == NULL) {
+        DSC_LOG("The heap points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (heap->nelem == 0) {
+        return DSC_ENODATA;
+    }
+
+    if (out != NULL) {
+        memcpy(out, _dsc_heap_at(heap, 0), heap->data.tsize);
+    }
+    _dsc_heap_free_handle(heap, _dsc_heap_handle_at(heap, 0));
+
+    if (--heap->nelem != 0) {
+        memcpy(last, _dsc_heap_at(heap, heap->nelem), heap->data.tsize);
+        _dsc_heap_sift_down(heap, 0, last, _dsc_heap_handle_at(heap, heap->nelem));
+    }
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Replaces the element behind a handle and restores the heap order, e.g. to lower a
+ * task's deadline (decrease-key). O(log_d n) when the element moves up.
+ * @since 19-10-2026
+ * @param[in] heap The heap, which must be tracking handles
+ * @param[in] handle The handle returned when the element was pushed
+ * @param[in] elem The new element
+ * @returns DSC_ENODATA if the handle is not live, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_heap_update(Heap_t *heap, const size_t handle, const void* const elem) {
+    if (heap == NULL || elem == NULL) {
+        DSC_LOG("The heap points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (!_dsc_heap_live(heap, handle)) {
+        DSC_LOG("The heap handle is not live", DSC_ERROR);
+        return DSC_ENODATA;
+    }
+
+    _dsc_heap_sift(heap, _dsc_heap_slots(heap)[handle], elem, handle);
+    return DSC_EOK;
+}
+
+/**
+ * @brief Removes the element behind a handle, wherever it is in the heap.
+ * @since 19-10-2026
+ * @param[in] heap The heap, which must be tracking handles
+ * @param[in] handle The handle returned when the element was pushed
+ * @returns DSC_ENODATA if the handle is not live, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_heap_remove(Heap_t *heap, const size_t handle) {
+    uint8_t last[UINT8_MAX];
+
+    if (heap == NULL) {
+        DSC_LOG("The heap points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (!_dsc_heap_live(heap, handle)) {
+        DSC_LOG("The heap handle is not live", DSC_ERROR);
+        return DSC_ENODATA;
+    }
+
+    const size_t i = _dsc_heap_slots(heap)[handle];
+    _dsc_heap_free_handle(heap, handle);
+    if (i != --heap->nelem) {
+        memcpy(last, _dsc_heap_at(heap, heap->nelem), heap->data.tsize);
+        _dsc_heap_sift(heap, i, last, _dsc_heap_handle_at(heap, heap->nelem));
+    }
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Replaces the heap's contents with nelem elements copied from base, in O(n) rather
+ * than the O(n log n) of pushing them one at a time. When handles are tracked, element i of
+ * base gets handle i and every earlier handle is invalidated.
+ * @since 19-10-2026
+ * @param[in] heap The heap
+ * @param[in] base The elements, packed at the heap's element size
+ * @param[in] nelem The number of elements
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_heap_heapify(Heap_t *heap, const void* const base, const size_t nelem) {
+    uint8_t elem[UINT8_MAX];
+
+    if (heap == NULL || heap->data.base == NULL || (base == NULL && nelem != 0)) {
+        DSC_LOG("The heap points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    if (_dsc_heap_reserve(heap, nelem) != DSC_EOK
+        || (heap->track && nelem > dsc_buf_nelem(&heap->slots) && dsc_buf_resize(&heap->slots, nelem) != DSC_EOK)
+    ) {
+        DSC_LOG("Failed to allocate memory for dsc heap", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    memcpy(heap->data.base, base, nelem * heap->data.tsize);
+    heap->nelem = nelem;
+    if (heap->track) {
+        for (size_t i = 0; i < nelem; ++i) {
+            _dsc_heap_handles(heap)[i] = i;
+            _dsc_heap_slots(heap)[i] = i;
+        }
+        heap->nhandles = nelem;
+        heap->free = DSC_HEAP_NO_HANDLE;
+    }
+
+    // Floyd's construction: sift down every internal node, deepest first
+    for (size_t i = (nelem > 1) ? (nelem - 2) / heap->arity + 1 : 0; i-- > 0;) {
+        memcpy(elem, _dsc_heap_at(heap, i), heap->data.tsize);
+        _dsc_heap_sift_down(heap, i, elem, _dsc_heap_handle_at(heap, i));
+    }
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Selects the k elements of an array that order first, in O(n log k) time and O(k)
+ * space. A heap of the k best elements seen so far is kept with the worst of them on top, so
+ * most elements are rejected with a single comparison.
+ * @since 19-10-2026
+ * @param[in] base The elements, packed at tsize bytes each
+ * @param[in] nelem The number of elements
+ * @param[in] tsize The size (in bytes) of each element
+ * @param[in] k The number of elements to select
+ * @param[in] cmp Orders two elements, like the comparator passed to qsort()
+ * @param[out] out Receives the selected elements in order; must have room for k elements
+ * @returns The number of elements written to out (the lesser of k and nelem), or 0 on failure
+ */
+size_t dsc_heap_topk(
+    const void* const base,
+    const size_t nelem,
+    const uint8_t tsize,
+    const size_t k,
+    compare_func cmp,
+    void *out
+) {
+    Heap_t heap;
+    const uint8_t *elems = base;
+    const size_t nkeep = (k < nelem) ? k : nelem;
+
+    if (base == NULL || out == NULL || nkeep == 0 || dsc_heap_init(&heap, tsize, 0, cmp) != DSC_EOK) {
+        return 0;
+    }
+
+    heap.reverse = true;
+    if (dsc_heap_heapify(&heap, base, nkeep) != DSC_EOK) {
+        dsc_heap_destroy(&heap);
+        return 0;
+    }
+
+    for (size_t i = nkeep; i < nelem; ++i) {
+        if (cmp(elems + i * tsize, _dsc_heap_at(&heap, 0)) < 0) {
+            _dsc_heap_sift_down(&heap, 0, elems + i * tsize, DSC_HEAP_NO_HANDLE);
+        }
+    }
+
+    // The worst kept element is on top, so popping fills out from the back
+    for (size_t i = nkeep; i-- > 0;) {
+        dsc_heap_pop(&heap, (uint8_t*)out + i * tsize);
+    }
+    dsc_heap_destroy(&heap);
+
+    return nkeep;
+}
@@ -1,3 +1,1216 @@
+/**
+ * @file hmap.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 06-09-2025
+ * @brief Provides APIs for managing a hash map that uses open addressing.
+*/
+
 #include "hmap.h"
+#include "hash.h"
+#include "parallel.h"
+#include "snapshot_internal.h"
+
+#define DSC_HMAP_MIN_SLOTS 8
+#define DSC_HMAP_ALIGN     8
+#define DSC_HMAP_MIGRATE   16 // Slots drained per update while an incremental resize is in progress
+#define DSC_HMAP_MIN_BULK  4096 // Entries per thread below which a bulk insert runs serially
+#define DSC_HMAP_BATCH     16 // Keys hashed and prefetched together by a batched lookup
+
+// Sentinel stored in a slot's key once its entry has been removed
+static const char _dsc_hmap_tombstone;
+#define DSC_HMAP_TOMBSTONE ((void*)&_dsc_hmap_tombstone)
+
+/*
+ * Snapshot layout: an HMapSnapshot_t, then nslots HMapSlot_t, then the entries. Each entry is
+ * laid out as in memory (key, padding, value) and padded so that the next entry is aligned.
+ * The slot table is at most half full so that misses terminate quickly.
+ */
+typedef struct {
+    SnapshotHeader_t hdr;
+    uint64_t nslots;    // Power of two
+    uint64_t count;     // Number of entries
+    uint64_t ksize;     // As in Map_t
+    uint64_t vsize;     // As in Map_t
+    uint64_t slots_off; // Offset of the slot table
+} HMapSnapshot_t;
+
+/*
+ * A bulk insert splits the slot array into one contiguous region per thread. Each thread inserts
+ * the keys whose home slot lies in its region and only probes within it, so no two threads touch
+ * the same slot. Keys whose probe sequence runs off the end of their region are deferred to a
+ * serial pass.
+ */
+typedef struct {
+    Map_t         *map;
+    const uint8_t *keys;     // Packed keys, or an array of const char * if map->ksize is 0
+    const uint8_t *values;   // Packed values (may be NULL)
+    size_t         n;        // Number of entries
+    size_t         nthreads; // Number of threads, which is also the number of regions
+    uint32_t      *hashes;   // Hash of each key
+    size_t        *order;    // Entry indices grouped by region
+    size_t        *counts;   // counts[t * nthreads + r]: entries of thread t's share homed in region r
+    size_t        *added;    // Entries added per region
+    size_t        *reused;   // Tombstones reused per region
+    size_t        *deferred; // Entries deferred per region; they are kept at the start of the region's group
+    int            status;   // DSC_EOK, or the first error hit by a worker
+} HMapBulk_t;
+
+typedef struct {
+    uint32_t hash; // fnv1a_hash() of the key
+    uint32_t klen; // Length of the key in bytes, including the terminator for string keys
+    uint64_t off;  // Offset of the entry, or 0 if the slot is empty
+} HMapSlot_t;
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static size_t _dsc_hmap_klen(const Map_t* const map, const void* const key) {
+    return (map->ksize != 0) ? map->ksize : strlen((const char*)key) + 1;
+}
+
+// Returns the i-th key of an array that is packed, or one of const char * if the map has string keys
+static const void *_dsc_hmap_key_at(const Map_t* const map, const uint8_t* const keys, const size_t i) {
+    return (map->ksize != 0)
+        ? (const void*)(keys + i * map->ksize)
+        : (const void*)((const char* const*)keys)[i];
+}
+
+static bool _dsc_hmap_key_eq(const Map_t* const map, const void* const lhs, const void* const rhs) {
+    // Word-sized keys (e.g. IDs from an Intern_t) compare as integers rather than through memcmp()
+    if (map->ksize == sizeof(uint32_t)) {
+        uint32_t a, b;
+        memcpy(&a, lhs, sizeof(a));
+        memcpy(&b, rhs, sizeof(b));
+        return a == b;
+    } else if (map->ksize == sizeof(uint64_t)) {
+        uint64_t a, b;
+        memcpy(&a, lhs, sizeof(a));
+        memcpy(&b, rhs, sizeof(b));
+        return a == b;
+    }
+
+    return (map->ksize != 0)
+        ? memcmp(lhs, rhs, map->ksize) == 0
+        : strcmp((const char*)lhs, (const char*)rhs) == 0;
+}
+
+// Keys and values share one allocation; the value starts at the first aligned offset past the key
+static size_t _dsc_hmap_voff(const size_t klen) {
+    return (klen + (DSC_HMAP_ALIGN - 1)) & ~((size_t)DSC_HMAP_ALIGN - 1);
+}
+
+static size_t _dsc_hmap_entry_size(const Map_t* const map, const void* const key) {
+    return _dsc_hmap_voff(_dsc_hmap_klen(map, key)) + map->vsize;
+}
+
+static size_t _dsc_hmap_next_pow2(size_t n) {
+    size_t p = DSC_HMAP_MIN_SLOTS;
+    while (p < n) {
+        p <<= 1;
+    }
+    return p;
+}
+
+/**
+ * Returns the slot of base holding key, whose hash is given, or nelem if the key is absent. When
+ * the key is absent and free_slot is not NULL, it receives the first empty or tombstoned slot
+ * along the probe sequence.
+ */
+static size_t _dsc_hmap_probe_hashed(
+    const Map_t* const map,
+    const KV_t* const base,
+    const size_t nelem,
+    const void* const key,
+    const uint32_t hash,
+    size_t *free_slot
+) {
+    const size_t mask = nelem - 1;
+    size_t idx = hash & mask;
+    size_t tomb = nelem;
+    size_t n;
+
+    DSC_STATS_ADD(map->alloc, lookups, 1);
+    for (n = 0; n < nelem; ++n, idx = (idx + 1) & mask) {
+        void *slot_key = base[idx].key;
+        if (slot_key == NULL) {
+            if (free_slot != NULL) {
+                *free_slot = (tomb != nelem) ? tomb : idx;
+            }
+            DSC_STATS_ADD(map->alloc, probes, n + 1);
+            return nelem;
+        } else if (slot_key == DSC_HMAP_TOMBSTONE) {
+            if (tomb == nelem) {
+                tomb = idx;
+            }
+        } else if (_dsc_hmap_key_eq(map, slot_key, key)) {
+            DSC_STATS_ADD(map->alloc, probes, n + 1);
+            return idx;
+        }
+    }
+
+    if (free_slot != NULL) {
+        *free_slot = tomb;
+    }
+    DSC_STATS_ADD(map->alloc, probes, n);
+    return nelem;
+}
+
+static size_t _dsc_hmap_probe(
+    const Map_t* const map,
+    const KV_t* const base,
+    const size_t nelem,
+    const void* const key,
+    const size_t klen,
+    size_t *free_slot
+) {
+    return _dsc_hmap_probe_hashed(map, base, nelem, key, map->hash(key, klen), free_slot);
+}
+
+static size_t _dsc_hmap_find(
+    const Map_t* const map,
+    const void* const key,
+    const size_t klen,
+    size_t *free_slot
+) {
+    return _dsc_hmap_probe(map, map->base, map->nelem, key, klen, free_slot);
+}
+
+/**
+ * Returns the slot holding key, whose hash is given, in either slot array, or NULL if the key is
+ * absent. in_old is set if the slot belongs to the array being drained by an incremental resize.
+ */
+static KV_t *_dsc_hmap_lookup_hashed(
+    const Map_t* const map,
+    const void* const key,
+    const uint32_t hash,
+    bool *in_old
+) {
+    size_t idx = _dsc_hmap_probe_hashed(map, map->base, map->nelem, key, hash, NULL);
+
+    *in_old = false;
+    if (idx != map->nelem) {
+        return &map->base[idx];
+    } else if (map->old_base != NULL) {
+        idx = _dsc_hmap_probe_hashed(map, map->old_base, map->old_nelem, key, hash, NULL);
+        if (idx != map->old_nelem) {
+            *in_old = true;
+            return &map->old_base[idx];
+        }
+    }
+
+    return NULL;
+}
+
+static KV_t *_dsc_hmap_lookup(
+    const Map_t* const map,
+    const void* const key,
+    const size_t klen,
+    bool *in_old
+) {
+    return _dsc_hmap_lookup_hashed(map, key, map->hash(key, klen), in_old);
+}
+
+/**
+ * Looks up n keys and returns the number found. The value of each key (or NULL) is stored in
+ * values and whether it is present in found; either may be NULL. Keys are taken in groups: every
+ * key of a group is hashed and its home slot prefetched, then each occupied home slot has its
+ * entry prefetched, and only then is each key probed. The cache misses of a group therefore
+ * overlap rather than being paid one after another.
+ */
+static size_t _dsc_hmap_lookup_many(
+    const Map_t* const map,
+    const uint8_t* const keys,
+    const size_t n,
+    void **values,
+    bool *found
+) {
+    const size_t mask = map->nelem - 1;
+    uint32_t hashes[DSC_HMAP_BATCH];
+    size_t nfound = 0;
+
+    for (size_t lo = 0; lo < n; lo += DSC_HMAP_BATCH) {
+        const size_t hi = (n - lo < DSC_HMAP_BATCH) ? n : lo + DSC_HMAP_BATCH;
+
+        for (size_t i = lo; i < hi; ++i) {
+            const void *key = _dsc_hmap_key_at(map, keys, i);
+            hashes[i - lo] = map->hash(key, _dsc_hmap_klen(map, key));
+            __builtin_prefetch(&map->base[hashes[i - lo] & mask]);
+        }
+
+        for (size_t i = lo; i < hi; ++i) {
+            const void *slot_key = map->base[hashes[i - lo] & mask].key;
+            if (slot_key != NULL && slot_key != DSC_HMAP_TOMBSTONE) {
+                __builtin_prefetch(slot_key);
+            }
+        }
+
+        for (size_t i = lo; i < hi; ++i) {
+            bool in_old;
+            const KV_t *kv = _dsc_hmap_lookup_hashed(map, _dsc_hmap_key_at(map, keys, i), hashes[i - lo], &in_old);
+            if (values != NULL) {
+                values[i] = (kv != NULL) ? kv->value : NULL;
+            }
+            if (found != NULL) {
+                found[i] = (kv != NULL);
+            }
+            nfound += (kv != NULL);
+        }
+    }
+
+    return nfound;
+}
+
+// Stores kv in the first empty or tombstoned slot of its probe sequence; returns true if it was a tombstone
+static bool _dsc_hmap_place(const Map_t* const map, KV_t *base, const size_t nelem, const KV_t kv) {
+    const size_t mask = nelem - 1;
+    size_t idx = map->hash(kv.key, _dsc_hmap_klen(map, kv.key)) & mask;
+
+    while (base[idx].key != NULL && base[idx].key != DSC_HMAP_TOMBSTONE) {
+        idx = (idx + 1) & mask;
+    }
+    const bool tomb = (base[idx].key != NULL);
+    base[idx] = kv;
+
+    return tomb;
+}
+
+// Addresses both slot arrays as one sequence of map->nelem + map->old_nelem slots
+static const KV_t *_dsc_hmap_slot(const Map_t* const map, const size_t i) {
+    return (i < map->nelem) ? &map->base[i] : &map->old_base[i - map->nelem];
+}
+
+static void _dsc_hmap_free_entries(const Map_t* const map, KV_t *base, const size_t nelem) {
+    for (size_t i = 0; i < nelem; ++i) {
+        void *key = base[i].key;
+        if (key != NULL && key != DSC_HMAP_TOMBSTONE) {
+            dsc_free(map->alloc, key, _dsc_hmap_entry_size(map, key));
+        }
+    }
+}
+
+/**
+ * Moves up to nslots slots of the array being drained into the current one. Drained slots become
+ * tombstones so that the probe sequences of the slots that remain are left intact.
+ */
+static void _dsc_hmap_migrate(Map_t *map, size_t nslots) {
+    if (map->old_base == NULL) {
+        return;
+    }
+
+    for (; nslots != 0 && map->migrated < map->old_nelem; --nslots) {
+        KV_t *kv = &map->old_base[map->migrated++];
+        if (kv->key != NULL && kv->key != DSC_HMAP_TOMBSTONE) {
+            if (_dsc_hmap_place(map, map->base, map->nelem, *kv)) {
+                --map->ntomb;
+            }
+            kv->key = DSC_HMAP_TOMBSTONE;
+            kv->value = NULL;
+        }
+    }
+
+    if (map->migrated == map->old_nelem) {
+        dsc_free(map->alloc, map->old_base, map->old_nelem * sizeof(KV_t));
+        map->old_base = NULL;
+        map->old_nelem = 0;
+        map->migrated = 0;
+    }
+}
+
+static size_t _dsc_hmap_stride(const size_t klen, const size_t vsize) {
+    return _dsc_hmap_voff(_dsc_hmap_voff(klen) + vsize);
+}
+
+static const HMapSnapshot_t *_dsc_hmap_snapshot(const Snapshot_t* const snap) {
+    const HMapSnapshot_t *hdr = _dsc_snapshot_section(snap, SNAPSHOT_HMAP, sizeof(HMapSnapshot_t));
+    if (hdr == NULL) {
+        return NULL;
+    } else if (hdr->nslots == 0 || (hdr->nslots & (hdr->nslots - 1)) != 0
+        || hdr->slots_off > snap->size
+        || hdr->nslots > (snap->size - hdr->slots_off) / sizeof(HMapSlot_t)
+    ) {
+        DSC_LOG("The hash map snapshot is corrupt", DSC_ERROR);
+        return NULL;
+    }
+    return hdr;
+}
+
+/*
+ * Checks that a slot's entry lies within the snapshot and that its key is well formed: exactly
+ * ksize bytes for a fixed-size key, or terminated by its last byte for a string key.
+ */
+static bool _dsc_hmap_snapshot_entry_ok(
+    const Snapshot_t* const snap,
+    const HMapSnapshot_t* const hdr,
+    const HMapSlot_t* const slot
+) {
+    if (slot->off > snap->size || hdr->vsize > snap->size
+        || _dsc_hmap_voff(slot->klen) + hdr->vsize > snap->size - slot->off
+    ) {
+        return false;
+    } else if (hdr->ksize != 0) {
+        return slot->klen == hdr->ksize;
+    }
+
+    const uint8_t *key = snap->base + slot->off;
+    return slot->klen != 0 && memchr(key, '\0', slot->klen) == key + slot->klen - 1;
+}
+
+// Returns the entry holding key within a snapshot, or NULL if the key is absent
+static const uint8_t *_dsc_hmap_snapshot_find(
+    const Snapshot_t* const snap,
+    const HMapSnapshot_t* const hdr,
+    const void* const key
+) {
+    const HMapSlot_t *slots = (const HMapSlot_t*)(snap->base + hdr->slots_off);
+    const size_t klen = (hdr->ksize != 0) ? hdr->ksize : strlen((const char*)key) + 1;
+    const uint32_t hash = fnv1a_hash(key, klen);
+    const size_t mask = hdr->nslots - 1;
+
+    for (size_t n = 0, idx = hash & mask; n < hdr->nslots; ++n, idx = (idx + 1) & mask) {
+        const HMapSlot_t slot = slots[idx];
+        if (slot.off == 0) {
+            return NULL;
+        } else if (slot.hash == hash && slot.klen == klen
+            && _dsc_hmap_snapshot_entry_ok(snap, hdr, &slot)
+            && memcmp(snap->base + slot.off, key, klen) == 0
+        ) {
+            return snap->base + slot.off;
+        }
+    }
+
+    return NULL;
+}
+
+static const void *_dsc_hmap_bulk_key(const HMapBulk_t* const job, const size_t i) {
+    return _dsc_hmap_key_at(job->map, job->keys, i);
+}
+
+static size_t _dsc_hmap_bulk_region(const HMapBulk_t* const job, const uint32_t hash) {
+    return (size_t)(((uint64_t)(hash & (job->map->nelem - 1)) * job->nthreads) / job->map->nelem);
+}
+
+static void _dsc_hmap_bulk_share(const HMapBulk_t* const job, const size_t idx, size_t *lo, size_t *hi) {
+    *lo = job->n * idx / job->nthreads;
+    *hi = job->n * (idx + 1) / job->nthreads;
+}
+
+// Pass 1: hash each key of this thread's share and count how many land in each region
+static void _dsc_hmap_bulk_hash(void *ctx, const size_t idx, const size_t nthreads) {
+    HMapBulk_t *job = ctx;
+    size_t lo, hi;
+
+    _dsc_hmap_bulk_share(job, idx, &lo, &hi);
+    for (size_t i = lo; i < hi; ++i) {
+        const void *key = _dsc_hmap_bulk_key(job, i);
+        job->hashes[i] = job->map->hash(key, _dsc_hmap_klen(job->map, key));
+        ++job->counts[idx * nthreads + _dsc_hmap_bulk_region(job, job->hashes[i])];
+    }
+}
+
+// Pass 2: scatter the indices of this thread's share into the groups of their regions
+static void _dsc_hmap_bulk_scatter(void *ctx, const size_t idx, const size_t nthreads) {
+    HMapBulk_t *job = ctx;
+    size_t *offsets = &job->counts[idx * nthreads];
+    size_t lo, hi;
+
+    _dsc_hmap_bulk_share(job, idx, &lo, &hi);
+    for (size_t i = lo; i < hi; ++i) {
+        job->order[offsets[_dsc_hmap_bulk_region(job, job->hashes[i])]++] = i;
+    }
+}
+
+// Pass 3: insert the entries homed in region idx without leaving the region
+static void _dsc_hmap_bulk_insert(void *ctx, const size_t idx, const size_t nthreads) {
+    HMapBulk_t *job = ctx;
+    Map_t *map = job->map;
+    const size_t mask = map->nelem - 1;
+    // Region idx holds the slots s with floor(s * nthreads / nelem) == idx
+    const size_t slot_hi = (map->nelem * (idx + 1) + nthreads - 1) / nthreads;
+    // After pass 2, counts[(nthreads - 1) * nthreads + idx] is one past the end of this region's group
+    const size_t end = job->counts[(nthreads - 1) * nthreads + idx];
+    const size_t begin = (idx == 0) ? 0 : job->counts[(nthreads - 1) * nthreads + idx - 1];
+    size_t added = 0, reused = 0, deferred = 0;
+
+    for (size_t o = begin; o < end; ++o) {
+        const size_t i = job->order[o];
+        const void *key = _dsc_hmap_bulk_key(job, i);
+        size_t slot = job->hashes[i] & mask;
+        size_t tomb = map->nelem;
+        bool dup = false;
+
+        while (slot < slot_hi && map->base[slot].key != NULL) {
+            if (map->base[slot].key == DSC_HMAP_TOMBSTONE) {
+                tomb = (tomb == map->nelem) ? slot : tomb;
+            } else if (_dsc_hmap_key_eq(map, map->base[slot].key, key)) {
+                dup = true;
+                break;
+            }
+            ++slot; // Never wraps, since the last region ends at the last slot
+        }
+
+        if (dup) {
+            __atomic_store_n(&job->status, DSC_EINVAL, __ATOMIC_RELAXED);
+            continue;
+        } else if (slot == slot_hi) {
+            // The probe sequence continues in the next region (or wraps), which another thread owns
+            job->order[begin + deferred++] = i;
+            continue;
+        }
+
+        const size_t klen = _dsc_hmap_klen(map, key);
+        const size_t voff = _dsc_hmap_voff(klen);
+        uint8_t *entry = dsc_alloc(map->alloc, voff + map->vsize);
+        if (entry == NULL) {
+            __atomic_store_n(&job->status, DSC_ENOMEM, __ATOMIC_RELAXED);
+            break;
+        }
+        memcpy(entry, key, klen);
+        if (job->values != NULL) {
+            memcpy(entry + voff, job->values + i * map->vsize, map->vsize);
+        }
+
+        if (tomb != map->nelem) {
+            slot = tomb;
+            ++reused;
+        }
+        map->base[slot].key = entry;
+        map->base[slot].value = entry + voff;
+        ++added;
+    }
+
+    job->added[idx] = added;
+    job->reused[idx] = reused;
+    job->deferred[idx] = deferred;
+}
+
+static DscError_t _dsc_hmap_rehash(Map_t *map, const size_t nelem) {
+    KV_t *base = dsc_calloc(map->alloc, nelem, sizeof(KV_t));
+    if (base == NULL) {
+        DSC_LOG("Failed to allocate memory for dsc hash map", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    for (size_t i = 0; i < map->nelem; ++i) {
+        const KV_t kv = map->base[i];
+        if (kv.key != NULL && kv.key != DSC_HMAP_TOMBSTONE) {
+            _dsc_hmap_place(map, base, nelem, kv);
+        }
+    }
+
+    dsc_free(map->alloc, map->base, map->nelem * sizeof(KV_t));
+    map->base = base;
+    map->nelem = nelem;
+    map->ntomb = 0;
+    DSC_STATS_ADD(map->alloc, resizes, 1);
+
+    return DSC_EOK;
+}
+
+static DscError_t _dsc_hmap_resize(Map_t *map, const size_t nelem) {
+    // Updates drain a resize long before the next one is due, so this only finishes a short tail
+    _dsc_hmap_migrate(map, SIZE_MAX);
+    if (map->resize == RESIZE_BLOCKING) {
+        return _dsc_hmap_rehash(map, nelem);
+    }
+
+    KV_t *base = dsc_calloc(map->alloc, nelem, sizeof(KV_t));
+    if (base == NULL) {
+        DSC_LOG("Failed to allocate memory for dsc hash map", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    map->old_base = map->base;
+    map->old_nelem = map->nelem;
+    map->migrated = 0;
+    map->base = base;
+    map->nelem = nelem;
+    map->ntomb = 0;
+    DSC_STATS_ADD(map->alloc, resizes, 1);
+
+    return DSC_EOK;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Initializes a hash map.
+ * @since 06-09-2025
+ * @param[in/out] map The Map_t object to be initialized
+ * @param[in] nelem The initial number of slots (rounded up to a power of two)
+ * @param[in] ksize The size (in bytes) of each key, or 0 if keys are NUL-terminated strings
+ * @param[in] vsize The size (in bytes) of each value
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_hmap_init(Map_t *map, const size_t nelem, const size_t ksize, const size_t vsize) {
+    return dsc_hmap_init_alloc(map, nelem, ksize, vsize, NULL);
+}
+
+/**
+ * @brief Initializes a hash map whose slots and entries come from a custom allocator.
+ * @since 19-10-2026
+ * @param[in/out] map The Map_t object to be initialized
+ * @param[in] nelem The initial number of slots (rounded up to a power of two)
+ * @param[in] ksize The size (in bytes) of each key, or 0 if keys are NUL-terminated strings
+ * @param[in] vsize The size (in bytes) of each value
+ * @param[in] alloc The allocator used for the lifetime of the map (NULL for malloc)
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_hmap_init_alloc(
+    Map_t *map,
+    const size_t nelem,
+    const size_t ksize,
+    const size_t vsize,
+    const DscAllocator_t *alloc
+) {
+    if (map == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    map->alloc = alloc;
+    map->nelem = _dsc_hmap_next_pow2(nelem);
+    map->base = dsc_calloc(alloc, map->nelem, sizeof(KV_t));
+    if (map->base == NULL) {
+        DSC_LOG("Failed to allocate memory for dsc hash map", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+    map->count = 0;
+    map->ntomb = 0;
+    map->ksize = ksize;
+    map->vsize = vsize;
+    map->resize = RESIZE_BLOCKING;
+    map->hash = fnv1a_hash;
+    map->old_base = NULL;
+    map->old_nelem = 0;
+    map->migrated = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Replaces the function used to hash keys (fnv1a_hash() by default). Keys that are
+ * already well mixed, such as precomputed hashes or IDs from an Intern_t, can use int_hash() or a
+ * function of the caller's own. Snapshots always use fnv1a_hash(), so they are unaffected.
+ * @since 19-10-2026
+ * @param[in] map The map being configured, which must be empty
+ * @param[in] hash The hash function (NULL for fnv1a_hash())
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_hmap_set_hash(Map_t *map, const hash_func hash) {
+    if (map == NULL || map->base == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (map->count != 0 || map->ntomb != 0 || map->old_base != NULL) {
+        DSC_LOG("The hash function can only be replaced while the map is empty", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    map->hash = (hash != NULL) ? hash : fnv1a_hash;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Selects how the map grows. With RESIZE_INCREMENTAL, the insert that passes the load
+ * factor only allocates the larger slot array, and every later update moves a bounded number of
+ * slots across, so no single insert pays for moving the whole map. Lookups check both arrays
+ * until the move completes.
+ * @since 19-10-2026
+ * @param[in] map The map being configured
+ * @param[in] resize The growth policy
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_hmap_set_resize(Map_t *map, const MapResize_t resize) {
+    if (map == NULL || map->base == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    if (resize == RESIZE_BLOCKING) {
+        _dsc_hmap_migrate(map, SIZE_MAX);
+    }
+    map->resize = resize;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Frees every entry in the map along with the slot array.
+ * @since 06-09-2025
+ * @param[in] map The map being destroyed
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_hmap_destroy(Map_t *map) {
+    if (map == NULL || map->base == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    _dsc_hmap_free_entries(map, map->base, map->nelem);
+    dsc_free(map->alloc, map->base, map->nelem * sizeof(KV_t));
+    if (map->old_base != NULL) {
+        _dsc_hmap_free_entries(map, map->old_base, map->old_nelem);
+        dsc_free(map->alloc, map->old_base, map->old_nelem * sizeof(KV_t));
+    }
+
+    map->base = NULL;
+    map->old_base = NULL;
+    map->old_nelem = 0;
+    map->migrated = 0;
+    map->nelem = 0;
+    map->count = 0;
+    map->ntomb = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Copies a new key/value pair into the map.
+ * @since 06-09-2025
+ * @param[in] map The map the entry is added to
+ * @param[in] key A pointer to the key
+ * @param[in] value A pointer to the value
+ * @returns DSC_EINVAL if the key is already present, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_hmap_add_entry(Map_t *map, const void* const key, const void* const value) {
+    size_t slot = 0;
+
+    if (map == NULL || map->base == NULL || key == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    _dsc_hmap_migrate(map, DSC_HMAP_MIGRATE);
+
+    // Keep the load factor (live entries and tombstones) at or below 3/4
+    if ((map->count + map->ntomb + 1) * 4 > map->nelem * 3) {
+        const size_t nelem = ((map->count + 1) * 2 > map->nelem) ? map->nelem * 2 : map->nelem;
+        DscError_t status = _dsc_hmap_resize(map, nelem);
+        if (status != DSC_EOK) {
+            return status;
+        }
+    }
+
+    const size_t klen = _dsc_hmap_klen(map, key);
+    if (_dsc_hmap_find(map, key, klen, &slot) != map->nelem
+        || (map->old_base != NULL
+            && _dsc_hmap_probe(map, map->old_base, map->old_nelem, key, klen, NULL) != map->old_nelem)
+    ) {
+        return DSC_EINVAL;
+    }
+
+    const size_t voff = _dsc_hmap_voff(klen);
+    uint8_t *entry = dsc_alloc(map->alloc, voff + map->vsize);
+    if (entry == NULL) {
+        DSC_LOG("Failed to allocate memory for dsc hash map entry", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+    memcpy(entry, key, klen);
+    if (value != NULL) {
+        memcpy(entry + voff, value, map->vsize);
+    }
+
+    if (map->base[slot].key == DSC_HMAP_TOMBSTONE) {
+        --map->ntomb;
+    }
+    map->base[slot].key = entry;
+    map->base[slot].value = entry + voff;
+    ++map->count;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Overwrites the value of an existing entry.
+ * @since 06-09-2025
+ * @param[in] map The map containing the entry
+ * @param[in] key A pointer to the key
+ * @param[in] value A pointer to the new value
+ * @returns DSC_ENODATA if the key is not present, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_hmap_replace_entry(Map_t *map, const void* const key, const void* const value) {
+    if (map == NULL || map->base == NULL || key == NULL || value == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    bool in_old;
+    _dsc_hmap_migrate(map, DSC_HMAP_MIGRATE);
+    KV_t *kv = _dsc_hmap_lookup(map, key, _dsc_hmap_klen(map, key), &in_old);
+    if (kv == NULL) {
+        return DSC_ENODATA;
+    }
+    memcpy(kv->value, value, map->vsize);
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Removes an entry from the map.
+ * @since 06-09-2025
+ * @param[in] map The map containing the entry
+ * @param[in] key A pointer to the key
+ * @returns DSC_ENODATA if the key is not present, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_hmap_remove_entry(Map_t *map, const void* const key) {
+    if (map == NULL || map->base == NULL || key == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    bool in_old;
+    _dsc_hmap_migrate(map, DSC_HMAP_MIGRATE);
+    KV_t *kv = _dsc_hmap_lookup(map, key, _dsc_hmap_klen(map, key), &in_old);
+    if (kv == NULL) {
+        return DSC_ENODATA;
+    }
+
+    dsc_free(map->alloc, kv->key, _dsc_hmap_entry_size(map, kv->key));
+    kv->key = DSC_HMAP_TOMBSTONE;
+    kv->value = NULL;
+    --map->count;
+    if (!in_old) {
+        ++map->ntomb;
+    }
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Retrieves the value associated with key.
+ * @since 06-09-2025
+ * @param[in] map The map being searched
+ * @param[in] key A pointer to the key
+ * @returns A Buffer_t that views the stored value in place, or one whose base is NULL if
+ *          the key is not present
+ */
+Buffer_t dsc_hmap_retrieve_value(const Map_t* const map, const void* const key) {
+    Buffer_t buf = { 0 };
+
+    if (map == NULL || map->base == NULL || key == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return buf;
+    }
+
+    bool in_old;
+    const KV_t *kv = _dsc_hmap_lookup(map, key, _dsc_hmap_klen(map, key), &in_old);
+    if (kv != NULL) {
+        buf.base = kv->value;
+        buf.tsize = sizeof(uint8_t);
+        buf.bsize = map->vsize;
+    }
+
+    return buf;
+}
+
+/**
+ * @brief Checks whether the map contains key.
+ * @since 06-09-2025
+ * @param[in] map The map being searched
+ * @param[in] key A pointer to the key
+ * @returns True if the key is present, otherwise false
+ */
+bool dsc_hmap_contains_key(const Map_t* const map, const void* const key) {
+    if (map == NULL || map->base == NULL || key == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return false;
+    }
+
+    bool in_old;
+    return _dsc_hmap_lookup(map, key, _dsc_hmap_klen(map, key), &in_old) != NULL;
+}
+
+/**
+ * @brief Looks up n keys at once. The keys are hashed and their slots prefetched in small groups
+ * before any of them is probed, so this is considerably faster than n calls to
+ * dsc_hmap_retrieve_value() once the map no longer fits in cache.
+ * @since 19-10-2026
+ * @param[in] map The map being searched
+ * @param[in] keys The packed keys, or an array of const char * if the map has string keys
+ * @param[in] n The number of keys
+ * @param[out] values Receives a pointer to the stored value of each key, or NULL if it is absent.
+ *             Values are viewed in place, so the pointers are valid until the map is next modified
+ * @returns The number of keys that are present
+ */
+size_t dsc_hmap_retrieve_many(const Map_t* const map, const void* const keys, const size_t n, void **values) {
+    if (map == NULL || map->base == NULL || ((keys == NULL || values == NULL) && n != 0)) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return 0;
+    }
+
+    return _dsc_hmap_lookup_many(map, keys, n, values, NULL);
+}
+
+/**
+ * @brief Checks whether the map contains each of n keys. As with dsc_hmap_retrieve_many(), the
+ * lookups are batched so that their cache misses overlap.
+ * @since 19-10-2026
+ * @param[in] map The map being searched
+ * @param[in] keys The packed keys, or an array of const char * if the map has string keys
+ * @param[in] n The number of keys
+ * @param[out] found Receives true for each key that is present, otherwise false
+ * @returns The number of keys that are present
+ */
+size_t dsc_hmap_contains_many(const Map_t* const map, const void* const keys, const size_t n, bool *found) {
+    if (map == NULL || map->base == NULL || ((keys == NULL || found == NULL) && n != 0)) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return 0;
+    }
+
+    return _dsc_hmap_lookup_many(map, keys, n, NULL, found);
+}
+
+/**
+ * @brief Checks whether any entry of the map holds value. This is a linear scan.
+ * @since 06-09-2025
+ * @param[in] map The map being searched
+ * @param[in] value A pointer to the value
+ * @returns True if the value is present, otherwise false
+ */
+bool dsc_hmap_contains_value(const Map_t* const map, const void* const value) {
+    if (map == NULL || map->base == NULL || value == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return false;
+    }
+
+    for (size_t i = 0; i < map->nelem + map->old_nelem; ++i) {
+        const KV_t *kv = _dsc_hmap_slot(map, i);
+        if (kv->key != NULL && kv->key != DSC_HMAP_TOMBSTONE
+            && memcmp(kv->value, value, map->vsize) == 0
+        ) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Collects the next entries of the map, in slot order, starting from slot *pos. Visiting
+ * every entry takes repeated calls with *pos starting at 0 until one returns 0. Entries still in
+ * the slot array being drained by an incremental resize are visited after the others. The map
+ * must not be updated in between calls.
+ * @since 19-10-2026
+ * @param[in] map The map being walked
+ * @param[in/out] pos The slot to resume from; advanced past the last slot examined
+ * @param[out] entries Receives a pointer to each entry found
+ * @param[in] max The capacity of entries
+ * @returns The number of entries stored, which is 0 once every entry has been visited
+ */
+size_t dsc_hmap_next_entries(const Map_t* const map, size_t *pos, const KV_t **entries, const size_t max) {
+    size_t n = 0;
+
+    if (map == NULL || map->base == NULL || pos == NULL || entries == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return 0;
+    }
+
+    size_t i = *pos;
+    const size_t nslots = map->nelem + map->old_nelem;
+    for (; i < nslots && n < max; ++i) {
+        const KV_t *kv = _dsc_hmap_slot(map, i);
+        if (kv->key != NULL && kv->key != DSC_HMAP_TOMBSTONE) {
+            // The caller reads the entries after the whole batch is collected, so their misses overlap
+            __builtin_prefetch(kv->key);
+            entries[n++] = kv;
+        }
+    }
+    *pos = i;
+
+    return n;
+}
+
+/**
+ * @brief Writes the map to a snapshot file that can later be mapped with dsc_snapshot_open() and
+ * queried in place. The file is written beside path and renamed over it once complete.
+ * @since 19-10-2026
+ * @param[in] map The map being saved
+ * @param[in] path The path of the snapshot file
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_hmap_save(const Map_t* const map, const char *path) {
+    static const uint8_t zeros[DSC_HMAP_ALIGN] = { 0 };
+    HMapSnapshot_t hdr;
+    char *tmp_path = NULL;
+    bool ok = true;
+
+    if (map == NULL || map->base == NULL || path == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const size_t nslots = _dsc_hmap_next_pow2(map->count * 2);
+    const size_t mask = nslots - 1;
+    HMapSlot_t *slots = calloc(nslots, sizeof(HMapSlot_t));
+    if (slots == NULL) {
+        DSC_LOG("Failed to allocate memory for hash map snapshot", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    // Entries are written in slot order, so their offsets are known before anything is written
+    uint64_t off = sizeof(hdr) + nslots * sizeof(HMapSlot_t);
+    for (size_t i = 0; i < map->nelem + map->old_nelem; ++i) {
+        const void *key = _dsc_hmap_slot(map, i)->key;
+        if (key == NULL || key == DSC_HMAP_TOMBSTONE) {
+            continue;
+        }
+
+        const size_t klen = _dsc_hmap_klen(map, key);
+        const uint32_t hash = fnv1a_hash(key, klen);
+        size_t idx = hash & mask;
+        while (slots[idx].off != 0) {
+            idx = (idx + 1) & mask;
+        }
+        slots[idx].hash = hash;
+        slots[idx].klen = (uint32_t)klen;
+        slots[idx].off = off;
+        off += _dsc_hmap_stride(klen, map->vsize);
+    }
+
+    memset(&hdr, 0, sizeof(hdr));
+    _dsc_snapshot_header(&hdr.hdr, SNAPSHOT_HMAP, off);
+    hdr.nslots = nslots;
+    hdr.count = map->count;
+    hdr.ksize = map->ksize;
+    hdr.vsize = map->vsize;
+    hdr.slots_off = sizeof(hdr);
+
+    FILE *file = _dsc_snapshot_create(path, &tmp_path);
+    if (file == NULL) {
+        free(slots);
+        return DSC_EFAIL;
+    }
+
+    ok = fwrite(&hdr, sizeof(hdr), 1, file) == 1
+        && fwrite(slots, sizeof(HMapSlot_t), nslots, file) == nslots;
+    for (size_t i = 0; ok && i < map->nelem + map->old_nelem; ++i) {
+        const KV_t *kv = _dsc_hmap_slot(map, i);
+        const void *key = kv->key;
+        if (key == NULL || key == DSC_HMAP_TOMBSTONE) {
+            continue;
+        }
+
+        const size_t klen = _dsc_hmap_klen(map, key);
+        const size_t voff = _dsc_hmap_voff(klen);
+        const size_t pad = _dsc_hmap_stride(klen, map->vsize) - voff - map->vsize;
+        ok = fwrite(key, 1, klen, file) == klen
+            && fwrite(zeros, 1, voff - klen, file) == voff - klen
+            && fwrite(kv->value, 1, map->vsize, file) == map->vsize
+            && fwrite(zeros, 1, pad, file) == pad;
+    }
+    free(slots);
+
+    return _dsc_snapshot_commit(file, tmp_path, path, ok);
+}
+
+/**
+ * @brief Rebuilds a mutable map from a snapshot. Use this only when the map must be modified;
+ * read-only lookups can be served from the snapshot directly.
+ * @since 19-10-2026
+ * @param[out] map The Map_t object to be initialized
+ * @param[in] snap A snapshot written by dsc_hmap_save()
+ * @param[in] alloc The allocator used for the lifetime of the map (NULL for malloc)
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_hmap_load(Map_t *map, const Snapshot_t* const snap, const DscAllocator_t *alloc) {
+    const HMapSnapshot_t *hdr = _dsc_hmap_snapshot(snap);
+    if (hdr == NULL) {
+        return DSC_EINVAL;
+    }
+
+    // Sized so that the map does not rehash while it is being filled
+    DscError_t status = dsc_hmap_init_alloc(map, (size_t)hdr->count * 2, hdr->ksize, hdr->vsize, alloc);
+    if (status != DSC_EOK) {
+        return status;
+    }
+
+    const HMapSlot_t *slots = (const HMapSlot_t*)(snap->base + hdr->slots_off);
+    for (size_t i = 0; i < hdr->nslots; ++i) {
+        const HMapSlot_t slot = slots[i];
+        if (slot.off == 0) {
+            continue;
+        } else if (!_dsc_hmap_snapshot_entry_ok(snap, hdr, &slot)) {
+            DSC_LOG("The hash map snapshot is corrupt", DSC_ERROR);
+            status = DSC_EINVAL;
+        } else {
+            const uint8_t *entry = snap->base + slot.off;
+            status = dsc_hmap_add_entry(map, entry, entry + _dsc_hmap_voff(slot.klen));
+        }
+
+        if (status != DSC_EOK) {
+            dsc_hmap_destroy(map);
+            return status;
+        }
+    }
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Retrieves the value associated with key directly from a snapshot.
+ * @since 19-10-2026
+ * @param[in] snap A snapshot written by dsc_hmap_save()
+ * @param[in] key A pointer to the key
+ * @returns A Buffer_t that views the value inside the snapshot, or one whose base is NULL if
+ *          the key is not present
+ */
+Buffer_t dsc_hmap_snapshot_retrieve_value(const Snapshot_t* const snap, const void* const key) {
+    Buffer_t buf = { 0 };
+
+    const HMapSnapshot_t *hdr = _dsc_hmap_snapshot(snap);
+    if (hdr == NULL || key == NULL) {
+        return buf;
+    }
+
+    const uint8_t *entry = _dsc_hmap_snapshot_find(snap, hdr, key);
+    if (entry != NULL) {
+        const size_t klen = (hdr->ksize != 0) ? hdr->ksize : strlen((const char*)key) + 1;
+        buf.base = (void*)(entry + _dsc_hmap_voff(klen));
+        buf.tsize = sizeof(uint8_t);
+        buf.bsize = hdr->vsize;
+    }
+
+    return buf;
+}
+
+/**
+ * @brief Checks whether a snapshot contains key.
+ * @since 19-10-2026
+ * @param[in] snap A snapshot written by dsc_hmap_save()
+ * @param[in] key A pointer to the key
+ * @returns True if the key is present, otherwise false
+ */
+bool dsc_hmap_snapshot_contains_key(const Snapshot_t* const snap, const void* const key) {
+    const HMapSnapshot_t *hdr = _dsc_hmap_snapshot(snap);
+    if (hdr == NULL || key == NULL) {
+        return false;
+    }
+
+    return _dsc_hmap_snapshot_find(snap, hdr, key) != NULL;
+}
+
+/**
+ * @brief Copies n key/value pairs into the map using several threads. Keys are first grouped by
+ * the region of the slot array that they hash to, then each thread fills one region, so threads
+ * never contend for a slot. The allocator is called from every thread, so it must be
+ * thread-safe; maps whose allocator has stats attached are filled serially.
+ * @since 19-10-2026
+ * @param[in] map The map the entries are added to
+ * @param[in] keys The packed keys, or an array of const char * if the map has string keys
+ * @param[in] values The packed values, in the same order as keys (may be NULL)
+ * @param[in] n The number of entries
+ * @param[in] nthreads The number of threads, or 0 for one per online CPU
+ * @returns DSC_EINVAL if any key was already present (every other entry is still added),
+ *          DSC_ENOMEM if the threads could not be set up (no entry is added), otherwise a
+ *          DscError_t exit status code
+ */
+DscError_t dsc_hmap_add_many(
+    Map_t *map,
+    const void* const keys,
+    const void* const values,
+    const size_t n,
+    const size_t nthreads
+) {
+    HMapBulk_t job = {
+        .map = map, .keys = keys, .values = values, .n = n, .nthreads = dsc_parallel_nthreads(nthreads)
+    };
+    DscError_t status = DSC_EOK;
+
+    if (map == NULL || map->base == NULL || (keys == NULL && n != 0)) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    // Size the table for every entry up front, so that the workers never need to grow it
+    _dsc_hmap_migrate(map, SIZE_MAX);
+    if ((map->count + map->ntomb + n + 1) * 4 > map->nelem * 3) {
+        status = _dsc_hmap_rehash(map, _dsc_hmap_next_pow2((map->count + n + 1) * 2));
+        if (status != DSC_EOK) {
+            return status;
+        }
+    }
+
+    if (job.nthreads > map->nelem / DSC_HMAP_MIN_SLOTS) {
+        job.nthreads = map->nelem / DSC_HMAP_MIN_SLOTS;
+    }
+    if (n / job.nthreads < DSC_HMAP_MIN_BULK || (map->alloc != NULL && map->alloc->stats != NULL)) {
+        for (size_t i = 0; i < n; ++i) {
+            const void *value = (values != NULL) ? (const uint8_t*)values + i * map->vsize : NULL;
+            const DscError_t added = dsc_hmap_add_entry(map, _dsc_hmap_bulk_key(&job, i), value);
+            if (added != DSC_EOK && status != DSC_ENOMEM) {
+                status = added;
+            }
+        }
+        return status;
+    }
+
+    const size_t t = job.nthreads;
+    job.hashes = dsc_alloc(map->alloc, n * sizeof(uint32_t));
+    job.order = dsc_alloc(map->alloc, n * sizeof(size_t));
+    job.counts = dsc_calloc(map->alloc, t * t, sizeof(size_t));
+    job.added = dsc_calloc(map->alloc, t * 3, sizeof(size_t));
+    if (job.hashes == NULL || job.order == NULL || job.counts == NULL || job.added == NULL) {
+        DSC_LOG("Failed to allocate memory for dsc hash map bulk insert", DSC_ERROR);
+        status = DSC_ENOMEM;
+        goto out;
+    }
+    job.reused = job.added + t;
+    job.deferred = job.added + 2 * t;
+
+    // Each phase needs the previous one to have run; the map is untouched until the insert phase
+    if (dsc_parallel_run(_dsc_hmap_bulk_hash, &job, t) != DSC_EOK) {
+        status = DSC_ENOMEM;
+        goto out;
+    }
+
+    // Turn the counts into starting offsets, region-major so that each region's group is contiguous
+    size_t offset = 0;
+    for (size_t r = 0; r < t; ++r) {
+        for (size_t w = 0; w < t; ++w) {
+            const size_t count = job.counts[w * t + r];
+            job.counts[w * t + r] = offset;
+            offset += count;
+        }
+    }
+    if (dsc_parallel_run(_dsc_hmap_bulk_scatter, &job, t) != DSC_EOK
+        || dsc_parallel_run(_dsc_hmap_bulk_insert, &job, t) != DSC_EOK
+    ) {
+        status = DSC_ENOMEM;
+        goto out;
+    }
+
+    status = (DscError_t)job.status;
+    for (size_t r = 0; r < t; ++r) {
+        map->count += job.added[r];
+        map->ntomb -= job.reused[r];
+    }
+
+    // Entries whose probe sequence left their region go in one at a time
+    for (size_t r = 0; r < t && status != DSC_ENOMEM; ++r) {
+        const size_t begin = (r == 0) ? 0 : job.counts[(t - 1) * t + r - 1];
+        for (size_t o = begin; o < begin + job.deferred[r]; ++o) {
+            const size_t i = job.order[o];
+            const void *value = (values != NULL) ? (const uint8_t*)values + i * map->vsize : NULL;
+            const DscError_t added = dsc_hmap_add_entry(map, _dsc_hmap_bulk_key(&job, i), value);
+            if (added != DSC_EOK && status != DSC_ENOMEM) {
+                status = added;
+            }
+        }
+    }
 
+out:
+    dsc_free(map->alloc, job.hashes, n * sizeof(uint32_t));
+    dsc_free(map->alloc, job.order, n * sizeof(size_t));
+    dsc_free(map->alloc, job.counts, t * t * sizeof(size_t));
+    dsc_free(map->alloc, job.added, t * 3 * sizeof(size_t));
 
+    return status;
+}
@@ -0,0 +1,269 @@
+/**
+ * @file intern.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a string interning pool that maps each distinct string to a stable 32-bit ID.
+*/
+
+#include "intern.h"
+
+#define DSC_INTERN_MIN_SLOTS 16
+#define DSC_INTERN_AVG_LEN   16 // Bytes per string assumed when sizing the arena up front
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static inline uint32_t *_dsc_intern_offs(const Intern_t* const pool) {
+    return (uint32_t*)pool->offs.base;
+}
+
+static inline uint64_t *_dsc_intern_index(const Intern_t* const pool) {
+    return (uint64_t*)pool->index.base;
+}
+
+// Index slots keep the hash next to the ID, so mismatches are rejected without touching the arena
+static inline uint64_t _dsc_intern_slot(const uint32_t hash, const uint32_t id) {
+    return ((uint64_t)hash << 32) | ((uint64_t)id + 1);
+}
+
+/**
+ * Returns the index slot holding str, or the empty slot where it belongs if it is absent. The
+ * index is at most half full, so the probe always ends.
+ */
+static size_t _dsc_intern_probe(const Intern_t* const pool, const char *str, const uint32_t hash) {
+    const uint64_t *index = _dsc_intern_index(pool);
+    const char *chars = pool->chars.base;
+    size_t idx = hash & pool->mask;
+
+    for (; index[idx] != 0; idx = (idx + 1) & pool->mask) {
+        if ((uint32_t)(index[idx] >> 32) == hash) {
+            const uint32_t id = (uint32_t)index[idx] - 1;
+            if (strcmp(chars + _dsc_intern_offs(pool)[id], str) == 0) {
+                break;
+            }
+        }
+    }
+
+    return idx;
+}
+
+// Doubles the index and re-inserts every slot using the hash it holds
+static DscError_t _dsc_intern_grow_index(Intern_t *pool) {
+    const size_t old_nslots = pool->mask + 1;
+    const size_t nslots = old_nslots * 2;
+    Buffer_t old = pool->index;
+
+    if (dsc_buf_init_alloc(&pool->index, nslots, sizeof(uint64_t), old.alloc) != DSC_EOK) {
+        pool->index = old;
+        return DSC_ENOMEM;
+    }
+    dsc_buf_fill(&pool->index, 0);
+    pool->mask = nslots - 1;
+
+    uint64_t *index = _dsc_intern_index(pool);
+    for (size_t i = 0; i < old_nslots; ++i) {
+        const uint64_t slot = ((const uint64_t*)old.base)[i];
+        if (slot == 0) {
+            continue;
+        }
+        size_t idx = (size_t)(slot >> 32) & pool->mask;
+        while (index[idx] != 0) {
+            idx = (idx + 1) & pool->mask;
+        }
+        index[idx] = slot;
+    }
+    dsc_buf_destroy(&old);
+
+    return DSC_EOK;
+}
+
+// Makes room for one more string of len bytes (including its terminator)
+static DscError_t _dsc_intern_reserve(Intern_t *pool, const size_t len) {
+    if (pool->count >= UINT32_MAX - 1 || pool->used + len > UINT32_MAX) {
+        DSC_LOG("The intern pool is full", DSC_ERROR);
+        return DSC_EOVERFLOW;
+    }
+
+    size_t cap = pool->chars.bsize;
+    if (pool->used + len > cap) {
+        while (pool->used + len > cap) {
+            cap *= 2;
+        }
+        if (dsc_buf_resize(&pool->chars, cap) != DSC_EOK) {
+            return DSC_ENOMEM;
+        }
+    }
+
+    cap = dsc_buf_nelem(&pool->offs);
+    if (pool->count == cap
+        && dsc_buf_resize(&pool->offs, cap * 2) != DSC_EOK
+    ) {
+        return DSC_ENOMEM;
+    }
+
+    if ((pool->count + 1) * 2 > pool->mask + 1) {
+        return _dsc_intern_grow_index(pool);
+    }
+
+    return DSC_EOK;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Initializes an empty pool sized for an expected number of strings. The pool grows as
+ * needed, so nstrings is only a hint.
+ * @since 19-10-2026
+ * @param[out] pool The pool
+ * @param[in] nstrings The number of strings the pool is sized for
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_intern_init(Intern_t *pool, const size_t nstrings) {
+    return dsc_intern_init_alloc(pool, nstrings, NULL);
+}
+
+/**
+ * @brief Initializes an empty pool whose storage comes from alloc.
+ * @since 19-10-2026
+ * @param[out] pool The pool
+ * @param[in] nstrings The number of strings the pool is sized for
+ * @param[in] alloc The allocator (NULL for malloc)
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_intern_init_alloc(Intern_t *pool, const size_t nstrings, const DscAllocator_t *alloc) {
+    if (pool == NULL) {
+        DSC_LOG("The pool points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    memset(pool, 0, sizeof(Intern_t));
+    const size_t nelem = (nstrings != 0) ? nstrings : 1;
+    size_t nslots = DSC_INTERN_MIN_SLOTS;
+    while (nslots < nelem * 2) {
+        nslots <<= 1;
+    }
+
+    if (dsc_buf_init_alloc(&pool->chars, nelem * DSC_INTERN_AVG_LEN, sizeof(char), alloc) != DSC_EOK
+        || dsc_buf_init_alloc(&pool->offs, nelem, sizeof(uint32_t), alloc) != DSC_EOK
+        || dsc_buf_init_alloc(&pool->index, nslots, sizeof(uint64_t), alloc) != DSC_EOK
+    ) {
+        dsc_buf_destroy(&pool->chars);
+        dsc_buf_destroy(&pool->offs);
+        DSC_LOG("Failed to allocate memory for dsc intern pool", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+    dsc_buf_fill(&pool->index, 0);
+    pool->mask = nslots - 1;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Frees the pool's storage. Every ID and string pointer it handed out becomes invalid.
+ * @since 19-10-2026
+ * @param[in] pool The pool
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_intern_destroy(Intern_t *pool) {
+    if (pool == NULL || pool->index.base == NULL) {
+        DSC_LOG("The pool points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    dsc_buf_destroy(&pool->chars);
+    dsc_buf_destroy(&pool->offs);
+    dsc_buf_destroy(&pool->index);
+    pool->used = 0;
+    pool->count = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Interns str, copying it into the pool if it is not already there.
+ * @since 19-10-2026
+ * @param[in] pool The pool
+ * @param[in] str The NUL-terminated string
+ * @param[out] id Receives the ID of str, which is the same for every call with an equal string
+ * @returns DSC_EOVERFLOW if the pool cannot hold more strings, otherwise a DscError_t exit
+ *          status code
+ */
+DscError_t dsc_intern_add(Intern_t *pool, const char *str, uint32_t *id) {
+    if (pool == NULL || pool->index.base == NULL || str == NULL || id == NULL) {
+        DSC_LOG("The pool points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const size_t len = strlen(str) + 1;
+    const uint32_t hash = murmur3_hash(str, len - 1);
+    size_t idx = _dsc_intern_probe(pool, str, hash);
+    if (_dsc_intern_index(pool)[idx] != 0) {
+        *id = (uint32_t)_dsc_intern_index(pool)[idx] - 1;
+        return DSC_EOK;
+    }
+
+    const size_t nslots = pool->mask + 1;
+    const DscError_t status = _dsc_intern_reserve(pool, len);
+    if (status != DSC_EOK) {
+        return status;
+    } else if (pool->mask + 1 != nslots) {
+        idx = _dsc_intern_probe(pool, str, hash);
+    }
+
+    *id = (uint32_t)pool->count;
+    memcpy((char*)pool->chars.base + pool->used, str, len);
+    _dsc_intern_offs(pool)[*id] = (uint32_t)pool->used;
+    _dsc_intern_index(pool)[idx] = _dsc_intern_slot(hash, *id);
+    pool->used += len;
+    ++pool->count;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Looks up the ID of str without adding it.
+ * @since 19-10-2026
+ * @param[in] pool The pool
+ * @param[in] str The NUL-terminated string
+ * @param[out] id Receives the ID of str
+ * @returns DSC_ENODATA if str has not been interned, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_intern_find(const Intern_t* const pool, const char *str, uint32_t *id) {
+    if (pool == NULL || pool->index.base == NULL || str == NULL || id == NULL) {
+        DSC_LOG("The pool points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const uint64_t slot = _dsc_intern_index(pool)[_dsc_intern_probe(pool, str, murmur3_hash(str, strlen(str)))];
+    if (slot == 0) {
+        return DSC_ENODATA;
+    }
+    *id = (uint32_t)slot - 1;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Returns the string behind an ID. The arena may move when the pool grows, so the
+ * pointer is valid until the next call to dsc_intern_add(); the ID itself never changes.
+ * @since 19-10-2026
+ * @param[in] pool The pool
+ * @param[in] id An ID returned by dsc_intern_add()
+ * @returns The NUL-terminated string, or NULL if id was not handed out by this pool
+ */
+const char *dsc_intern_str(const Intern_t* const pool, const uint32_t id) {
+    if (pool == NULL || pool->index.base == NULL || id >= pool->count) {
+        DSC_LOG("The pool points to an invalid address", DSC_ERROR);
+        return NULL;
+    }
+
+    return (const char*)pool->chars.base + _dsc_intern_offs(pool)[id];
+}
@@ -0,0 +1,248 @@
+/**
+ * @file iter.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a batched iterator that streams element pointers out of any container.
+*/
+
+#include "iter.h"
+#include "hmap.h"
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static size_t _dsc_iter_buf_next(Iter_t *iter, void **elems, const size_t max) {
+    const Buffer_t *buf = iter->src;
+    const size_t nelem = buf->bsize / buf->tsize;
+    size_t n = 0;
+
+    for (; iter->pos < nelem && n < max; ++iter->pos) {
+        elems[n++] = (uint8_t*)buf->base + (iter->pos * buf->tsize);
+    }
+
+    return n;
+}
+
+static size_t _dsc_iter_ll_next(Iter_t *iter, void **elems, const size_t max) {
+    LLNode_t node = iter->node;
+    size_t n = 0;
+
+    for (; node != NULL && n < max; node = node->next) {
+        elems[n++] = node->data;
+    }
+    iter->node = node;
+
+    return n;
+}
+
+static size_t _dsc_iter_dll_next(Iter_t *iter, void **elems, const size_t max) {
+    const DLLNode_t head = (DLLNode_t)iter->src;
+    DLLNode_t node = iter->node;
+    size_t n = 0;
+
+    for (; node != head && n < max; node = node->next) {
+        elems[n++] = node->data;
+    }
+    iter->node = node;
+
+    return n;
+}
+
+static size_t _dsc_iter_hmap_next(Iter_t *iter, void **elems, const size_t max) {
+    const KV_t *entries[DSC_ITER_BATCH];
+    size_t n = 0;
+
+    // Collected a chunk at a time since a const KV_t * may not be stored through a void **
+    while (n < max) {
+        const size_t want = (max - n < DSC_ITER_BATCH) ? max - n : DSC_ITER_BATCH;
+        const size_t got = dsc_hmap_next_entries(iter->src, &iter->pos, entries, want);
+        for (size_t i = 0; i < got; ++i) {
+            elems[n++] = (void*)entries[i];
+        }
+        if (got < want) {
+            break;
+        }
+    }
+
+    return n;
+}
+
+static size_t _dsc_iter_btree_next(Iter_t *iter, void **elems, const size_t max) {
+    size_t n = 0;
+
+    for (; iter->cursor.node != NULL && n < max; dsc_btree_cursor_next(&iter->cursor)) {
+        elems[n++] = iter->cursor.node->data;
+    }
+
+    return n;
+}
+
+static DscError_t _dsc_iter_init(Iter_t *iter, const void* const src, iter_func next) {
+    if (iter == NULL) {
+        DSC_LOG("The iterator points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    memset(iter, 0, sizeof(Iter_t));
+    iter->next = next;
+    iter->src = src;
+
+    return DSC_EOK;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Starts an iterator over the elements of a buffer, in index order.
+ * @since 19-10-2026
+ * @param[out] iter The iterator
+ * @param[in] buf The buffer
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_iter_buf(Iter_t *iter, const Buffer_t* const buf) {
+    if (buf == NULL || buf->base == NULL) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    return _dsc_iter_init(iter, buf, _dsc_iter_buf_next);
+}
+
+/**
+ * @brief Starts an iterator over the elements of a stack, from the bottom to the top.
+ * @since 19-10-2026
+ * @param[out] iter The iterator
+ * @param[in] stack The stack
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_iter_stack(Iter_t *iter, const Stack_t* const stack) {
+    if (stack == NULL) {
+        DSC_LOG("The stack points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+    return dsc_iter_buf(iter, &stack->buf);
+}
+
+/**
+ * @brief Starts an iterator over the data of a singly linked list, from the head onwards.
+ * Unlike calling dsc_ll_peek() for each index, the whole walk is linear.
+ * @since 19-10-2026
+ * @param[out] iter The iterator
+ * @param[in] head The head of the list
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_iter_ll(Iter_t *iter, const LLNode_t head) {
+    if (head == NULL) {
+        DSC_LOG("The node points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const DscError_t status = _dsc_iter_init(iter, head, _dsc_iter_ll_next);
+    if (status == DSC_EOK) {
+        iter->node = head;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Starts an iterator over the data of a doubly linked list, from first to last. The
+ * sentinel head itself is not visited.
+ * @since 19-10-2026
+ * @param[out] iter The iterator
+ * @param[in] head The sentinel head of the list
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_iter_dll(Iter_t *iter, const DLLNode_t head) {
+    if (head == NULL) {
+        DSC_LOG("The node points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const DscError_t status = _dsc_iter_init(iter, head, _dsc_iter_dll_next);
+    if (status == DSC_EOK) {
+        iter->node = head->next;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Starts an iterator over the entries of a map, in no particular order. The iterator
+ * hands back a pointer to each entry's KV_t.
+ * @since 19-10-2026
+ * @param[out] iter The iterator
+ * @param[in] map The map
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_iter_hmap(Iter_t *iter, const Map_t* const map) {
+    if (map == NULL || map->base == NULL) {
+        DSC_LOG("The map points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    return _dsc_iter_init(iter, map, _dsc_iter_hmap_next);
+}
+
+/**
+ * @brief Starts an iterator over the data of a binary tree, in order. Release it with
+ * dsc_iter_destroy().
+ * @since 19-10-2026
+ * @param[out] iter The iterator
+ * @param[in] root The root node of the tree
+ * @returns DSC_ENOMEM if the cursor could not be placed on the first node, otherwise a
+ *          DscError_t exit status code
+ */
+DscError_t dsc_iter_btree(Iter_t *iter, const BTreeNode_t root) {
+    if (root == NULL) {
+        DSC_LOG("The node points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    DscError_t status = _dsc_iter_init(iter, root, _dsc_iter_btree_next);
+    if (status != DSC_EOK) {
+        return status;
+    }
+
+    // An empty walk is only a valid start if the cursor did not run out of memory
+    dsc_btree_cursor_first(&iter->cursor, root);
+    status = iter->cursor.status;
+    if (status != DSC_EOK) {
+        dsc_btree_cursor_destroy(&iter->cursor);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Releases the memory held by an iterator. Only iterators over trees hold any, but
+ * calling this for every iterator is harmless.
+ * @since 19-10-2026
+ * @param[in] iter The iterator
+ * @returns DSC_ENOMEM if a tree iterator ran out of memory and so ended before the last node,
+ *          otherwise a DscError_t exit status code
+ */
+DscError_t dsc_iter_destroy(Iter_t *iter) {
+    if (iter == NULL) {
+        DSC_LOG("The iterator points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    DscError_t status = DSC_EOK;
+    if (iter->next == _dsc_iter_btree_next) {
+        status = iter->cursor.status;
+        dsc_btree_cursor_destroy(&iter->cursor);
+    }
+    iter->next = NULL;
+    iter->node = NULL;
+
+    return status;
+}
@@ -22,15 +22,27 @@
  * @returns The head node of the linked list, which is used by the other APIs
  */
 LLNode_t dsc_ll_create(void* data) {
+    return dsc_ll_create_alloc(data, NULL);
+}
+
+/**
+ * @brief Creates the head node of a singly linked list whose nodes come from a custom allocator.
+ * @since 19-10-2026
+ * @param[in] data Optional data to initialize the head node with
+ * @param[in] alloc The allocator used for every node of the list (NULL for malloc)
+ * @returns The head node of the linked list, which is used by the other APIs
+ */
+LLNode_t dsc_ll_create_alloc(void* data, const DscAllocator_t *alloc) {
     LLNode_t head = NULL;
 
-    head = malloc(sizeof(struct LLNode));
+    head = dsc_alloc(alloc, sizeof(struct LLNode));
     if (head == NULL) {
         DSC_LOG("Failed to allocate memory for dsc linked list node", DSC_ERROR);
         return NULL;
     }
     head->data = data;
     head->next = NULL;
+    head->alloc = alloc;
 
     return head;
 }
@@ -53,9 +65,9 @@ DscError_t dsc_ll_destroy(LLNode_t head) {
     while (iter->next) {
         prev = iter;
         iter = iter->next;
-        free(prev);
+        dsc_free(prev->alloc, prev, sizeof(struct LLNode));
     }
-    free(iter);
+    dsc_free(iter->alloc, iter, sizeof(struct LLNode));
 
     return DSC_EOK;
 }
@@ -80,13 +92,14 @@ DscError_t dsc_ll_append(LLNode_t head, void* data) {
         iter = iter->next;
     }
 
-    new_node = malloc(sizeof(struct LLNode));
+    new_node = dsc_alloc(head->alloc, sizeof(struct LLNode));
     if (new_node == NULL) {
         DSC_LOG("Failed to allocate memory for dsc linked list node", DSC_ERROR);
         return DSC_EFAULT;
     }
     new_node->data = data;
     new_node->next = NULL;
+    new_node->alloc = head->alloc;
 
     iter->next = new_node;
 
@@ -108,9 +121,10 @@ DscError_t dsc_ll_insert(LLNode_t restrict head, const LLNode_t restrict node, c
         return DSC_EINVAL;
     }
 
-    while (iter->next && i++ < idx) {
+    while (iter->next && i < idx) {
         prev = iter;
         iter = iter->next;
+        ++i;
     }
 
     if (i == idx) {
@@ -141,14 +155,15 @@ DscError_t dsc_ll_remove(LLNode_t head, const unsigned idx) {
         return DSC_EINVAL;
     }
 
-    while (iter->next && i++ < idx) {
+    while (iter->next && i < idx) {
         prev = iter;
         iter = iter->next;
+        ++i;
     }
 
     if (i == idx) {
         prev->next = iter->next;
-        dsc_ll_destroy(iter);
+        dsc_free(iter->alloc, iter, sizeof(struct LLNode));
     } else {
         DSC_LOG("Index provided for node removal was outside the bounds of the linked list", DSC_WARNING);
         return DSC_EINVAL;
@@ -173,8 +188,9 @@ LLNode_t dsc_ll_peek(const LLNode_t head, const unsigned idx) {
         return NULL;
     }
 
-    while (iter->next && i++ < idx) {
+    while (iter->next && i < idx) {
         iter = iter->next;
+        ++i;
     }
 
     if (i == idx) {
@@ -0,0 +1,291 @@
+/**
+ * @file packed.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a frame-of-reference bit-packed array of 64-bit integers.
+*/
+
+#include "packed.h"
+
+#define DSC_PACKED_PAD 2 // Zero words after the data, so that every read may touch the next word
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static uint32_t _dsc_packed_width(const uint64_t range) {
+    return (range != 0) ? 64 - (uint32_t)__builtin_clzll(range) : 0;
+}
+
+static uint64_t _dsc_packed_mask(const uint32_t width) {
+    return (width < 64) ? (UINT64_C(1) << width) - 1 : UINT64_MAX;
+}
+
+// Decodes entries [lo, hi) of a block into out
+static void _dsc_packed_decode_scalar(const PackedBlock_t *blk, const uint64_t *words, size_t lo, const size_t hi, uint64_t *out) {
+    const uint64_t mask = _dsc_packed_mask(blk->width);
+
+    for (; lo < hi; ++lo) {
+        const size_t bit = lo * blk->width;
+        const unsigned s = (unsigned)(bit & 63);
+        const uint64_t v = (words[bit >> 6] >> s) | ((words[(bit >> 6) + 1] << 1) << (63 - s));
+        *out++ = blk->base + (v & mask);
+    }
+}
+
+/*
+ * Vector kernel. With AVX2 (checked at runtime) four values are unpacked at once: each lane
+ * gathers the two words its value may span and shifts them into place; a lane whose value
+ * starts on a word boundary shifts its second word out entirely, since AVX2 shifts of 64 or more
+ * give 0. Other CPUs and architectures use the scalar loop.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define DSC_PACKED_SIMD 1
+#include <immintrin.h>
+#else
+#define DSC_PACKED_SIMD 0
+#endif
+
+#if DSC_PACKED_SIMD
+
+__attribute__((target("avx2")))
+static void _dsc_packed_decode_avx2(const PackedBlock_t *blk, const uint64_t *words, size_t lo, const size_t hi, uint64_t *out) {
+    const long long width = (long long)blk->width;
+    const __m256i mask = _mm256_set1_epi64x((long long)_dsc_packed_mask(blk->width));
+    const __m256i base = _mm256_set1_epi64x((long long)blk->base);
+    const __m256i step = _mm256_set1_epi64x(4 * width);
+    const __m256i sixty_four = _mm256_set1_epi64x(64);
+    const __m256i low6 = _mm256_set1_epi64x(63);
+    const __m256i one = _mm256_set1_epi64x(1);
+    __m256i bits = _mm256_setr_epi64x(
+        (long long)lo * width, (long long)(lo + 1) * width, (long long)(lo + 2) * width, (long long)(lo + 3) * width
+    );
+
+    for (; lo + 4 <= hi; lo += 4, out += 4) {
+        const __m256i idx = _mm256_srli_epi64(bits, 6);
+        const __m256i s = _mm256_and_si256(bits, low6);
+        const __m256i first = _mm256_i64gather_epi64((const long long*)words, idx, 8);
+        const __m256i second = _mm256_i64gather_epi64((const long long*)words, _mm256_add_epi64(idx, one), 8);
+        const __m256i v = _mm256_or_si256(
+            _mm256_srlv_epi64(first, s),
+            _mm256_sllv_epi64(second, _mm256_sub_epi64(sixty_four, s))
+        );
+        _mm256_storeu_si256((__m256i*)out, _mm256_add_epi64(_mm256_and_si256(v, mask), base));
+        bits = _mm256_add_epi64(bits, step);
+    }
+
+    _dsc_packed_decode_scalar(blk, words, lo, hi, out);
+}
+
+static bool _dsc_packed_has_avx2(void) {
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif // DSC_PACKED_SIMD
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Compresses an array of values. The values are copied; the array is read-only
+ * afterwards.
+ * @since 19-10-2026
+ * @param[out] arr The packed array
+ * @param[in] values The values
+ * @param[in] nelem The number of values
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_packed_init(PackedArray_t *arr, const uint64_t *values, const size_t nelem) {
+    return dsc_packed_init_alloc(arr, values, nelem, NULL);
+}
+
+/**
+ * @brief Compresses an array of values into storage that comes from alloc.
+ * @since 19-10-2026
+ * @param[out] arr The packed array
+ * @param[in] values The values
+ * @param[in] nelem The number of values
+ * @param[in] alloc The allocator (NULL for malloc)
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_packed_init_alloc(PackedArray_t *arr, const uint64_t *values, const size_t nelem, const DscAllocator_t *alloc) {
+    if (arr == NULL || (values == NULL && nelem != 0)) {
+        DSC_LOG("The packed array points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    memset(arr, 0, sizeof(PackedArray_t));
+    const size_t nblocks = (nelem + DSC_PACKED_BLOCK - 1) / DSC_PACKED_BLOCK;
+    if (dsc_buf_init_alloc(&arr->blocks, (nblocks != 0) ? nblocks : 1, sizeof(PackedBlock_t), alloc) != DSC_EOK) {
+        DSC_LOG("Failed to allocate memory for dsc packed array", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    // Size every block first, so the words can be allocated once
+    PackedBlock_t *blocks = arr->blocks.base;
+    size_t nwords = 0;
+    for (size_t b = 0; b < nblocks; ++b) {
+        const size_t lo = b * DSC_PACKED_BLOCK;
+        const size_t hi = (lo + DSC_PACKED_BLOCK < nelem) ? lo + DSC_PACKED_BLOCK : nelem;
+        uint64_t min = values[lo];
+        uint64_t max = values[lo];
+        for (size_t i = lo + 1; i < hi; ++i) {
+            min = (values[i] < min) ? values[i] : min;
+            max = (values[i] > max) ? values[i] : max;
+        }
+
+        if (nwords > UINT32_MAX) {
+            DSC_LOG("The packed array needs more words than a block header can address", DSC_ERROR);
+            dsc_buf_destroy(&arr->blocks);
+            return DSC_EOVERFLOW;
+        }
+        blocks[b].base = min;
+        blocks[b].word = (uint32_t)nwords;
+        blocks[b].width = _dsc_packed_width(max - min);
+        nwords += ((hi - lo) * blocks[b].width + 63) / 64;
+    }
+
+    if (dsc_buf_init_alloc(&arr->words, nwords + DSC_PACKED_PAD, sizeof(uint64_t), alloc) != DSC_EOK) {
+        DSC_LOG("Failed to allocate memory for dsc packed array", DSC_ERROR);
+        dsc_buf_destroy(&arr->blocks);
+        return DSC_ENOMEM;
+    }
+    dsc_buf_fill(&arr->words, 0);
+
+    uint64_t *words = arr->words.base;
+    for (size_t i = 0; i < nelem; ++i) {
+        const PackedBlock_t *blk = &blocks[i / DSC_PACKED_BLOCK];
+        const size_t bit = (i % DSC_PACKED_BLOCK) * blk->width;
+        const unsigned s = (unsigned)(bit & 63);
+        const uint64_t off = values[i] - blk->base;
+        uint64_t *w = &words[blk->word + (bit >> 6)];
+
+        if (blk->width == 0) {
+            continue;
+        }
+        w[0] |= off << s;
+        if (s + blk->width > 64) {
+            w[1] |= off >> (64 - s);
+        }
+    }
+    arr->nelem = nelem;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Frees the packed array's storage.
+ * @since 19-10-2026
+ * @param[in] arr The packed array
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_packed_destroy(PackedArray_t *arr) {
+    if (arr == NULL || arr->blocks.base == NULL) {
+        DSC_LOG("The packed array points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    dsc_buf_destroy(&arr->words);
+    dsc_buf_destroy(&arr->blocks);
+    arr->nelem = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Unpacks a run of consecutive values. This is much faster per value than calling
+ * dsc_packed_get() for each, and uses AVX2 when the CPU has it.
+ * @since 19-10-2026
+ * @param[in] arr The packed array
+ * @param[in] start The index of the first value
+ * @param[in] n The number of values wanted
+ * @param[out] out Receives the values
+ * @returns The number of values written, which is less than n if the array ends first
+ */
+size_t dsc_packed_decode(const PackedArray_t* const arr, const size_t start, const size_t n, uint64_t *out) {
+    if (arr == NULL || arr->blocks.base == NULL || out == NULL) {
+        DSC_LOG("The packed array points to an invalid address", DSC_ERROR);
+        return 0;
+    } else if (start >= arr->nelem) {
+        return 0;
+    }
+
+    const PackedBlock_t *blocks = arr->blocks.base;
+    const uint64_t *words = arr->words.base;
+    const size_t end = (n < arr->nelem - start) ? start + n : arr->nelem;
+#if DSC_PACKED_SIMD
+    const bool avx2 = _dsc_packed_has_avx2();
+#endif // DSC_PACKED_SIMD
+
+    for (size_t i = start; i < end;) {
+        const PackedBlock_t *blk = &blocks[i / DSC_PACKED_BLOCK];
+        const size_t lo = i % DSC_PACKED_BLOCK;
+        const size_t hi = (end - i < DSC_PACKED_BLOCK - lo) ? lo + (end - i) : DSC_PACKED_BLOCK;
+
+#if DSC_PACKED_SIMD
+        if (avx2) {
+            _dsc_packed_decode_avx2(blk, words + blk->word, lo, hi, out);
+        } else
+#endif // DSC_PACKED_SIMD
+        {
+            _dsc_packed_decode_scalar(blk, words + blk->word, lo, hi, out);
+        }
+        out += hi - lo;
+        i += hi - lo;
+    }
+
+    return end - start;
+}
+
+/**
+ * @brief Finds the first value that is not less than key, in an array whose values were
+ * sorted in ascending order. Block bases narrow the search to one block before any value is
+ * unpacked.
+ * @since 19-10-2026
+ * @param[in] arr The packed array
+ * @param[in] key The value searched for
+ * @returns The index of the first value >= key, or the number of values if there is none
+ */
+size_t dsc_packed_lower_bound(const PackedArray_t* const arr, const uint64_t key) {
+    if (arr == NULL || arr->blocks.base == NULL) {
+        DSC_LOG("The packed array points to an invalid address", DSC_ERROR);
+        return 0;
+    }
+
+    // In a sorted array each block's base is its first value; count the blocks starting below key
+    const PackedBlock_t *blocks = arr->blocks.base;
+    const size_t nblocks = (arr->nelem + DSC_PACKED_BLOCK - 1) / DSC_PACKED_BLOCK;
+    if (nblocks == 0 || blocks[0].base >= key) {
+        return 0;
+    }
+
+    // Halving searches without data-dependent branches, as in dsc_lower_bound()
+    size_t b = 0;
+    for (size_t len = nblocks; len > 1; len -= len / 2) {
+        b = (blocks[b + len / 2].base < key) ? b + len / 2 : b;
+    }
+
+    // Block b is the last starting below key; the answer is in it or is the first value after it
+    const PackedBlock_t *blk = &blocks[b];
+    const uint64_t *words = (const uint64_t*)arr->words.base + blk->word;
+    const uint64_t mask = _dsc_packed_mask(blk->width);
+    const size_t first = b * DSC_PACKED_BLOCK;
+    const size_t count = (arr->nelem - first < DSC_PACKED_BLOCK) ? arr->nelem - first : DSC_PACKED_BLOCK;
+    size_t j = 0;
+    for (size_t len = count; len > 1; len -= len / 2) {
+        const size_t bit = (j + len / 2) * blk->width;
+        const unsigned s = (unsigned)(bit & 63);
+        const uint64_t v = (words[bit >> 6] >> s) | ((words[(bit >> 6) + 1] << 1) << (63 - s));
+        j = (blk->base + (v & mask) < key) ? j + len / 2 : j;
+    }
+
+    // j is the last value below key (the block's first value always is)
+    return first + j + 1;
+}
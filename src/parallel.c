@@ -0,0 +1,301 @@
+/**
+ * @file parallel.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides the fork/join helpers used by the bulk operations of the containers.
+*/
+
+#include "parallel.h"
+#include "sort.h"
+
+#include <pthread.h>
+
+// Below this many elements per thread, sorting is left to a single dsc_sort_array()
+#define DSC_PARALLEL_MIN_SORT 4096
+
+typedef struct {
+    parallel_func func;
+    void         *ctx;
+    size_t        idx;
+    size_t        nthreads;
+} ParallelTask_t;
+
+typedef struct {
+    range_func func;
+    void      *ctx;
+    size_t     n;     // Number of indices
+    size_t     share; // Indices per share (the last share may be shorter)
+} ParallelFor_t;
+
+typedef struct {
+    uint8_t     *base;    // Array being sorted
+    uint8_t     *tmp;     // Scratch array of the same size
+    size_t       nelem;   // Number of elements
+    size_t       size;    // Size of each element
+    compare_func cmp;     // Element comparison
+    size_t       nruns;   // Number of sorted runs at the start of the current pass
+    size_t       run_len; // Elements per run (the last run may be shorter)
+} ParallelSort_t;
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+// Installed with dsc_parallel_set_pool(); NULL means a thread is started for every share
+static ThreadPool_t *_dsc_parallel_pool = NULL;
+
+static void *_dsc_parallel_thread(void *arg) {
+    ParallelTask_t *task = arg;
+    task->func(task->ctx, task->idx, task->nthreads);
+    return NULL;
+}
+
+// Runs the shares [lo, hi) of a dsc_parallel_run() job that was handed to the pool
+static void _dsc_parallel_shares(void *ctx, const size_t lo, const size_t hi) {
+    const ParallelTask_t *task = ctx;
+
+    for (size_t i = lo; i < hi; ++i) {
+        task->func(task->ctx, i, task->nthreads);
+    }
+}
+
+// Runs one thread's share of a dsc_parallel_for() job when no pool is installed
+static void _dsc_parallel_for_share(void *ctx, const size_t idx, const size_t nthreads) {
+    const ParallelFor_t *job = ctx;
+    const size_t lo = idx * job->share;
+    const size_t hi = (lo + job->share < job->n) ? lo + job->share : job->n;
+    (void)nthreads;
+
+    if (lo < hi) {
+        job->func(job->ctx, lo, hi);
+    }
+}
+
+static void _dsc_parallel_sort_run(void *ctx, const size_t idx, const size_t nthreads) {
+    ParallelSort_t *job = ctx;
+    const size_t lo = idx * job->run_len;
+    const size_t hi = (lo + job->run_len < job->nelem) ? lo + job->run_len : job->nelem;
+    (void)nthreads;
+
+    dsc_sort_array(job->base + lo * job->size, hi - lo, job->size, job->cmp);
+}
+
+// Merges runs 2 * idx and 2 * idx + 1 of base into tmp
+static void _dsc_parallel_sort_merge(void *ctx, const size_t idx, const size_t nthreads) {
+    ParallelSort_t *job = ctx;
+    const size_t size = job->size;
+    const size_t lo = 2 * idx * job->run_len;
+    const size_t mid = (lo + job->run_len < job->nelem) ? lo + job->run_len : job->nelem;
+    const size_t hi = (mid + job->run_len < job->nelem) ? mid + job->run_len : job->nelem;
+    size_t i = lo, j = mid, k = lo;
+    (void)nthreads;
+
+    while (i < mid && j < hi) {
+        // Taking from the left run on ties keeps the merge stable
+        if (job->cmp(job->base + j * size, job->base + i * size) < 0) {
+            memcpy(job->tmp + k++ * size, job->base + j++ * size, size);
+        } else {
+            memcpy(job->tmp + k++ * size, job->base + i++ * size, size);
+        }
+    }
+    memcpy(job->tmp + k * size, job->base + i * size, (mid - i) * size);
+    k += mid - i;
+    memcpy(job->tmp + k * size, job->base + j * size, (hi - j) * size);
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Resolves a requested thread count.
+ * @since 19-10-2026
+ * @param[in] nthreads The requested number of threads, or 0 for one per online CPU
+ * @returns The number of threads to use (at least 1)
+ */
+size_t dsc_parallel_nthreads(const size_t nthreads) {
+    if (nthreads != 0) {
+        return nthreads;
+    }
+
+    const long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    return (ncpu > 0) ? (size_t)ncpu : 1;
+}
+
+/**
+ * @brief Calls func once for each idx in [0, nthreads) on separate threads and waits for every
+ * call to return. If a thread cannot be started, its share runs on the calling thread instead.
+ * When a pool has been installed with dsc_parallel_set_pool(), the shares run on its threads
+ * rather than on threads started for this call.
+ * @since 19-10-2026
+ * @param[in] func The function run by each thread
+ * @param[in] ctx Passed as the first argument to func
+ * @param[in] nthreads The number of shares, or 0 for one per online CPU
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_parallel_run(parallel_func func, void *ctx, const size_t nthreads) {
+    const size_t n = dsc_parallel_nthreads(nthreads);
+
+    if (func == NULL) {
+        DSC_LOG("The parallel function points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (n == 1) {
+        func(ctx, 0, 1);
+        return DSC_EOK;
+    }
+
+    ThreadPool_t *pool = __atomic_load_n(&_dsc_parallel_pool, __ATOMIC_ACQUIRE);
+    if (pool != NULL) {
+        ParallelTask_t task = { func, ctx, 0, n };
+        if (dsc_pool_for(pool, n, 1, _dsc_parallel_shares, &task) == DSC_EOK) {
+            return DSC_EOK;
+        }
+    }
+
+    pthread_t *threads = malloc(n * sizeof(pthread_t));
+    ParallelTask_t *tasks = malloc(n * sizeof(ParallelTask_t));
+    bool *started = calloc(n, sizeof(bool));
+    if (threads == NULL || tasks == NULL || started == NULL) {
+        DSC_LOG("Failed to allocate memory for parallel job", DSC_ERROR);
+        free(threads);
+        free(tasks);
+        free(started);
+        return DSC_ENOMEM;
+    }
+
+    for (size_t i = 1; i < n; ++i) {
+        tasks[i] = (ParallelTask_t){ func, ctx, i, n };
+        started[i] = (pthread_create(&threads[i], NULL, _dsc_parallel_thread, &tasks[i]) == 0);
+    }
+    func(ctx, 0, n);
+    for (size_t i = 1; i < n; ++i) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        } else {
+            func(ctx, i, n);
+        }
+    }
+
+    free(threads);
+    free(tasks);
+    free(started);
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Sorts an array with dsc_sort_array() on each thread's share followed by rounds of
+ * pairwise merges. Unlike dsc_sort_array(), the merge rounds need a scratch copy of the array.
+ * @since 19-10-2026
+ * @param[in/out] base The array being sorted
+ * @param[in] nelem The number of elements
+ * @param[in] size The size of each element in bytes
+ * @param[in] cmp The element comparison, as for qsort()
+ * @param[in] nthreads The number of threads, or 0 for one per online CPU
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_parallel_sort(
+    void *base,
+    const size_t nelem,
+    const size_t size,
+    compare_func cmp,
+    const size_t nthreads
+) {
+    size_t n = dsc_parallel_nthreads(nthreads);
+
+    if ((base == NULL && nelem != 0) || cmp == NULL || size == 0) {
+        DSC_LOG("The array points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    if (nelem / n < DSC_PARALLEL_MIN_SORT) {
+        n = (nelem / DSC_PARALLEL_MIN_SORT != 0) ? nelem / DSC_PARALLEL_MIN_SORT : 1;
+    }
+    if (n == 1) {
+        return dsc_sort_array(base, nelem, size, cmp);
+    }
+
+    ParallelSort_t job = { base, malloc(nelem * size), nelem, size, cmp, 0, (nelem + n - 1) / n };
+    if (job.tmp == NULL) {
+        DSC_LOG("Failed to allocate memory for parallel sort", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    // Every run but the last is exactly run_len long, which the merge passes rely on
+    job.nruns = (nelem + job.run_len - 1) / job.run_len;
+    DscError_t status = dsc_parallel_run(_dsc_parallel_sort_run, &job, job.nruns);
+
+    while (status == DSC_EOK && job.nruns > 1) {
+        status = dsc_parallel_run(_dsc_parallel_sort_merge, &job, (job.nruns + 1) / 2);
+        if (status != DSC_EOK) {
+            break; // Nothing was merged into tmp, so base still holds every element
+        }
+        uint8_t *swap = job.base;
+        job.base = job.tmp;
+        job.tmp = swap;
+        job.run_len *= 2;
+        job.nruns = (job.nruns + 1) / 2;
+    }
+
+    // After an odd number of passes the sorted data is in the scratch array
+    if (job.base != base) {
+        memcpy(base, job.base, nelem * size);
+        free(job.base);
+    } else {
+        free(job.tmp);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Calls func over the indices [0, n) in ranges of at most grain indices, on every CPU,
+ * and waits for every call to return. With a pool installed (see dsc_parallel_set_pool()) this
+ * is dsc_pool_for() on that pool, which balances uneven ranges by work stealing; otherwise the
+ * indices are split evenly over one thread per online CPU.
+ * @since 19-10-2026
+ * @param[in] n The number of indices
+ * @param[in] grain The length below which ranges are not split, or 0 for 1
+ * @param[in] func Called for each range, possibly from several threads at once
+ * @param[in] ctx Passed as the first argument to func
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_parallel_for(const size_t n, const size_t grain, range_func func, void *ctx) {
+    const size_t g = (grain != 0) ? grain : 1;
+
+    if (func == NULL) {
+        DSC_LOG("The parallel function points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    ThreadPool_t *pool = __atomic_load_n(&_dsc_parallel_pool, __ATOMIC_ACQUIRE);
+    if (pool != NULL) {
+        return dsc_pool_for(pool, n, g, func, ctx);
+    }
+
+    size_t nthreads = dsc_parallel_nthreads(0);
+    const size_t nchunks = (n + g - 1) / g;
+    if (nthreads > nchunks) {
+        nthreads = (nchunks != 0) ? nchunks : 1;
+    }
+    ParallelFor_t job = { func, ctx, n, (n + nthreads - 1) / nthreads };
+
+    return dsc_parallel_run(_dsc_parallel_for_share, &job, nthreads);
+}
+
+/**
+ * @brief Installs a pool that every parallel operation of the library runs on, such as
+ * dsc_parallel_sort(), dsc_hmap_add_many() and dsc_btree_build(). Without one, each operation
+ * starts and joins its own threads. Only one job runs on the pool at a time; an operation that
+ * starts while the pool is busy (for example from another thread) runs on its calling thread.
+ * @since 19-10-2026
+ * @param[in] pool The pool, which must outlive its use, or NULL to go back to starting threads
+ */
+void dsc_parallel_set_pool(ThreadPool_t *pool) {
+    __atomic_store_n(&_dsc_parallel_pool, pool, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,325 @@
+/**
+ * @file pool.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a work-stealing thread pool and a parallel for loop over index ranges.
+*/
+
+#include "pool.h"
+#include "parallel.h"
+
+#include <sched.h>
+
+#define DSC_POOL_EMPTY UINT32_MAX
+#define DSC_POOL_MASK  (DSC_POOL_DEQUE - 1)
+
+typedef struct {
+    size_t lo;
+    size_t hi;
+} PoolRange_t;
+
+struct PoolJob {
+    range_func   func;
+    void        *ctx;
+    size_t       grain;     // Ranges at most this long are not split any further
+    PoolRange_t *tasks;     // Ranges that have been pushed onto a deque, indexed by the deque entries
+    size_t       ntasks;    // Capacity of tasks
+    size_t       next;      // Next free entry of tasks
+    size_t       remaining; // Indices that have not been processed yet; the job is done at 0
+};
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+/*
+ * The deque operations follow Lê et al., "Correct and Efficient Work-Stealing for Weak Memory
+ * Models" (PPoPP 2013). The ring has a fixed capacity, so a push onto a full deque fails and
+ * the caller keeps the work for itself.
+ */
+
+static bool _dsc_pool_push(PoolDeque_t *dq, const uint32_t task) {
+    const int64_t b = __atomic_load_n(&dq->bottom, __ATOMIC_RELAXED);
+    const int64_t t = __atomic_load_n(&dq->top, __ATOMIC_ACQUIRE);
+
+    if (b - t >= DSC_POOL_DEQUE) {
+        return false;
+    }
+    __atomic_store_n(&dq->ring[b & DSC_POOL_MASK], task, __ATOMIC_RELAXED);
+    __atomic_store_n(&dq->bottom, b + 1, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+static uint32_t _dsc_pool_pop(PoolDeque_t *dq) {
+    const int64_t b = __atomic_load_n(&dq->bottom, __ATOMIC_RELAXED) - 1;
+    uint32_t task = DSC_POOL_EMPTY;
+
+    __atomic_store_n(&dq->bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t t = __atomic_load_n(&dq->top, __ATOMIC_RELAXED);
+
+    if (t <= b) {
+        task = __atomic_load_n(&dq->ring[b & DSC_POOL_MASK], __ATOMIC_RELAXED);
+        if (t == b) {
+            // Last entry: race any thief for it
+            if (!__atomic_compare_exchange_n(&dq->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+                task = DSC_POOL_EMPTY;
+            }
+            __atomic_store_n(&dq->bottom, b + 1, __ATOMIC_RELAXED);
+        }
+    } else {
+        __atomic_store_n(&dq->bottom, b + 1, __ATOMIC_RELAXED);
+    }
+
+    return task;
+}
+
+static uint32_t _dsc_pool_steal(PoolDeque_t *dq) {
+    int64_t t = __atomic_load_n(&dq->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    const int64_t b = __atomic_load_n(&dq->bottom, __ATOMIC_ACQUIRE);
+
+    if (t >= b) {
+        return DSC_POOL_EMPTY;
+    }
+    const uint32_t task = __atomic_load_n(&dq->ring[t & DSC_POOL_MASK], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&dq->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        return DSC_POOL_EMPTY;
+    }
+
+    return task;
+}
+
+static size_t _dsc_pool_victim(PoolDeque_t *dq, const size_t nthreads) {
+    dq->rng ^= dq->rng << 13;
+    dq->rng ^= dq->rng >> 7;
+    dq->rng ^= dq->rng << 17;
+    return (size_t)(dq->rng % nthreads);
+}
+
+/**
+ * Processes [lo, hi), first splitting off its upper half onto dq until what is left is at most
+ * one grain, so that idle threads can steal the larger pieces.
+ */
+static void _dsc_pool_run_range(PoolJob_t *job, PoolDeque_t *dq, const size_t lo, size_t hi) {
+    while (hi - lo > job->grain) {
+        const size_t id = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+        if (id >= job->ntasks) {
+            break;
+        }
+
+        const size_t mid = lo + (hi - lo) / 2;
+        job->tasks[id] = (PoolRange_t){ mid, hi };
+        if (!_dsc_pool_push(dq, (uint32_t)id)) {
+            break;
+        }
+        hi = mid;
+    }
+
+    job->func(job->ctx, lo, hi);
+    __atomic_sub_fetch(&job->remaining, hi - lo, __ATOMIC_ACQ_REL);
+}
+
+// Pops or steals ranges of job until every index has been processed
+static void _dsc_pool_work(ThreadPool_t *pool, PoolJob_t *job, const size_t self) {
+    PoolDeque_t *dq = &pool->deques[self];
+
+    while (__atomic_load_n(&job->remaining, __ATOMIC_ACQUIRE) != 0) {
+        uint32_t id = _dsc_pool_pop(dq);
+        if (id == DSC_POOL_EMPTY) {
+            const size_t victim = _dsc_pool_victim(dq, pool->nthreads);
+            if (victim != self) {
+                id = _dsc_pool_steal(&pool->deques[victim]);
+            }
+        }
+
+        if (id != DSC_POOL_EMPTY) {
+            const PoolRange_t range = job->tasks[id];
+            _dsc_pool_run_range(job, dq, range.lo, range.hi);
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+static void *_dsc_pool_thread(void *arg) {
+    PoolDeque_t *dq = arg;
+    ThreadPool_t *pool = dq->pool;
+    const size_t self = (size_t)(dq - pool->deques);
+
+    pthread_mutex_lock(&pool->lock);
+    uint64_t seen = pool->generation;
+    for (;;) {
+        while (!pool->stop && pool->generation == seen) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        if (pool->stop) {
+            break;
+        }
+
+        // The job may already have finished and been withdrawn
+        seen = pool->generation;
+        PoolJob_t *job = pool->job;
+        if (job == NULL) {
+            continue;
+        }
+
+        ++pool->busy;
+        pthread_mutex_unlock(&pool->lock);
+        _dsc_pool_work(pool, job, self);
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->busy == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Starts a pool of worker threads. The threads sleep until a job is submitted.
+ * @since 19-10-2026
+ * @param[out] pool The pool
+ * @param[in] nthreads The number of threads working on each job, including the one that submits
+ *            it, or 0 for one per online CPU
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_pool_init(ThreadPool_t *pool, const size_t nthreads) {
+    if (pool == NULL) {
+        DSC_LOG("The pool points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    memset(pool, 0, sizeof(ThreadPool_t));
+    pool->nthreads = dsc_parallel_nthreads(nthreads);
+    pool->deques = calloc(pool->nthreads, sizeof(PoolDeque_t));
+    pool->threads = malloc(pool->nthreads * sizeof(pthread_t));
+    if (pool->deques == NULL || pool->threads == NULL) {
+        DSC_LOG("Failed to allocate memory for dsc thread pool", DSC_ERROR);
+        free(pool->deques);
+        free(pool->threads);
+        return DSC_ENOMEM;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_mutex_init(&pool->submit, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    for (size_t i = 0; i < pool->nthreads; ++i) {
+        pool->deques[i].pool = pool;
+        pool->deques[i].rng = 0x9E3779B97F4A7C15ULL * (i + 1);
+    }
+
+    // A thread that fails to start only leaves its deque idle; the job still completes
+    for (size_t i = 0; i + 1 < pool->nthreads; ++i) {
+        if (pthread_create(&pool->threads[pool->nstarted], NULL, _dsc_pool_thread, &pool->deques[i]) == 0) {
+            ++pool->nstarted;
+        }
+    }
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Stops and joins the worker threads and frees the pool. No job may be in progress.
+ * @since 19-10-2026
+ * @param[in] pool The pool
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_pool_destroy(ThreadPool_t *pool) {
+    if (pool == NULL || pool->deques == NULL) {
+        DSC_LOG("The pool points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (size_t i = 0; i < pool->nstarted; ++i) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_mutex_destroy(&pool->submit);
+    pthread_cond_destroy(&pool->wake);
+    pthread_cond_destroy(&pool->done);
+    free(pool->deques);
+    free(pool->threads);
+    pool->deques = NULL;
+    pool->threads = NULL;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Calls func over the indices [0, n) in ranges of at most grain indices, spread over the
+ * pool's threads, and waits for every call to return. The calling thread works on the job too.
+ * Ranges are split in half on demand and idle threads steal the larger halves, so uneven work
+ * balances itself. Jobs do not overlap: while another job is in progress (including a call from
+ * inside func), the whole range runs on the calling thread instead.
+ * @since 19-10-2026
+ * @param[in] pool The pool
+ * @param[in] n The number of indices
+ * @param[in] grain The length below which ranges are not split, or 0 for 1
+ * @param[in] func Called for each range, possibly from several threads at once
+ * @param[in] ctx Passed as the first argument to func
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_pool_for(ThreadPool_t *pool, const size_t n, const size_t grain, range_func func, void *ctx) {
+    const size_t g = (grain != 0) ? grain : 1;
+
+    if (pool == NULL || pool->deques == NULL || func == NULL) {
+        DSC_LOG("The pool points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (n == 0) {
+        return DSC_EOK;
+    } else if (n <= g || pool->nstarted == 0 || pthread_mutex_trylock(&pool->submit) != 0) {
+        func(ctx, 0, n);
+        return DSC_EOK;
+    }
+
+    // Each split leaves two ranges longer than half a grain, which bounds the number of tasks
+    const size_t nchunks = (n + g - 1) / g;
+    PoolJob_t job = { func, ctx, g, NULL, 0, 0, n };
+    job.ntasks = (nchunks < DSC_POOL_EMPTY / 2) ? 2 * nchunks : DSC_POOL_EMPTY - 1;
+    job.tasks = malloc(job.ntasks * sizeof(PoolRange_t));
+    if (job.tasks == NULL) {
+        DSC_LOG("Failed to allocate memory for dsc thread pool job", DSC_ERROR);
+        pthread_mutex_unlock(&pool->submit);
+        return DSC_ENOMEM;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->job = &job;
+    ++pool->generation;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    _dsc_pool_run_range(&job, &pool->deques[pool->nthreads - 1], 0, n);
+    _dsc_pool_work(pool, &job, pool->nthreads - 1);
+
+    // Workers may still be looking for work; the job must outlive them
+    pthread_mutex_lock(&pool->lock);
+    pool->job = NULL;
+    while (pool->busy != 0) {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    free(job.tasks);
+    pthread_mutex_unlock(&pool->submit);
+
+    return DSC_EOK;
+}
@@ -0,0 +1,416 @@
+/**
+ * @file rcu_btree.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a binary tree for read-mostly workloads. Published nodes are never modified:
+ * writers copy the path from the root to the node they change and publish the new root
+ * atomically, so readers traverse a consistent version of the tree without taking any lock.
+ * Replaced nodes are freed through epoch-based reclamation once no reader can reach them.
+*/
+
+#include "rcu_btree.h"
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static bool _dsc_rcu_reserve(const RcuBTree_t* const tree, RcuLimbo_t *vec, const size_t extra) {
+    if (vec->count + extra <= vec->cap) {
+        return true;
+    }
+
+    size_t cap = (vec->cap != 0) ? vec->cap : 16;
+    while (cap < vec->count + extra) {
+        cap *= 2;
+    }
+    BTreeNode_t *nodes = dsc_realloc(
+        tree->alloc, vec->nodes, vec->cap * sizeof(BTreeNode_t), cap * sizeof(BTreeNode_t)
+    );
+    if (nodes == NULL) {
+        DSC_LOG("Failed to allocate memory for rcu binary tree", DSC_ERROR);
+        return false;
+    }
+    vec->nodes = nodes;
+    vec->cap = cap;
+
+    return true;
+}
+
+static bool _dsc_rcu_push(const RcuBTree_t* const tree, RcuLimbo_t *vec, const BTreeNode_t node) {
+    if (!_dsc_rcu_reserve(tree, vec, 1)) {
+        return false;
+    }
+    vec->nodes[vec->count++] = node;
+    return true;
+}
+
+static void _dsc_rcu_release(const RcuBTree_t* const tree, RcuLimbo_t *vec) {
+    dsc_free(tree->alloc, vec->nodes, vec->cap * sizeof(BTreeNode_t));
+    vec->nodes = NULL;
+    vec->count = 0;
+    vec->cap = 0;
+}
+
+static void _dsc_rcu_free_nodes(const RcuBTree_t* const tree, RcuLimbo_t *vec) {
+    for (size_t i = 0; i < vec->count; ++i) {
+        dsc_free(tree->alloc, vec->nodes[i], sizeof(struct BTreeNode));
+    }
+    vec->count = 0;
+}
+
+/**
+ * Copies the nodes of path from the bottom up so that each copy points at the copy below it.
+ * path[i + 1] is a child of path[i], and the copy of the last node takes bottom in place of the
+ * child selected by left. Returns the new root, or NULL if a copy could not be allocated.
+ */
+static BTreeNode_t _dsc_rcu_copy_path(
+    RcuBTree_t *tree,
+    const RcuLimbo_t* const path,
+    const size_t depth,
+    const BTreeNode_t bottom,
+    const bool left
+) {
+    BTreeNode_t child = bottom;
+    RcuLimbo_t *copies = &tree->copies;
+
+    for (size_t i = depth; i-- > 0;) {
+        const BTreeNode_t orig = path->nodes[i];
+        BTreeNode_t copy = dsc_alloc(tree->alloc, sizeof(struct BTreeNode));
+        if (copy == NULL || !_dsc_rcu_push(tree, copies, copy)) {
+            DSC_LOG("Failed to allocate memory for rcu binary tree", DSC_ERROR);
+            dsc_free(tree->alloc, copy, sizeof(struct BTreeNode));
+            _dsc_rcu_free_nodes(tree, copies);
+            return NULL;
+        }
+
+        *copy = *orig;
+        if ((i + 1 == depth) ? left : (orig->left == path->nodes[i + 1])) {
+            copy->left = child;
+        } else {
+            copy->right = child;
+        }
+        child = copy;
+    }
+    copies->count = 0;
+
+    return child;
+}
+
+// Publishes root; sequentially consistent so that it is ordered before the epoch scan that follows
+static void _dsc_rcu_publish(RcuBTree_t *tree, const BTreeNode_t root) {
+    __atomic_store_n(&tree->root, root, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * Advances the global epoch if every reader inside a read section has observed the current one,
+ * then frees the nodes retired two epochs ago. No reader can still hold those: each active
+ * reader entered after they were unlinked. Called with wlock held.
+ */
+static void _dsc_rcu_reclaim(RcuBTree_t *tree) {
+    const uint64_t epoch = __atomic_load_n(&tree->epoch, __ATOMIC_RELAXED);
+
+    for (RcuReader_t *reader = tree->readers; reader != NULL; reader = reader->next) {
+        const uint64_t seen = __atomic_load_n(&reader->epoch, __ATOMIC_SEQ_CST);
+        if (seen != 0 && seen != epoch) {
+            return;
+        }
+    }
+
+    __atomic_store_n(&tree->epoch, epoch + 1, __ATOMIC_RELEASE);
+    _dsc_rcu_free_nodes(tree, &tree->limbo[(epoch + 1) % DSC_RCU_NLIMBO]);
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Initializes an empty tree.
+ * @since 19-10-2026
+ * @param[out] tree The RcuBTree_t object to be initialized
+ * @param[in] method The search method given to every node (only DFS is implemented)
+ * @param[in] alloc The allocator for the nodes (NULL for malloc). Only writers call it, and they
+ *            are serialized, so it need not be thread-safe.
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_rcu_btree_init(RcuBTree_t *tree, const SearchMethod_t method, const DscAllocator_t *alloc) {
+    if (tree == NULL) {
+        DSC_LOG("The tree points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    memset(tree, 0, sizeof(*tree));
+    if (pthread_mutex_init(&tree->wlock, NULL) != 0) {
+        DSC_LOG("Failed to initialize rcu binary tree lock", DSC_ERROR);
+        return DSC_EFAIL;
+    }
+    tree->epoch = 1;
+    tree->method = method;
+    tree->alloc = alloc;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Frees the tree and every retired node. No thread may be reading or writing the tree.
+ * @since 19-10-2026
+ * @param[in] tree The tree being destroyed
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_rcu_btree_destroy(RcuBTree_t *tree) {
+    if (tree == NULL) {
+        DSC_LOG("The tree points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    if (tree->root != NULL) {
+        dsc_btree_destroy(tree->root);
+        tree->root = NULL;
+    }
+    for (size_t i = 0; i < DSC_RCU_NLIMBO; ++i) {
+        _dsc_rcu_free_nodes(tree, &tree->limbo[i]);
+        _dsc_rcu_release(tree, &tree->limbo[i]);
+    }
+    _dsc_rcu_release(tree, &tree->path);
+    _dsc_rcu_release(tree, &tree->copies);
+    tree->readers = NULL;
+    pthread_mutex_destroy(&tree->wlock);
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Registers the calling thread's reader state. Every thread that reads the tree needs its
+ * own RcuReader_t, which must stay registered for as long as the thread reads.
+ * @since 19-10-2026
+ * @param[in] tree The tree being read
+ * @param[in] reader The reader state to register
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_rcu_btree_register(RcuBTree_t *tree, RcuReader_t *reader) {
+    if (tree == NULL || reader == NULL) {
+        DSC_LOG("The tree points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    pthread_mutex_lock(&tree->wlock);
+    reader->epoch = 0;
+    reader->next = tree->readers;
+    tree->readers = reader;
+    pthread_mutex_unlock(&tree->wlock);
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Unregisters reader state. The reader must be outside of any read section.
+ * @since 19-10-2026
+ * @param[in] tree The tree being read
+ * @param[in] reader The reader state passed to dsc_rcu_btree_register()
+ * @returns DSC_ENODATA if the reader was not registered, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_rcu_btree_unregister(RcuBTree_t *tree, RcuReader_t *reader) {
+    if (tree == NULL || reader == NULL) {
+        DSC_LOG("The tree points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    pthread_mutex_lock(&tree->wlock);
+    RcuReader_t **link = &tree->readers;
+    while (*link != NULL && *link != reader) {
+        link = &(*link)->next;
+    }
+    const bool found = (*link != NULL);
+    if (found) {
+        *link = reader->next;
+    }
+    pthread_mutex_unlock(&tree->wlock);
+
+    return found ? DSC_EOK : DSC_ENODATA;
+}
+
+/**
+ * @brief Enters a read section and returns the current version of the tree. The version may be
+ * searched with dsc_btree_peek() and stays intact, along with every node reached through it,
+ * until dsc_rcu_btree_read_end(). This never blocks, whatever writers are doing.
+ * @since 19-10-2026
+ * @param[in] tree The tree being read
+ * @param[in] reader The calling thread's registered reader state
+ * @returns The root of the current version, or NULL if the tree is empty
+ */
+BTreeNode_t dsc_rcu_btree_read_begin(RcuBTree_t *tree, RcuReader_t *reader) {
+    // Pairs with _dsc_rcu_publish() and _dsc_rcu_reclaim(): either this reader loads the new root
+    // or the writer sees this reader's epoch and holds back reclamation
+    __atomic_store_n(&reader->epoch, __atomic_load_n(&tree->epoch, __ATOMIC_ACQUIRE), __ATOMIC_SEQ_CST);
+    return __atomic_load_n(&tree->root, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Leaves a read section. Nodes returned during it must no longer be used.
+ * @since 19-10-2026
+ * @param[in] reader The calling thread's registered reader state
+ */
+void dsc_rcu_btree_read_end(RcuReader_t *reader) {
+    __atomic_store_n(&reader->epoch, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Publishes a version of the tree with a new node added. Writers are serialized; readers
+ * keep seeing the previous version until they start a new read section.
+ * @since 19-10-2026
+ * @param[in] tree The tree
+ * @param[in] data A pointer to the data of the new node (not copied)
+ * @param[in] id Optional id of the new node (may be NULL)
+ * @param[in] func Pointer to the insert function
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_rcu_btree_add(RcuBTree_t *tree, void *data, size_t *id, insert_func func) {
+    DscError_t status = DSC_EOK;
+    bool left = false;
+
+    if (tree == NULL) {
+        DSC_LOG("The tree points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    pthread_mutex_lock(&tree->wlock);
+    BTreeNode_t new_node = dsc_btree_create_alloc(data, id, tree->method, tree->alloc);
+    if (new_node == NULL) {
+        pthread_mutex_unlock(&tree->wlock);
+        return DSC_ENOMEM;
+    }
+
+    // Record the path down to the node that takes new_node as a child
+    RcuLimbo_t *path = &tree->path;
+    for (BTreeNode_t node = tree->root; node != NULL;) {
+        if (!_dsc_rcu_push(tree, path, node)) {
+            status = DSC_ENOMEM;
+            break;
+        }
+        switch (func(node, new_node)) {
+            case INSERT_LT: {
+                left = true;
+                node = node->left;
+                break;
+            }
+            case INSERT_GT: {
+                left = false;
+                node = node->right;
+                break;
+            }
+            default: {
+                DSC_LOG("Invalid branch arm", DSC_ERROR);
+                status = DSC_EFAIL;
+                node = NULL;
+                break;
+            }
+        }
+    }
+
+    // The replaced path is retired after publishing, so make room for it up front
+    BTreeNode_t root = new_node;
+    if (status == DSC_EOK && !_dsc_rcu_reserve(tree, &tree->limbo[tree->epoch % DSC_RCU_NLIMBO], path->count)) {
+        status = DSC_ENOMEM;
+    }
+    if (status == DSC_EOK && path->count != 0) {
+        root = _dsc_rcu_copy_path(tree, path, path->count, new_node, left);
+        status = (root != NULL) ? DSC_EOK : DSC_ENOMEM;
+    }
+
+    if (status == DSC_EOK) {
+        _dsc_rcu_publish(tree, root);
+        RcuLimbo_t *limbo = &tree->limbo[tree->epoch % DSC_RCU_NLIMBO];
+        for (size_t i = 0; i < path->count; ++i) {
+            limbo->nodes[limbo->count++] = path->nodes[i];
+        }
+        _dsc_rcu_reclaim(tree);
+    } else {
+        dsc_free(tree->alloc, new_node, sizeof(struct BTreeNode));
+    }
+    path->count = 0;
+    pthread_mutex_unlock(&tree->wlock);
+
+    return status;
+}
+
+/**
+ * @brief Publishes a version of the tree without the node matching func and its descendants,
+ * matching dsc_btree_remove().
+ * @since 19-10-2026
+ * @param[in] tree The tree
+ * @param[in] func Pointer to the search function
+ * @returns DSC_EFAIL if no node matched, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_rcu_btree_remove(RcuBTree_t *tree, search_func func) {
+    RcuLimbo_t subtree = { 0 };
+    DscError_t status = DSC_EFAIL;
+
+    if (tree == NULL) {
+        DSC_LOG("The tree points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    pthread_mutex_lock(&tree->wlock);
+    RcuLimbo_t *path = &tree->path;
+    for (BTreeNode_t node = tree->root; node != NULL;) {
+        if (!_dsc_rcu_push(tree, path, node)) {
+            status = DSC_ENOMEM;
+            break;
+        }
+        const SearchCmp_t cmp = func(node);
+        if (cmp == SEARCH_EQ) {
+            status = DSC_EOK;
+            break;
+        }
+        node = (cmp == SEARCH_LT) ? node->left : node->right;
+    }
+
+    // Gather the removed subtree without recursing; a degenerate tree may be arbitrarily deep
+    const BTreeNode_t target = (status == DSC_EOK) ? path->nodes[path->count - 1] : NULL;
+    if (target != NULL && _dsc_rcu_push(tree, &subtree, target)) {
+        for (size_t i = 0; i < subtree.count && status == DSC_EOK; ++i) {
+            const BTreeNode_t node = subtree.nodes[i];
+            if ((node->left != NULL && !_dsc_rcu_push(tree, &subtree, node->left))
+                || (node->right != NULL && !_dsc_rcu_push(tree, &subtree, node->right))
+            ) {
+                status = DSC_ENOMEM;
+            }
+        }
+    } else if (target != NULL) {
+        status = DSC_ENOMEM;
+    }
+
+    RcuLimbo_t *limbo = &tree->limbo[tree->epoch % DSC_RCU_NLIMBO];
+    if (status == DSC_EOK && !_dsc_rcu_reserve(tree, limbo, path->count - 1 + subtree.count)) {
+        status = DSC_ENOMEM;
+    }
+
+    BTreeNode_t root = NULL;
+    if (status == DSC_EOK && path->count > 1) {
+        // The copy of the target's parent takes NULL in place of the target
+        const BTreeNode_t parent = path->nodes[path->count - 2];
+        root = _dsc_rcu_copy_path(tree, path, path->count - 1, NULL, parent->left == target);
+        status = (root != NULL) ? DSC_EOK : DSC_ENOMEM;
+    }
+
+    if (status == DSC_EOK) {
+        _dsc_rcu_publish(tree, root);
+        for (size_t i = 0; i + 1 < path->count; ++i) {
+            limbo->nodes[limbo->count++] = path->nodes[i];
+        }
+        for (size_t i = 0; i < subtree.count; ++i) {
+            limbo->nodes[limbo->count++] = subtree.nodes[i];
+        }
+        _dsc_rcu_reclaim(tree);
+    }
+    path->count = 0;
+    pthread_mutex_unlock(&tree->wlock);
+    _dsc_rcu_release(tree, &subtree);
+
+    return status;
+}
@@ -0,0 +1,384 @@
+/**
+ * @file skiplist.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides an ordered map built on a skip list. Lookups, iteration and inserts never
+ * take a lock: a node is fully built before it is published with a release store (or a CAS
+ * when several threads insert at once), and it is linked into its levels bottom-up, so any
+ * reader sees either the old list or a correctly ordered newer one. Removal unlinks and frees
+ * nodes immediately, so it needs the list to itself.
+*/
+
+#include "skiplist.h"
+#include "hash.h"
+
+#define DSC_SKIP_ALIGN 8
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static inline SkipNode_t _dsc_skip_load(SkipNode_t *link) {
+    return __atomic_load_n(link, __ATOMIC_ACQUIRE);
+}
+
+static size_t _dsc_skip_node_size(const SkipList_t* const list, const uint32_t height) {
+    return sizeof(struct SkipNode) + height * sizeof(SkipNode_t) + list->voff + list->vsize;
+}
+
+/**
+ * Picks a node's height from its key, so that concurrent writers share no random state. Each
+ * level is kept with probability 1/4, which gives log4(n) levels and 1.33 links per node.
+ */
+static uint32_t _dsc_skip_height(const SkipList_t* const list, const void* const key) {
+    uint64_t z = (uint64_t)fnv1a_hash(key, list->ksize) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 31)) * 0xBF58476D1CE4E5B9ULL;
+    z ^= z >> 29;
+
+    const uint32_t height = (z == 0) ? DSC_SKIP_MAXLEVEL : (uint32_t)__builtin_ctzll(z) / 2 + 1;
+    return (height < DSC_SKIP_MAXLEVEL) ? height : DSC_SKIP_MAXLEVEL;
+}
+
+/**
+ * Fills preds and succs with the last node before key and the first node at or after it on
+ * every level, and returns the node holding key (or NULL).
+ */
+static SkipNode_t _dsc_skip_search(
+    const SkipList_t* const list,
+    const void* const key,
+    SkipNode_t *preds,
+    SkipNode_t *succs
+) {
+    SkipNode_t pred = list->head;
+    SkipNode_t succ = NULL;
+
+    for (uint32_t l = __atomic_load_n(&list->level, __ATOMIC_ACQUIRE); l-- > 0;) {
+        succ = _dsc_skip_load(&pred->next[l]);
+        while (succ != NULL && list->cmp(dsc_skiplist_key(succ), key) < 0) {
+            pred = succ;
+            succ = _dsc_skip_load(&pred->next[l]);
+        }
+        if (preds != NULL) {
+            preds[l] = pred;
+            succs[l] = succ;
+        }
+    }
+
+    return (succ != NULL && list->cmp(dsc_skiplist_key(succ), key) == 0) ? succ : NULL;
+}
+
+// Raises the number of levels in use to at least height
+static void _dsc_skip_raise(SkipList_t *list, const uint32_t height) {
+    uint32_t level = __atomic_load_n(&list->level, __ATOMIC_RELAXED);
+    while (level < height
+        && !__atomic_compare_exchange_n(&list->level, &level, height, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED)
+    ) {}
+}
+
+static DscError_t _dsc_skip_add(SkipList_t *list, const void* const key, const void* const value, const bool concurrent) {
+    SkipNode_t preds[DSC_SKIP_MAXLEVEL];
+    SkipNode_t succs[DSC_SKIP_MAXLEVEL];
+
+    if (list == NULL || list->head == NULL || key == NULL) {
+        DSC_LOG("The list points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const uint32_t height = _dsc_skip_height(list, key);
+    SkipNode_t node = dsc_alloc(list->alloc, _dsc_skip_node_size(list, height));
+    if (node == NULL) {
+        DSC_LOG("Failed to allocate memory for dsc skip list node", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+    node->height = height;
+    memcpy((void*)dsc_skiplist_key(node), key, list->ksize);
+    if (value != NULL) {
+        memcpy((uint8_t*)dsc_skiplist_key(node) + list->voff, value, list->vsize);
+    }
+
+    // Levels above the ones in use have the head as their predecessor and nothing after it
+    _dsc_skip_raise(list, height);
+    for (uint32_t l = 0; l < height; ++l) {
+        preds[l] = list->head;
+        succs[l] = NULL;
+    }
+
+    for (uint32_t l = 0; l < height; ++l) {
+        for (;;) {
+            if (l == 0 || concurrent) {
+                // Redone after a lost race so that the predecessors are current
+                const SkipNode_t found = _dsc_skip_search(list, key, preds, succs);
+                if (l == 0 && found != NULL) {
+                    dsc_free(list->alloc, node, _dsc_skip_node_size(list, height));
+                    return DSC_EINVAL;
+                }
+            }
+
+            __atomic_store_n(&node->next[l], succs[l], __ATOMIC_RELAXED);
+            if (!concurrent) {
+                __atomic_store_n(&preds[l]->next[l], node, __ATOMIC_RELEASE);
+                break;
+            }
+
+            SkipNode_t expected = succs[l];
+            if (__atomic_compare_exchange_n(
+                &preds[l]->next[l], &expected, node, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED
+            )) {
+                break;
+            }
+        }
+    }
+
+    __atomic_add_fetch(&list->count, 1, __ATOMIC_RELAXED);
+    return DSC_EOK;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Initializes an empty skip list.
+ * @since 19-10-2026
+ * @param[out] list The list to be initialized
+ * @param[in] ksize The size of each key in bytes
+ * @param[in] vsize The size of each value in bytes (may be 0)
+ * @param[in] cmp Orders two keys, like the comparator passed to qsort()
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_skiplist_init(SkipList_t *list, const size_t ksize, const size_t vsize, compare_func cmp) {
+    return dsc_skiplist_init_alloc(list, ksize, vsize, cmp, NULL);
+}
+
+/**
+ * @brief Initializes an empty skip list whose nodes come from a custom allocator.
+ * @since 19-10-2026
+ * @param[out] list The list to be initialized
+ * @param[in] ksize The size of each key in bytes
+ * @param[in] vsize The size of each value in bytes (may be 0)
+ * @param[in] cmp Orders two keys, like the comparator passed to qsort()
+ * @param[in] alloc The allocator used for every node (NULL for malloc)
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_skiplist_init_alloc(
+    SkipList_t *list,
+    const size_t ksize,
+    const size_t vsize,
+    compare_func cmp,
+    const DscAllocator_t *alloc
+) {
+    if (list == NULL || ksize == 0 || cmp == NULL) {
+        DSC_LOG("The list points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    list->ksize = ksize;
+    list->vsize = vsize;
+    list->voff = (ksize + DSC_SKIP_ALIGN - 1) & ~(size_t)(DSC_SKIP_ALIGN - 1);
+    list->cmp = cmp;
+    list->alloc = alloc;
+    list->level = 1;
+    list->count = 0;
+
+    list->head = dsc_calloc(alloc, 1, sizeof(struct SkipNode) + DSC_SKIP_MAXLEVEL * sizeof(SkipNode_t));
+    if (list->head == NULL) {
+        DSC_LOG("Failed to allocate memory for dsc skip list", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+    list->head->height = DSC_SKIP_MAXLEVEL;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Frees every node of the list.
+ * @since 19-10-2026
+ * @param[in] list The list
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_skiplist_destroy(SkipList_t *list) {
+    if (list == NULL || list->head == NULL) {
+        DSC_LOG("The list points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    SkipNode_t node = list->head->next[0];
+    while (node != NULL) {
+        SkipNode_t next = node->next[0];
+        dsc_free(list->alloc, node, _dsc_skip_node_size(list, node->height));
+        node = next;
+    }
+    dsc_free(list->alloc, list->head, sizeof(struct SkipNode) + DSC_SKIP_MAXLEVEL * sizeof(SkipNode_t));
+    list->head = NULL;
+    list->count = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Copies a key/value pair into the list. Safe to call while other threads read the
+ * list, but not while another thread writes to it (see dsc_skiplist_add_concurrent()).
+ * @since 19-10-2026
+ * @param[in] list The list
+ * @param[in] key The key
+ * @param[in] value The value, or NULL to leave it uninitialized
+ * @returns DSC_EINVAL if the key is already present, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_skiplist_add(SkipList_t *list, const void* const key, const void* const value) {
+    return _dsc_skip_add(list, key, value, false);
+}
+
+/**
+ * @brief Copies a key/value pair into the list without locking. Any number of threads may call
+ * this and the read functions at the same time. Each level is linked with a CAS, and a thread
+ * that loses a race searches again and retries that level. The allocator must be thread-safe
+ * and must not have stats attached, since those counters are not atomic.
+ * @since 19-10-2026
+ * @param[in] list The list
+ * @param[in] key The key
+ * @param[in] value The value, or NULL to leave it uninitialized
+ * @returns DSC_EINVAL if the key is already present, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_skiplist_add_concurrent(SkipList_t *list, const void* const key, const void* const value) {
+    if (list != NULL && list->alloc != NULL && list->alloc->stats != NULL) {
+        DSC_LOG("Concurrent inserts cannot update allocator stats", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    return _dsc_skip_add(list, key, value, true);
+}
+
+/**
+ * @brief Removes a key from the list and frees its node. No other thread may use the list
+ * during the call.
+ * @since 19-10-2026
+ * @param[in] list The list
+ * @param[in] key The key
+ * @returns DSC_ENODATA if the key is not present, otherwise a DscError_t exit status code
+ */
+DscError_t dsc_skiplist_remove(SkipList_t *list, const void* const key) {
+    SkipNode_t preds[DSC_SKIP_MAXLEVEL];
+    SkipNode_t succs[DSC_SKIP_MAXLEVEL];
+
+    if (list == NULL || list->head == NULL || key == NULL) {
+        DSC_LOG("The list points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const SkipNode_t node = _dsc_skip_search(list, key, preds, succs);
+    if (node == NULL) {
+        return DSC_ENODATA;
+    }
+
+    for (uint32_t l = 0; l < node->height; ++l) {
+        __atomic_store_n(&preds[l]->next[l], node->next[l], __ATOMIC_RELEASE);
+    }
+    while (list->level > 1 && list->head->next[list->level - 1] == NULL) {
+        --list->level;
+    }
+
+    dsc_free(list->alloc, node, _dsc_skip_node_size(list, node->height));
+    --list->count;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Looks up the value stored for a key.
+ * @since 19-10-2026
+ * @param[in] list The list
+ * @param[in] key The key
+ * @returns A pointer to the value inside the list, or NULL if the key is not present
+ */
+void *dsc_skiplist_find(const SkipList_t* const list, const void* const key) {
+    if (list == NULL || list->head == NULL || key == NULL) {
+        DSC_LOG("The list points to an invalid address", DSC_ERROR);
+        return NULL;
+    }
+
+    const SkipNode_t node = _dsc_skip_search(list, key, NULL, NULL);
+    return (node != NULL) ? dsc_skiplist_value(list, node) : NULL;
+}
+
+/**
+ * @brief Returns the node with the smallest key.
+ * @since 19-10-2026
+ * @param[in] list The list
+ * @returns The first node, or NULL if the list is empty
+ */
+SkipNode_t dsc_skiplist_first(const SkipList_t* const list) {
+    if (list == NULL || list->head == NULL) {
+        DSC_LOG("The list points to an invalid address", DSC_ERROR);
+        return NULL;
+    }
+
+    return _dsc_skip_load(&list->head->next[0]);
+}
+
+/**
+ * @brief Returns the first node whose key does not order before key.
+ * @since 19-10-2026
+ * @param[in] list The list
+ * @param[in] key The key
+ * @returns The node, or NULL if every key orders before key
+ */
+SkipNode_t dsc_skiplist_lower_bound(const SkipList_t* const list, const void* const key) {
+    SkipNode_t preds[DSC_SKIP_MAXLEVEL];
+    SkipNode_t succs[DSC_SKIP_MAXLEVEL];
+
+    if (list == NULL || list->head == NULL || key == NULL) {
+        DSC_LOG("The list points to an invalid address", DSC_ERROR);
+        return NULL;
+    }
+
+    _dsc_skip_search(list, key, preds, succs);
+    return succs[0];
+}
+
+/**
+ * @brief Returns the node after node in key order.
+ * @since 19-10-2026
+ * @param[in] node A node of the list
+ * @returns The next node, or NULL at the end of the list
+ */
+SkipNode_t dsc_skiplist_next(const SkipNode_t node) {
+    return (node != NULL) ? _dsc_skip_load(&node->next[0]) : NULL;
+}
+
+/**
+ * @brief Visits, in key order, every entry whose key is in [lo, hi). Costs O(log n + k) for
+ * k visited entries.
+ * @since 19-10-2026
+ * @param[in] list The list
+ * @param[in] lo The inclusive lower bound
+ * @param[in] hi The exclusive upper bound
+ * @param[in] func Called with the key and value of each entry in the range
+ * @param[in] ctx Passed through to func
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_skiplist_range(
+    const SkipList_t* const list,
+    const void* const lo,
+    const void* const hi,
+    skip_visit_func func,
+    void *ctx
+) {
+    if (list == NULL || lo == NULL || hi == NULL || func == NULL) {
+        DSC_LOG("The list points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    for (SkipNode_t node = dsc_skiplist_lower_bound(list, lo);
+        node != NULL && list->cmp(dsc_skiplist_key(node), hi) < 0;
+        node = dsc_skiplist_next(node)
+    ) {
+        func(dsc_skiplist_key(node), dsc_skiplist_value(list, node), ctx);
+    }
+
+    return DSC_EOK;
+}
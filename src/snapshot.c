@@ -0,0 +1,261 @@
+/**
+ * @file snapshot.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides the file handling shared by every container that can be saved to and queried
+ * from an on-disk snapshot. The container-specific layouts live beside each container.
+*/
+
+#include "snapshot_internal.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+/**
+ * @brief Flushes the directory that holds path so that a rename into it survives a crash.
+ * @since 19-10-2026
+ * @param[in] path A file in the directory being flushed
+ * @returns A DscError_t object containing the exit status code
+ */
+static DscError_t _dsc_snapshot_sync_dir(const char *path) {
+    const char *slash = strrchr(path, '/');
+    char *dir = (slash == NULL) ? strdup(".") : strndup(path, (slash == path) ? 1 : (size_t)(slash - path));
+    if (dir == NULL) {
+        DSC_LOG("Failed to allocate memory for snapshot path", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    DscError_t status = DSC_EOK;
+    int fd = open(dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0 || fsync(fd) != 0) {
+        DSC_LOG("Failed to flush snapshot directory", DSC_ERROR);
+        status = DSC_EFAIL;
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    free(dir);
+
+    return status;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Maps a snapshot file read-only so that it can be queried without being deserialized.
+ * @since 19-10-2026
+ * @param[out] snap The Snapshot_t object that views the file
+ * @param[in] path The path of a file written by one of the dsc_*_save() functions
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_snapshot_open(Snapshot_t *snap, const char *path) {
+    struct stat st;
+
+    if (snap == NULL || path == NULL) {
+        DSC_LOG("The snapshot points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        DSC_LOG("Failed to open snapshot file", DSC_ERROR);
+        return DSC_EFAIL;
+    } else if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(SnapshotHeader_t)) {
+        DSC_LOG("The snapshot file is truncated", DSC_ERROR);
+        close(fd);
+        return DSC_EINVAL;
+    }
+
+    void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        DSC_LOG("Failed to map snapshot file", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    DscError_t status = dsc_snapshot_from(snap, base, (size_t)st.st_size);
+    if (status != DSC_EOK) {
+        munmap(base, (size_t)st.st_size);
+        return status;
+    }
+    snap->msize = (size_t)st.st_size; // May exceed snap->size if the file has trailing bytes
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Views a snapshot that is already in memory (e.g. read from a socket or mapped by a
+ * Buffer_t). The memory must stay valid and 8-byte aligned for as long as the snapshot is used.
+ * @since 19-10-2026
+ * @param[out] snap The Snapshot_t object that views the image
+ * @param[in] base The start of the image
+ * @param[in] size The size of the image in bytes
+ * @returns DSC_EINVAL if the image is not a snapshot that this build can read, otherwise a
+ *          DscError_t exit status code
+ */
+DscError_t dsc_snapshot_from(Snapshot_t *snap, const void *base, const size_t size) {
+    if (snap == NULL || base == NULL) {
+        DSC_LOG("The snapshot points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const SnapshotHeader_t *hdr = base;
+    if (size < sizeof(*hdr) || ((uintptr_t)base & 7) != 0
+        || memcmp(hdr->magic, DSC_SNAPSHOT_MAGIC, sizeof(hdr->magic)) != 0
+    ) {
+        DSC_LOG("The image is not a dsc snapshot", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (hdr->endian != DSC_SNAPSHOT_ENDIAN || hdr->version != DSC_SNAPSHOT_VERSION) {
+        DSC_LOG("The snapshot was written by an incompatible version or byte order", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (hdr->size > size) {
+        DSC_LOG("The snapshot file is truncated", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    snap->base = base;
+    snap->size = (size_t)hdr->size;
+    snap->msize = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Releases a snapshot. Pointers returned by queries against it become invalid.
+ * @since 19-10-2026
+ * @param[in] snap The snapshot being closed
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_snapshot_close(Snapshot_t *snap) {
+    if (snap == NULL || snap->base == NULL) {
+        DSC_LOG("The snapshot points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    if (snap->msize != 0) {
+        munmap((void*)snap->base, snap->msize);
+    }
+    snap->base = NULL;
+    snap->size = 0;
+    snap->msize = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Opens a temporary file beside path that the snapshot is written to, so that a reader
+ * never observes a partially written snapshot.
+ * @since 19-10-2026
+ * @param[in] path The final path of the snapshot
+ * @param[out] tmp_path Receives the heap-allocated temporary path, freed by _dsc_snapshot_commit()
+ * @returns The temporary file, or NULL on failure
+ */
+FILE *_dsc_snapshot_create(const char *path, char **tmp_path) {
+    const size_t len = strlen(path) + sizeof(".tmp");
+
+    *tmp_path = malloc(len);
+    if (*tmp_path == NULL) {
+        DSC_LOG("Failed to allocate memory for snapshot path", DSC_ERROR);
+        return NULL;
+    }
+    snprintf(*tmp_path, len, "%s.tmp", path);
+
+    FILE *file = fopen(*tmp_path, "wb");
+    if (file == NULL) {
+        DSC_LOG("Failed to create snapshot file", DSC_ERROR);
+        free(*tmp_path);
+        *tmp_path = NULL;
+    }
+
+    return file;
+}
+
+/**
+ * @brief Closes the temporary file and, if every write succeeded, renames it over path.
+ * @since 19-10-2026
+ * @param[in] file The file returned from _dsc_snapshot_create()
+ * @param[in] tmp_path The temporary path returned from _dsc_snapshot_create()
+ * @param[in] path The final path of the snapshot
+ * @param[in] ok False if the caller failed part way through writing
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t _dsc_snapshot_commit(FILE *file, char *tmp_path, const char *path, const bool ok) {
+    DscError_t status = DSC_EOK;
+
+    if (!ok || ferror(file)) {
+        DSC_LOG("Failed to write snapshot file", DSC_ERROR);
+        status = DSC_EFAIL;
+    }
+    // The data must be on disk before the rename is, or a crash could leave an empty snapshot
+    if (status == DSC_EOK && (fflush(file) != 0 || fsync(fileno(file)) != 0)) {
+        DSC_LOG("Failed to flush snapshot file", DSC_ERROR);
+        status = DSC_EFAIL;
+    }
+    if (fclose(file) != 0 && status == DSC_EOK) {
+        DSC_LOG("Failed to flush snapshot file", DSC_ERROR);
+        status = DSC_EFAIL;
+    }
+    if (status == DSC_EOK && rename(tmp_path, path) != 0) {
+        DSC_LOG("Failed to rename snapshot file", DSC_ERROR);
+        status = DSC_EFAIL;
+    }
+    if (status == DSC_EOK) {
+        status = _dsc_snapshot_sync_dir(path);
+    }
+    if (status != DSC_EOK) {
+        unlink(tmp_path);
+    }
+    free(tmp_path);
+
+    return status;
+}
+
+/**
+ * @brief Fills in the common header of a snapshot.
+ * @since 19-10-2026
+ * @param[out] hdr The header
+ * @param[in] kind The container that the snapshot holds
+ * @param[in] size The size of the whole image in bytes
+ */
+void _dsc_snapshot_header(SnapshotHeader_t *hdr, const SnapshotKind_t kind, const uint64_t size) {
+    memset(hdr, 0, sizeof(*hdr));
+    memcpy(hdr->magic, DSC_SNAPSHOT_MAGIC, sizeof(hdr->magic));
+    hdr->endian = DSC_SNAPSHOT_ENDIAN;
+    hdr->version = DSC_SNAPSHOT_VERSION;
+    hdr->kind = (uint32_t)kind;
+    hdr->size = size;
+}
+
+/**
+ * @brief Returns the container-specific header of a snapshot after checking its kind.
+ * @since 19-10-2026
+ * @param[in] snap The snapshot
+ * @param[in] kind The kind of snapshot that the caller expects
+ * @param[in] hsize The size of the container-specific header, which starts with a SnapshotHeader_t
+ * @returns The header, or NULL if the snapshot holds a different container or is truncated
+ */
+const void *_dsc_snapshot_section(const Snapshot_t* const snap, const SnapshotKind_t kind, const size_t hsize) {
+    if (snap == NULL || snap->base == NULL) {
+        DSC_LOG("The snapshot points to an invalid address", DSC_ERROR);
+        return NULL;
+    }
+
+    const SnapshotHeader_t *hdr = (const SnapshotHeader_t*)snap->base;
+    if (hdr->kind != (uint32_t)kind || snap->size < hsize) {
+        DSC_LOG("The snapshot holds a different kind of container", DSC_ERROR);
+        return NULL;
+    }
+
+    return hdr;
+}
@@ -0,0 +1,18 @@
+#ifndef SNAPSHOT_INTERNAL_H
+#define SNAPSHOT_INTERNAL_H
+
+#include "snapshot.h"
+
+/*
+ * Library-internal declarations for snapshot.c. Nothing here is part of the public API or
+ * installed with it.
+ */
+
+// Used by the containers that write snapshots
+
+FILE*          _dsc_snapshot_create(const char *path, char **tmp_path);
+DscError_t     _dsc_snapshot_commit(FILE *file, char *tmp_path, const char *path, const bool ok);
+void           _dsc_snapshot_header(SnapshotHeader_t *hdr, const SnapshotKind_t kind, const uint64_t size);
+const void*    _dsc_snapshot_section(const Snapshot_t* const snap, const SnapshotKind_t kind, const size_t hsize);
+
+#endif // SNAPSHOT_INTERNAL_H
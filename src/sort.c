@@ -0,0 +1,534 @@
+/**
+ * @file sort.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides sorting and binary search over the elements of a Buffer_t.
+*/
+
+#include "sort.h"
+
+#define DSC_SORT_INSERTION 16  // Ranges of at most this many elements are finished by insertion sort
+#define DSC_SORT_NINTHER   128 // Ranges longer than this take the median of nine elements as pivot
+#define DSC_SORT_PARTIAL   8   // Elements a partial insertion sort may move before it gives up
+#define DSC_SORT_RUN       32  // Length of the runs the stable sort builds before merging them
+#define DSC_SORT_TMP       64  // Elements up to this size are held on the stack while being moved
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define DSC_SORT_DIGIT(d, size) ((size) - 1 - (d))
+#else
+#define DSC_SORT_DIGIT(d, size) (d)
+#endif
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static inline uint8_t *_dsc_sort_at(uint8_t *base, const size_t i, const size_t size) {
+    return base + i * size;
+}
+
+// Copies one element; the common widths become single loads and stores
+static inline void _dsc_sort_copy(uint8_t *dst, const uint8_t *src, const size_t size) {
+    if (size == sizeof(uint64_t)) {
+        memcpy(dst, src, sizeof(uint64_t));
+    } else if (size == sizeof(uint32_t)) {
+        memcpy(dst, src, sizeof(uint32_t));
+    } else {
+        memcpy(dst, src, size);
+    }
+}
+
+static inline void _dsc_sort_swap(uint8_t *a, uint8_t *b, size_t size) {
+    uint8_t tmp[DSC_SORT_TMP];
+
+    if (size == sizeof(uint64_t)) {
+        uint64_t t;
+        memcpy(&t, a, sizeof(t));
+        memcpy(a, b, sizeof(t));
+        memcpy(b, &t, sizeof(t));
+        return;
+    }
+
+    while (size != 0) {
+        const size_t n = (size < sizeof(tmp)) ? size : sizeof(tmp);
+        memcpy(tmp, a, n);
+        memcpy(a, b, n);
+        memcpy(b, tmp, n);
+        a += n;
+        b += n;
+        size -= n;
+    }
+}
+
+// Moves element i down to its place among the sorted elements before it; returns the distance moved
+static size_t _dsc_sort_sink(uint8_t *base, const size_t i, const size_t size, compare_func cmp) {
+    size_t j = i;
+
+    if (size > DSC_SORT_TMP) {
+        while (j > 0 && cmp(_dsc_sort_at(base, j, size), _dsc_sort_at(base, j - 1, size)) < 0) {
+            _dsc_sort_swap(_dsc_sort_at(base, j, size), _dsc_sort_at(base, j - 1, size), size);
+            --j;
+        }
+        return i - j;
+    }
+
+    uint8_t tmp[DSC_SORT_TMP];
+    _dsc_sort_copy(tmp, _dsc_sort_at(base, i, size), size);
+    while (j > 0 && cmp(tmp, _dsc_sort_at(base, j - 1, size)) < 0) {
+        --j;
+    }
+    if (j != i) {
+        memmove(_dsc_sort_at(base, j + 1, size), _dsc_sort_at(base, j, size), (i - j) * size);
+        _dsc_sort_copy(_dsc_sort_at(base, j, size), tmp, size);
+    }
+
+    return i - j;
+}
+
+// Stable, since an element only moves past elements that order strictly after it
+static void _dsc_sort_insertion(uint8_t *base, const size_t nelem, const size_t size, compare_func cmp) {
+    for (size_t i = 1; i < nelem; ++i) {
+        _dsc_sort_sink(base, i, size, cmp);
+    }
+}
+
+// Insertion sort that gives up once it has moved DSC_SORT_PARTIAL elements; returns true if it finished
+static bool _dsc_sort_partial(uint8_t *base, const size_t nelem, const size_t size, compare_func cmp) {
+    size_t moved = 0;
+
+    for (size_t i = 1; i < nelem; ++i) {
+        moved += _dsc_sort_sink(base, i, size, cmp);
+        if (moved > DSC_SORT_PARTIAL) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void _dsc_sort_sift(uint8_t *base, size_t root, const size_t nelem, const size_t size, compare_func cmp) {
+    for (size_t child = 2 * root + 1; child < nelem; root = child, child = 2 * root + 1) {
+        if (child + 1 < nelem && cmp(_dsc_sort_at(base, child, size), _dsc_sort_at(base, child + 1, size)) < 0) {
+            ++child;
+        }
+        if (cmp(_dsc_sort_at(base, root, size), _dsc_sort_at(base, child, size)) >= 0) {
+            return;
+        }
+        _dsc_sort_swap(_dsc_sort_at(base, root, size), _dsc_sort_at(base, child, size), size);
+    }
+}
+
+static void _dsc_sort_heap(uint8_t *base, const size_t nelem, const size_t size, compare_func cmp) {
+    for (size_t i = nelem / 2; i-- > 0;) {
+        _dsc_sort_sift(base, i, nelem, size, cmp);
+    }
+    for (size_t end = nelem - 1; end > 0; --end) {
+        _dsc_sort_swap(base, _dsc_sort_at(base, end, size), size);
+        _dsc_sort_sift(base, 0, end, size, cmp);
+    }
+}
+
+// Orders elements a, b and c so that b holds their median
+static void _dsc_sort3(uint8_t *base, const size_t a, const size_t b, const size_t c, const size_t size, compare_func cmp) {
+    uint8_t *pa = _dsc_sort_at(base, a, size);
+    uint8_t *pb = _dsc_sort_at(base, b, size);
+    uint8_t *pc = _dsc_sort_at(base, c, size);
+
+    if (cmp(pb, pa) < 0) {
+        _dsc_sort_swap(pa, pb, size);
+    }
+    if (cmp(pc, pb) < 0) {
+        _dsc_sort_swap(pb, pc, size);
+        if (cmp(pb, pa) < 0) {
+            _dsc_sort_swap(pa, pb, size);
+        }
+    }
+}
+
+/**
+ * Partitions around the element at index 0 and returns the pivot's final index. Elements equal
+ * to the pivot stop both scans, so ranges full of duplicates still split evenly. swapped is
+ * cleared if the range was already partitioned.
+ */
+static size_t _dsc_sort_partition(uint8_t *base, const size_t nelem, const size_t size, compare_func cmp, bool *swapped) {
+    const uint8_t *pivot = base;
+    size_t i = 0, j = nelem;
+
+    *swapped = false;
+    for (;;) {
+        do {
+            ++i;
+        } while (i < nelem && cmp(_dsc_sort_at(base, i, size), pivot) < 0);
+        do {
+            --j;
+        } while (cmp(pivot, _dsc_sort_at(base, j, size)) < 0);
+
+        if (i >= j) {
+            break;
+        }
+        _dsc_sort_swap(_dsc_sort_at(base, i, size), _dsc_sort_at(base, j, size), size);
+        *swapped = true;
+    }
+    _dsc_sort_swap(base, _dsc_sort_at(base, j, size), size);
+
+    return j;
+}
+
+/**
+ * Pattern-defeating introsort: quicksort with a median-of-three (or ninther) pivot, recursing
+ * into the smaller side. A range that was already partitioned is finished by a bounded insertion
+ * sort, so sorted and nearly sorted input runs in linear time, and heapsort takes over once the
+ * depth budget is spent, so the worst case stays O(n log n).
+ */
+static void _dsc_sort_intro(uint8_t *base, size_t nelem, const size_t size, compare_func cmp, size_t depth) {
+    while (nelem > DSC_SORT_INSERTION) {
+        if (depth == 0) {
+            _dsc_sort_heap(base, nelem, size, cmp);
+            return;
+        }
+        --depth;
+
+        const size_t mid = nelem / 2;
+        if (nelem > DSC_SORT_NINTHER) {
+            _dsc_sort3(base, 0, mid, nelem - 1, size, cmp);
+            _dsc_sort3(base, 1, mid - 1, nelem - 2, size, cmp);
+            _dsc_sort3(base, 2, mid + 1, nelem - 3, size, cmp);
+            _dsc_sort3(base, mid - 1, mid, mid + 1, size, cmp);
+            _dsc_sort_swap(base, _dsc_sort_at(base, mid, size), size);
+        } else {
+            _dsc_sort3(base, mid, 0, nelem - 1, size, cmp);
+        }
+
+        bool swapped;
+        const size_t p = _dsc_sort_partition(base, nelem, size, cmp, &swapped);
+        uint8_t *right = _dsc_sort_at(base, p + 1, size);
+        const size_t nright = nelem - p - 1;
+
+        if (!swapped && _dsc_sort_partial(base, p, size, cmp) && _dsc_sort_partial(right, nright, size, cmp)) {
+            return;
+        }
+
+        if (p < nright) {
+            _dsc_sort_intro(base, p, size, cmp, depth);
+            base = right;
+            nelem = nright;
+        } else {
+            _dsc_sort_intro(right, nright, size, cmp, depth);
+            nelem = p;
+        }
+    }
+
+    _dsc_sort_insertion(base, nelem, size, cmp);
+}
+
+// Merges the sorted ranges [lo, mid) and [mid, hi) of src into the same range of dst
+static void _dsc_sort_merge(
+    const uint8_t *src,
+    uint8_t *dst,
+    const size_t lo,
+    const size_t mid,
+    const size_t hi,
+    const size_t size,
+    compare_func cmp
+) {
+    size_t i = lo, j = mid, k = lo;
+
+    // Ranges that are already in order are copied across whole
+    if (mid == hi || cmp(src + (mid - 1) * size, src + mid * size) <= 0) {
+        memcpy(dst + lo * size, src + lo * size, (hi - lo) * size);
+        return;
+    }
+
+    while (i < mid && j < hi) {
+        // Taking from the left range on ties keeps the merge stable
+        if (cmp(src + j * size, src + i * size) < 0) {
+            _dsc_sort_copy(dst + k++ * size, src + j++ * size, size);
+        } else {
+            _dsc_sort_copy(dst + k++ * size, src + i++ * size, size);
+        }
+    }
+    memcpy(dst + k * size, src + i * size, (mid - i) * size);
+    k += mid - i;
+    memcpy(dst + k * size, src + j * size, (hi - j) * size);
+}
+
+// Counts every digit of every element in one read of the buffer
+static inline void _dsc_sort_radix_count(
+    const uint8_t *src,
+    const size_t nelem,
+    const size_t size,
+    const uint8_t flip,
+    size_t counts[][256]
+) {
+    for (size_t i = 0; i < nelem; ++i, src += size) {
+        for (size_t d = 0; d + 1 < size; ++d) {
+            ++counts[d][src[DSC_SORT_DIGIT(d, size)]];
+        }
+        ++counts[size - 1][src[DSC_SORT_DIGIT(size - 1, size)] ^ flip];
+    }
+}
+
+// Moves every element of src to the offset its digit gives it in dst
+static inline void _dsc_sort_radix_scatter(
+    uint8_t *dst,
+    const uint8_t *src,
+    const size_t nelem,
+    const size_t size,
+    const size_t byte,
+    const uint8_t mask,
+    size_t *offsets
+) {
+    for (size_t i = 0; i < nelem; ++i, src += size) {
+        memcpy(dst + offsets[src[byte] ^ mask]++ * size, src, size);
+    }
+}
+
+/**
+ * Radix sort for one element width. It is always called with a constant size, so that the
+ * compiler produces a copy of the loops in which every element access is a single load.
+ */
+static inline void _dsc_sort_radix(
+    uint8_t *base,
+    uint8_t *tmp,
+    const size_t nelem,
+    const size_t size,
+    const uint8_t flip,
+    size_t counts[][256]
+) {
+    uint8_t *src = base, *dst = tmp;
+
+    _dsc_sort_radix_count(base, nelem, size, flip, counts);
+    for (size_t d = 0; d < size; ++d) {
+        const size_t byte = DSC_SORT_DIGIT(d, size);
+        const uint8_t mask = (d == size - 1) ? flip : 0x00;
+        size_t *count = counts[d];
+
+        // Every element shares this digit, so the pass would not move anything
+        if (count[src[byte] ^ mask] == nelem) {
+            continue;
+        }
+
+        // Turn the counts into starting offsets
+        for (size_t b = 0, offset = 0; b < 256; ++b) {
+            const size_t n = count[b];
+            count[b] = offset;
+            offset += n;
+        }
+        _dsc_sort_radix_scatter(dst, src, nelem, size, byte, mask, count);
+
+        uint8_t *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != base) {
+        memcpy(base, src, nelem * size);
+    }
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Sorts the buffer's elements in place with an introsort (quicksort that falls back to
+ * heapsort). The sort is not stable but needs no extra memory, and sorted or nearly sorted input
+ * is handled in linear time.
+ * @since 19-10-2026
+ * @param[in/out] buf The buffer being sorted
+ * @param[in] cmp The element comparison, as for qsort()
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_sort(Buffer_t *buf, compare_func cmp) {
+    if (buf == NULL || buf->base == NULL || buf->tsize == 0) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    return dsc_sort_array(buf->base, buf->bsize / buf->tsize, buf->tsize, cmp);
+}
+
+/**
+ * @brief Sorts a plain array in the same way as dsc_sort(). It is a drop-in replacement for qsort().
+ * @since 19-10-2026
+ * @param[in/out] base The array being sorted
+ * @param[in] nelem The number of elements
+ * @param[in] size The size of each element in bytes
+ * @param[in] cmp The element comparison, as for qsort()
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_sort_array(void *base, const size_t nelem, const size_t size, compare_func cmp) {
+    size_t depth = 0;
+
+    if ((base == NULL && nelem != 0) || cmp == NULL || size == 0) {
+        DSC_LOG("The array points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    for (size_t n = nelem; n > 1; n >>= 1) {
+        depth += 2;
+    }
+    _dsc_sort_intro(base, nelem, size, cmp, depth);
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Sorts the buffer's elements so that equal elements keep their relative order. This is
+ * a bottom-up merge sort over insertion-sorted runs and needs a scratch copy of the buffer,
+ * which comes from the buffer's allocator.
+ * @since 19-10-2026
+ * @param[in/out] buf The buffer being sorted
+ * @param[in] cmp The element comparison, as for qsort()
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_sort_stable(Buffer_t *buf, compare_func cmp) {
+    if (buf == NULL || buf->base == NULL || buf->tsize == 0 || cmp == NULL) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const size_t size = buf->tsize;
+    const size_t nelem = buf->bsize / size;
+    for (size_t lo = 0; lo < nelem; lo += DSC_SORT_RUN) {
+        const size_t n = (nelem - lo < DSC_SORT_RUN) ? nelem - lo : DSC_SORT_RUN;
+        _dsc_sort_insertion(_dsc_sort_at(buf->base, lo, size), n, size, cmp);
+    }
+    if (nelem <= DSC_SORT_RUN) {
+        return DSC_EOK;
+    }
+
+    uint8_t *tmp = dsc_alloc(buf->alloc, nelem * size);
+    if (tmp == NULL) {
+        DSC_LOG("Failed to allocate memory for stable sort", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    uint8_t *src = buf->base, *dst = tmp;
+    for (size_t width = DSC_SORT_RUN; width < nelem; width *= 2) {
+        for (size_t lo = 0; lo < nelem; lo += 2 * width) {
+            const size_t mid = (nelem - lo < width) ? nelem : lo + width;
+            const size_t hi = (nelem - mid < width) ? nelem : mid + width;
+            _dsc_sort_merge(src, dst, lo, mid, hi, size, cmp);
+        }
+        uint8_t *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    // After an odd number of passes the sorted data is in the scratch array
+    if (src != buf->base) {
+        memcpy(buf->base, src, nelem * size);
+    }
+    dsc_free(buf->alloc, tmp, nelem * size);
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Sorts a buffer of 1, 2, 4 or 8-byte integers with an LSD radix sort, one byte per pass.
+ * Every digit is counted in a single read of the buffer, and passes over a digit that all the
+ * elements share are skipped. The sort is stable and needs a scratch copy of the buffer, which
+ * comes from the buffer's allocator.
+ * @since 19-10-2026
+ * @param[in/out] buf The buffer being sorted
+ * @param[in] kind Whether the elements are signed or unsigned
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_sort_radix(Buffer_t *buf, const RadixKind_t kind) {
+    size_t counts[sizeof(uint64_t)][256] = { 0 };
+
+    if (buf == NULL || buf->base == NULL) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    const size_t size = buf->tsize;
+    const size_t nelem = buf->bsize / ((size != 0) ? size : 1);
+    if (size != 1 && size != 2 && size != 4 && size != 8) {
+        DSC_LOG("Radix sort only supports elements of 1, 2, 4 or 8 bytes", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (nelem < 2) {
+        return DSC_EOK;
+    }
+
+    uint8_t *tmp = dsc_alloc(buf->alloc, nelem * size);
+    if (tmp == NULL) {
+        DSC_LOG("Failed to allocate memory for radix sort", DSC_ERROR);
+        return DSC_ENOMEM;
+    }
+
+    // The sign bit is flipped when counting and scattering so that negative values order first
+    const uint8_t flip = (kind == RADIX_SIGNED) ? 0x80 : 0x00;
+    switch (size) {
+        case sizeof(uint8_t):  _dsc_sort_radix(buf->base, tmp, nelem, sizeof(uint8_t), flip, counts); break;
+        case sizeof(uint16_t): _dsc_sort_radix(buf->base, tmp, nelem, sizeof(uint16_t), flip, counts); break;
+        case sizeof(uint32_t): _dsc_sort_radix(buf->base, tmp, nelem, sizeof(uint32_t), flip, counts); break;
+        default:               _dsc_sort_radix(buf->base, tmp, nelem, sizeof(uint64_t), flip, counts); break;
+    }
+    dsc_free(buf->alloc, tmp, nelem * size);
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Sorts the buffer's elements using several threads (see dsc_parallel_sort()). Small
+ * buffers are sorted on the calling thread.
+ * @since 19-10-2026
+ * @param[in/out] buf The buffer being sorted
+ * @param[in] cmp The element comparison, as for qsort()
+ * @param[in] nthreads The number of threads, or 0 for one per online CPU
+ * @returns A DscError_t object containing the exit status code
+ */
+DscError_t dsc_sort_parallel(Buffer_t *buf, compare_func cmp, const size_t nthreads) {
+    if (buf == NULL || buf->base == NULL || buf->tsize == 0) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    return dsc_parallel_sort(buf->base, buf->bsize / buf->tsize, buf->tsize, cmp, nthreads);
+}
+
+/**
+ * @brief Finds the first element of a sorted buffer that does not order before key. Each step
+ * halves the range with a conditional move rather than a branch, so the search runs without
+ * branch mispredictions, and prefetches both candidates for the following step.
+ * @since 19-10-2026
+ * @param[in] buf The buffer being searched, sorted by cmp
+ * @param[in] key A pointer to the key, which is passed to cmp as its second argument
+ * @param[in] cmp The element comparison, as for qsort()
+ * @returns The index of that element, the buffer's element count if every element orders
+ *          before key, or 0 if any argument is invalid
+ */
+size_t dsc_lower_bound(const Buffer_t* const buf, const void* const key, compare_func cmp) {
+    if (buf == NULL || buf->base == NULL || buf->tsize == 0 || key == NULL || cmp == NULL) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return 0;
+    }
+
+    const size_t size = buf->tsize;
+    const uint8_t *base = buf->base;
+    size_t nelem = buf->bsize / size;
+
+    if (nelem == 0) {
+        return 0;
+    }
+
+    while (nelem > 1) {
+        const size_t half = nelem / 2;
+        const size_t next = (nelem - half) / 2;
+
+        // Fetch both elements the next step might compare, so that the step never waits on memory
+        __builtin_prefetch(base + next * size);
+        __builtin_prefetch(base + (half + next) * size);
+        base = (cmp(base + half * size, key) < 0) ? base + half * size : base;
+        nelem -= half;
+    }
+
+    return (size_t)(base - (const uint8_t*)buf->base) / size + (cmp(base, key) < 0);
+}
@@ -15,31 +15,42 @@
  */
 
 DscError_t dsc_stack_init(Stack_t *stack, void *data, const uint8_t tsize) {
-    dsc_buf_init((Buffer_t*)stack, 1, tsize);
+    return dsc_stack_init_alloc(stack, data, tsize, NULL);
+}
 
-    if (stack->base == NULL) {
+DscError_t dsc_stack_init_alloc(Stack_t *stack, void *data, const uint8_t tsize, const DscAllocator_t *alloc) {
+    // Shallow stacks stay inside the Stack_t and never reach the allocator
+    DscError_t status = dsc_buf_init_inline(stack, 1, tsize, alloc);
+    if (status != DSC_EOK) {
         DSC_LOG("Failed to allocate memory for stack", DSC_ERROR);
         return DSC_EFAIL;
     }
-    stack->base = data;
+
+    if (data != NULL) {
+        memcpy(stack->buf.base, data, tsize);
+    }
 
     return DSC_EOK;
 }
 
+DscError_t dsc_stack_destroy(Stack_t *stack) {
+    return dsc_buf_destroy(&stack->buf);
+}
+
 DscError_t dsc_stack_push(Stack_t *stack, void *data) {
     if (stack == NULL) {
         DSC_LOG("The stack points to an invalid address", DSC_ERROR);
         return DSC_EINVAL;
     }
 
-    size_t nelem = dsc_buf_nelem((Buffer_t*)stack);
-    DscError_t status = dsc_buf_resize((Buffer_t*)stack, nelem + 1);
+    size_t nelem = dsc_buf_nelem(&stack->buf);
+    DscError_t status = dsc_buf_resize(&stack->buf, nelem + 1);
     if (status != DSC_EOK) {
         return DSC_EFAIL;
     }
 
     if (data != NULL) {
-        memcpy((stack->base + (nelem * stack->tsize)), data, stack->tsize);
+        memcpy(((uint8_t*)stack->buf.base + (nelem * stack->buf.tsize)), data, stack->buf.tsize);
     }
 
     return DSC_EOK;
@@ -52,12 +63,17 @@ DscError_t dsc_stack_pop(Stack_t *stack) {
         return DSC_EINVAL;
     }
 
-    size_t nelem = dsc_buf_nelem((Buffer_t*)stack);
-    if (nelem == 1) {
-        stack->bsize = 0;
-        stack->base = NULL;
+    size_t nelem = dsc_buf_nelem(&stack->buf);
+    if (nelem == 0) {
+        DSC_LOG("The stack is empty", DSC_ERROR);
+        return DSC_ENODATA;
+    } else if (nelem == 1) {
+        // Hand any heap block back and return to the inline storage, ready for the next push
+        dsc_buf_destroy(&stack->buf);
+        stack->buf.base = stack->small;
+        stack->buf.backing = BUF_INLINE;
     } else {
-        DscError_t status = dsc_buf_resize((Buffer_t*)stack, nelem - 1);
+        DscError_t status = dsc_buf_resize(&stack->buf, nelem - 1);
         if (status != DSC_EOK) {
             return DSC_EFAIL;
         }
@@ -65,12 +81,3 @@ DscError_t dsc_stack_pop(Stack_t *stack) {
 
     return DSC_EOK;
 }
-
-void *dsc_stack_peek(const Stack_t* const stack) {
-    size_t nelem = dsc_buf_nelem((Buffer_t*)stack);
-    return stack->base + ((nelem - 1) * stack->tsize);
-}
-
-size_t dsc_stack_nelem(const Stack_t* const stack) {
-    return dsc_buf_nelem((const Buffer_t* const)stack);
-}
@@ -0,0 +1,197 @@
+/**
+ * @file stree.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a static search tree laid out in Eytzinger order for read-only sorted data.
+*/
+
+#include "stree.h"
+
+// A search prefetches the element this many levels below the one it is comparing against
+#define DSC_STREE_PREFETCH 4
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+static inline uint8_t *_dsc_stree_elem(const STree_t* const tree, const size_t k) {
+    return (uint8_t*)tree->data.base + k * tree->data.tsize;
+}
+
+/**
+ * Visits the Eytzinger indices in order, so that the elements can be copied from any source that
+ * yields them sorted. Recursion only goes log2(n) deep.
+ */
+static void _dsc_stree_fill_sorted(STree_t *tree, const uint8_t *sorted, size_t *next, const size_t k) {
+    if (k > tree->nelem) {
+        return;
+    }
+
+    _dsc_stree_fill_sorted(tree, sorted, next, 2 * k);
+    memcpy(_dsc_stree_elem(tree, k), sorted + (*next)++ * tree->data.tsize, tree->data.tsize);
+    _dsc_stree_fill_sorted(tree, sorted, next, 2 * k + 1);
+}
+
+// Returns false if the cursor stopped early (see BTreeCursor_t status) and k was left unfilled
+static bool _dsc_stree_fill_btree(STree_t *tree, BTreeCursor_t *cursor, const size_t k) {
+    if (k > tree->nelem) {
+        return true;
+    } else if (!_dsc_stree_fill_btree(tree, cursor, 2 * k) || cursor->node == NULL) {
+        return false;
+    }
+
+    memcpy(_dsc_stree_elem(tree, k), cursor->node->data, tree->data.tsize);
+    dsc_btree_cursor_next(cursor);
+    return _dsc_stree_fill_btree(tree, cursor, 2 * k + 1);
+}
+
+static DscError_t _dsc_stree_init(STree_t *tree, const size_t nelem, const size_t tsize, compare_func cmp) {
+    if (tree == NULL || cmp == NULL || tsize == 0 || tsize > UINT8_MAX) {
+        DSC_LOG("The tree points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    tree->nelem = nelem;
+    tree->cmp = cmp;
+    if (dsc_buf_init(&tree->data, nelem + 1, (uint8_t)tsize) != DSC_EOK) {
+        return DSC_ENOMEM;
+    }
+
+    return DSC_EOK;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Builds a static search tree from a buffer of sorted elements. The buffer is copied,
+ * so it may be destroyed afterwards.
+ * @since 19-10-2026
+ * @param[out] tree The tree to be initialized
+ * @param[in] sorted The elements in ascending order according to cmp
+ * @param[in] cmp Orders two elements, like the comparator passed to qsort()
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_stree_from_sorted(STree_t *tree, const Buffer_t* const sorted, compare_func cmp) {
+    size_t next = 0;
+
+    if (sorted == NULL || sorted->base == NULL) {
+        DSC_LOG("The buffer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    DscError_t status = _dsc_stree_init(tree, sorted->bsize / sorted->tsize, sorted->tsize, cmp);
+    if (status != DSC_EOK) {
+        return status;
+    }
+
+    _dsc_stree_fill_sorted(tree, sorted->base, &next, 1);
+    return DSC_EOK;
+}
+
+/**
+ * @brief Builds a static search tree from the data of every node of a binary tree, in order.
+ * The data is copied, so the binary tree may be destroyed afterwards.
+ * @since 19-10-2026
+ * @param[out] tree The tree to be initialized
+ * @param[in] root The root node of the binary tree
+ * @param[in] dsize The size of each node's data in bytes (at most 255)
+ * @param[in] cmp Orders two elements consistently with the binary tree's insert function
+ * @returns DSC_ENOMEM if memory ran out while walking the binary tree (tree is then left
+ *          uninitialized), otherwise a DscError_t exit status code
+ */
+DscError_t dsc_stree_from_btree(STree_t *tree, const BTreeNode_t root, const size_t dsize, compare_func cmp) {
+    BTreeCursor_t cursor;
+    size_t nelem = 0;
+
+    if (root == NULL) {
+        DSC_LOG("The node points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    for (BTreeNode_t node = dsc_btree_cursor_first(&cursor, root); node != NULL; node = dsc_btree_cursor_next(&cursor)) {
+        ++nelem;
+    }
+    DscError_t status = cursor.status;
+    dsc_btree_cursor_destroy(&cursor);
+    if (status != DSC_EOK) {
+        return status;
+    }
+
+    status = _dsc_stree_init(tree, nelem, dsize, cmp);
+    if (status != DSC_EOK) {
+        return status;
+    }
+
+    dsc_btree_cursor_first(&cursor, root);
+    if (!_dsc_stree_fill_btree(tree, &cursor, 1)) {
+        status = DSC_ENOMEM;
+        dsc_stree_destroy(tree);
+    }
+    dsc_btree_cursor_destroy(&cursor);
+
+    return status;
+}
+
+/**
+ * @brief Frees the memory held by a static search tree.
+ * @since 19-10-2026
+ * @param[in] tree The tree
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_stree_destroy(STree_t *tree) {
+    if (tree == NULL) {
+        DSC_LOG("The tree points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    tree->nelem = 0;
+    return dsc_buf_destroy(&tree->data);
+}
+
+/**
+ * @brief Returns the first element that does not order before key. The descent has no
+ * data-dependent branches: each comparison selects the child arithmetically, and the
+ * element DSC_STREE_PREFETCH levels further down is prefetched while the current one is compared.
+ * @since 19-10-2026
+ * @param[in] tree The tree
+ * @param[in] key The element to search for
+ * @returns A pointer to the element inside the tree, or NULL if every element orders before key
+ */
+const void *dsc_stree_lower_bound(const STree_t* const tree, const void* const key) {
+    const size_t ahead = (size_t)1 << DSC_STREE_PREFETCH;
+    size_t k = 1;
+
+    if (tree == NULL || tree->data.base == NULL || key == NULL) {
+        DSC_LOG("The tree points to an invalid address", DSC_ERROR);
+        return NULL;
+    }
+
+    while (k <= tree->nelem) {
+        // Only a hint; it never faults, even past the end of the array
+        __builtin_prefetch((const uint8_t*)tree->data.base + (k * ahead) * tree->data.tsize);
+        k = 2 * k + (tree->cmp(_dsc_stree_elem(tree, k), key) < 0);
+    }
+
+    // The search went left at the lower bound and right ever since; undo those right turns and that left turn
+    k >>= __builtin_ctzll(~(unsigned long long)k) + 1;
+    return (k != 0) ? _dsc_stree_elem(tree, k) : NULL;
+}
+
+/**
+ * @brief Searches the tree for an element equal to key.
+ * @since 19-10-2026
+ * @param[in] tree The tree
+ * @param[in] key The element to search for
+ * @returns A pointer to the element inside the tree, or NULL if there is none
+ */
+const void *dsc_stree_find(const STree_t* const tree, const void* const key) {
+    const void *elem = dsc_stree_lower_bound(tree, key);
+    return (elem != NULL && tree->cmp(elem, key) == 0) ? elem : NULL;
+}
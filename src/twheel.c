@@ -0,0 +1,280 @@
+/**
+ * @file twheel.c
+ * @author Neil Kingdom
+ * @version 1.0
+ * @since 19-10-2026
+ * @brief Provides a hierarchical timing wheel whose slots are intrusive doubly linked lists.
+*/
+
+#include "twheel.h"
+
+#define DSC_TWHEEL_MASK      (DSC_TWHEEL_SLOTS - 1)
+#define DSC_TWHEEL_MAX_DELTA ((1ULL << (DSC_TWHEEL_LEVELS * DSC_TWHEEL_BITS)) - 1)
+
+/*
+ * ===============================
+ *       Private Functions
+ * ===============================
+ */
+
+/**
+ * Links a timer into the slot that its expiry falls in, relative to the next tick to expire.
+ * A timer that is already due goes into the next slot to expire, and one beyond the top level
+ * is parked in its last slot and re-filed each time that slot cascades.
+ */
+static void _dsc_twheel_add(TimerWheel_t *wheel, Timer_t *timer) {
+    uint64_t at = (timer->expires > wheel->tick) ? timer->expires : wheel->tick;
+    uint64_t delta = at - wheel->tick;
+    size_t level = 0;
+
+    if (delta > DSC_TWHEEL_MAX_DELTA) {
+        delta = DSC_TWHEEL_MAX_DELTA;
+        at = wheel->tick + delta;
+    }
+    while (level < DSC_TWHEEL_LEVELS - 1 && delta >= (1ULL << ((level + 1) * DSC_TWHEEL_BITS))) {
+        ++level;
+    }
+
+    const size_t index = (at >> (level * DSC_TWHEEL_BITS)) & DSC_TWHEEL_MASK;
+    dsc_dll_append(&wheel->slots[level][index], &timer->link);
+    wheel->occupied[level][index / 64] |= 1ULL << (index % 64);
+}
+
+/**
+ * Re-files every timer of the slot that level covers at the current tick into the levels below.
+ * Returns the slot's index; the level above only needs cascading when this level wrapped to 0.
+ */
+static size_t _dsc_twheel_cascade(TimerWheel_t *wheel, const size_t level) {
+    const size_t index = (wheel->tick >> (level * DSC_TWHEEL_BITS)) & DSC_TWHEEL_MASK;
+    struct DLLNode work;
+
+    dsc_dll_init(&work, NULL);
+    dsc_dll_splice(&work, &wheel->slots[level][index]);
+    wheel->occupied[level][index / 64] &= ~(1ULL << (index % 64));
+    while (!dsc_dll_empty(&work)) {
+        Timer_t *timer = work.next->data;
+        dsc_dll_unlink(&timer->link);
+        _dsc_twheel_add(wheel, timer);
+    }
+
+    return index;
+}
+
+// Returns the first slot of a level at or after index that may hold timers, or DSC_TWHEEL_SLOTS
+static size_t _dsc_twheel_next_occupied(const TimerWheel_t* const wheel, const size_t level, const size_t index) {
+    for (size_t word = index / 64; word < DSC_TWHEEL_SLOTS / 64; ++word) {
+        uint64_t bits = wheel->occupied[level][word];
+        if (word == index / 64) {
+            bits &= ~0ULL << (index % 64);
+        }
+        if (bits != 0) {
+            return word * 64 + (size_t)__builtin_ctzll(bits);
+        }
+    }
+
+    return DSC_TWHEEL_SLOTS;
+}
+
+static bool _dsc_twheel_any_occupied(const TimerWheel_t* const wheel, const size_t level) {
+    for (size_t word = 0; word < DSC_TWHEEL_SLOTS / 64; ++word) {
+        if (wheel->occupied[level][word] != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Returns whether the cascade that starts at level on a tick has any timers to re-file
+static bool _dsc_twheel_cascades(const TimerWheel_t* const wheel, const uint64_t tick, size_t level) {
+    for (; level < DSC_TWHEEL_LEVELS; ++level) {
+        const size_t index = (tick >> (level * DSC_TWHEEL_BITS)) & DSC_TWHEEL_MASK;
+        if (wheel->occupied[level][index / 64] & (1ULL << (index % 64))) {
+            return true;
+        } else if (index != 0) {
+            break;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Returns the first tick from the current one on at which a level-0 slot may expire or an
+ * upper slot may cascade. Once a level has nothing left in its current rotation, the search
+ * moves to the tick at which it wraps, which is where the level above cascades next. A level
+ * with timers for its next rotation stops the search at that wrap.
+ */
+static uint64_t _dsc_twheel_next_event(const TimerWheel_t* const wheel) {
+    uint64_t tick = wheel->tick;
+
+    for (size_t level = 0; level < DSC_TWHEEL_LEVELS; ++level) {
+        const size_t shift = level * DSC_TWHEEL_BITS;
+        const size_t index = (tick >> shift) & DSC_TWHEEL_MASK;
+
+        // At index 0 the levels above cascade first, possibly into slots of this level
+        if (index == 0 && _dsc_twheel_cascades(wheel, tick, level + 1)) {
+            return tick;
+        }
+
+        const size_t next = _dsc_twheel_next_occupied(wheel, level, index);
+        if (next != DSC_TWHEEL_SLOTS) {
+            return tick + ((uint64_t)(next - index) << shift);
+        } else if (index != 0) {
+            tick += (uint64_t)(DSC_TWHEEL_SLOTS - index) << shift;
+            if (_dsc_twheel_any_occupied(wheel, level)) {
+                break;
+            }
+        }
+        // An empty level at index 0 wraps on this same tick, so the level above is searched from it
+    }
+
+    return tick;
+}
+
+/*
+ * ===============================
+ *       Public Functions
+ * ===============================
+ */
+
+/**
+ * @brief Prepares a timer for scheduling. A timer must be initialized once before its first use.
+ * @since 19-10-2026
+ * @param[out] timer The timer
+ * @param[in] func The function to call when the timer fires
+ * @param[in] ctx Passed as the second argument to func
+ */
+void dsc_timer_init(Timer_t *timer, timer_func func, void *ctx) {
+    dsc_dll_init(&timer->link, timer);
+    timer->expires = 0;
+    timer->func = func;
+    timer->ctx = ctx;
+}
+
+/**
+ * @brief Initializes an empty wheel. The wheel holds its slots inline and never allocates.
+ * @since 19-10-2026
+ * @param[out] wheel The wheel
+ * @param[in] now The current tick; timers that expire at or before it fire on the next advance
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_twheel_init(TimerWheel_t *wheel, const uint64_t now) {
+    if (wheel == NULL) {
+        DSC_LOG("The wheel points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    for (size_t level = 0; level < DSC_TWHEEL_LEVELS; ++level) {
+        for (size_t i = 0; i < DSC_TWHEEL_SLOTS; ++i) {
+            dsc_dll_init(&wheel->slots[level][i], NULL);
+        }
+    }
+    memset(wheel->occupied, 0, sizeof(wheel->occupied));
+    wheel->tick = now;
+    wheel->count = 0;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Schedules a timer to fire at a given tick, rescheduling it if it is already pending. O(1).
+ * @since 19-10-2026
+ * @param[in] wheel The wheel
+ * @param[in] timer An initialized timer
+ * @param[in] expires The tick at which the timer fires
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_twheel_schedule(TimerWheel_t *wheel, Timer_t *timer, const uint64_t expires) {
+    if (wheel == NULL || timer == NULL || timer->func == NULL) {
+        DSC_LOG("The timer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    }
+
+    if (dsc_timer_pending(timer)) {
+        dsc_dll_unlink(&timer->link);
+    } else {
+        ++wheel->count;
+    }
+    timer->expires = expires;
+    _dsc_twheel_add(wheel, timer);
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Stops a pending timer from firing. O(1).
+ * @since 19-10-2026
+ * @param[in] wheel The wheel
+ * @param[in] timer The timer
+ * @returns A DscError_t type corresponding to the exit status
+ */
+DscError_t dsc_twheel_cancel(TimerWheel_t *wheel, Timer_t *timer) {
+    if (wheel == NULL || timer == NULL) {
+        DSC_LOG("The timer points to an invalid address", DSC_ERROR);
+        return DSC_EINVAL;
+    } else if (!dsc_timer_pending(timer)) {
+        return DSC_ENODATA;
+    }
+
+    // The slot's occupancy bit is left set; it is cleared when the slot next expires or cascades
+    dsc_dll_unlink(&timer->link);
+    --wheel->count;
+
+    return DSC_EOK;
+}
+
+/**
+ * @brief Fires every timer that expires at or before now. Each level-0 slot is detached as a
+ * whole before its callbacks run, so a callback may schedule or cancel any timer, including its
+ * own; a timer scheduled for a tick that has passed fires on the following tick. Ticks whose
+ * slot is empty are skipped using the occupancy bitmaps rather than visited one at a time.
+ * @since 19-10-2026
+ * @param[in] wheel The wheel
+ * @param[in] now The current tick
+ * @returns The number of timers that fired
+ */
+size_t dsc_twheel_advance(TimerWheel_t *wheel, const uint64_t now) {
+    struct DLLNode work;
+    size_t nfired = 0;
+
+    if (wheel == NULL) {
+        DSC_LOG("The wheel points to an invalid address", DSC_ERROR);
+        return 0;
+    }
+
+    dsc_dll_init(&work, NULL);
+    while (wheel->tick <= now) {
+        if (wheel->count == 0) {
+            wheel->tick = now + 1;
+            break;
+        }
+
+        const size_t index = wheel->tick & DSC_TWHEEL_MASK;
+        if (index == 0) {
+            for (size_t level = 1; level < DSC_TWHEEL_LEVELS && _dsc_twheel_cascade(wheel, level) == 0; ++level) {}
+        }
+
+        if (!(wheel->occupied[0][index / 64] & (1ULL << (index % 64)))) {
+            // Nothing expires on this tick, so jump to the next one that has a slot to expire or cascade
+            ++wheel->tick;
+            const uint64_t next = _dsc_twheel_next_event(wheel);
+            wheel->tick = (next <= now) ? next : now + 1;
+            continue;
+        }
+
+        wheel->occupied[0][index / 64] &= ~(1ULL << (index % 64));
+        dsc_dll_splice(&work, &wheel->slots[0][index]);
+        ++wheel->tick;
+
+        while (!dsc_dll_empty(&work)) {
+            Timer_t *timer = work.next->data;
+            dsc_dll_unlink(&timer->link);
+            --wheel->count;
+            ++nfired;
+            timer->func(timer, timer->ctx);
+        }
+    }
+
+    return nfired;
+}
@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "bitvec.h"
+
+#define NBITS 100003 // Not a multiple of the word or block size
+
+static uint64_t next_rand(uint64_t *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// Checks rank at every position and select for every set bit against a plain scan
+static void check_rank_select(const BitVec_t* const bv) {
+    size_t ones = 0;
+
+    for (size_t i = 0; i < dsc_bitvec_nbits(bv); ++i) {
+        ck_assert_uint_eq(dsc_bitvec_rank(bv, i), ones);
+        if (dsc_bitvec_get(bv, i)) {
+            ck_assert_uint_eq(dsc_bitvec_select(bv, ones), i);
+            ++ones;
+        }
+    }
+    ck_assert_uint_eq(dsc_bitvec_rank(bv, dsc_bitvec_nbits(bv)), ones);
+    ck_assert_uint_eq(dsc_bitvec_ones(bv), ones);
+    ck_assert_uint_eq(dsc_bitvec_select(bv, ones), dsc_bitvec_nbits(bv));
+}
+
+START_TEST(RankSelect) {
+    BitVec_t bv;
+    uint64_t state = 88172645463325252ULL;
+    // Percent of bits set: empty, sparse (long runs of empty blocks), even, dense and full
+    const unsigned density[] = { 0, 1, 50, 97, 100 };
+
+    for (size_t d = 0; d < sizeof(density) / sizeof(density[0]); ++d) {
+        ck_assert_int_eq(dsc_bitvec_init(&bv, NBITS), DSC_EOK);
+        for (size_t i = 0; i < NBITS; ++i) {
+            if (next_rand(&state) % 100 < density[d]) {
+                ck_assert_int_eq(dsc_bitvec_set(&bv, i, true), DSC_EOK);
+            }
+        }
+        ck_assert_int_eq(dsc_bitvec_build(&bv), DSC_EOK);
+        check_rank_select(&bv);
+
+        // Clearing bits and rebuilding updates the index
+        for (size_t i = 0; i < NBITS; i += 3) {
+            ck_assert_int_eq(dsc_bitvec_set(&bv, i, false), DSC_EOK);
+        }
+        ck_assert_int_eq(dsc_bitvec_build(&bv), DSC_EOK);
+        check_rank_select(&bv);
+        ck_assert_int_eq(dsc_bitvec_destroy(&bv), DSC_EOK);
+    }
+
+    ck_assert_int_eq(dsc_bitvec_init(&bv, 64), DSC_EOK);
+    ck_assert_int_eq(dsc_bitvec_set(&bv, 64, true), DSC_EINVAL);
+    ck_assert_int_eq(dsc_bitvec_set(&bv, 63, true), DSC_EOK);
+    ck_assert_int_eq(dsc_bitvec_build(&bv), DSC_EOK);
+    ck_assert_uint_eq(dsc_bitvec_rank(&bv, 64), 1);
+    ck_assert_uint_eq(dsc_bitvec_select(&bv, 0), 63);
+    ck_assert_int_eq(dsc_bitvec_destroy(&bv), DSC_EOK);
+    ck_assert_int_eq(dsc_bitvec_init(NULL, 64), DSC_EINVAL);
+}
+END_TEST
+
+Suite *bitvec_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("BitVec");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, RankSelect);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = bitvec_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
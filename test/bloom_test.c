@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "bloom.h"
+
+#define NKEYS 100000
+
+START_TEST(Membership) {
+    Bloom_t bloom = { 0 };
+    size_t fps = 0;
+
+    ck_assert_int_eq(dsc_bloom_init(&bloom, NKEYS, 10, sizeof(uint64_t), NULL), DSC_EOK);
+    for (uint64_t key = 0; key < NKEYS; ++key) {
+        ck_assert_int_eq(dsc_bloom_add(&bloom, &key), DSC_EOK);
+    }
+    ck_assert_uint_eq(dsc_bloom_count(&bloom), NKEYS);
+
+    // No false negatives, and about 1% false positives at 10 bits per key
+    for (uint64_t key = 0; key < NKEYS; ++key) {
+        ck_assert(dsc_bloom_contains(&bloom, &key));
+    }
+    for (uint64_t key = NKEYS; key < 2 * NKEYS; ++key) {
+        fps += dsc_bloom_contains(&bloom, &key);
+    }
+    ck_assert_uint_lt(fps, NKEYS / 50);
+    dsc_bloom_destroy(&bloom);
+}
+END_TEST
+
+START_TEST(StringKeys) {
+    Bloom_t bloom = { 0 };
+    const char *words[] = { "alpha", "beta", "gamma", "delta" };
+
+    dsc_bloom_init(&bloom, 100, 16, 0, murmur3_hash);
+    for (size_t i = 0; i < 4; ++i) {
+        dsc_bloom_add(&bloom, words[i]);
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        ck_assert(dsc_bloom_contains(&bloom, words[i]));
+    }
+    ck_assert(dsc_bloom_contains_hash(&bloom, murmur3_hash("gamma", 6)));
+    ck_assert(!dsc_bloom_contains(&bloom, "epsilon"));
+    dsc_bloom_destroy(&bloom);
+}
+END_TEST
+
+Suite *bloom_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Bloom");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, Membership);
+    tcase_add_test(tc_core, StringKeys);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = bloom_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
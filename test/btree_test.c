@@ -10,12 +10,13 @@ START_TEST(CreateBTree) {
     BTreeNode_t root = dsc_btree_create((void*)strdup(greeting), NULL, DFS);
     ck_assert_str_eq((char*)root->data, greeting);
     ck_assert_int_eq((int)root->id, 0);
+    free(root->data);
     dsc_btree_destroy(root);
 }
 END_TEST
 
 static InsertCmp_t add_test_insert_func(const BTreeNode_t node, const BTreeNode_t cmp) {
-    if (*((int*)node->data) < *((int*)cmp->data)) {
+    if (*((int*)cmp->data) < *((int*)node->data)) {
         return INSERT_LT;
     } else {
         return INSERT_GT;
@@ -28,7 +29,7 @@ START_TEST(AddBTreeNode) {
     int nums_size = sizeof(unordered_nums) / sizeof(*unordered_nums);
 
     BTreeNode_t root = dsc_btree_create((void*)&unordered_nums[4], NULL, DFS); // Root will contain 8
-    BTreeNode_t *list = malloc(sizeof(struct BTreeNode) * nums_size);
+    BTreeNode_t *list = malloc(sizeof(BTreeNode_t) * nums_size);
     ck_assert(list);
 
     for (int i = 0; i < nums_size; ++i) {
@@ -36,7 +37,7 @@ START_TEST(AddBTreeNode) {
         dsc_btree_add(root, (void*)&unordered_nums[i], NULL, add_test_insert_func);
     }
 
-    dsc_btree_flatten(root, list);
+    ck_assert_int_eq(dsc_btree_flatten(root, list), DSC_EOK);
     for (int i = 0; i < nums_size; ++i) {
         ck_assert_int_eq(*((int*)(list[i]->data)), ordered_nums[i]);
     }
@@ -46,23 +47,23 @@ START_TEST(AddBTreeNode) {
 }
 END_TEST
 
-static InsertCriteria get_btree_node_insert_func(const pBTreeNode_t comp_to, const pBTreeNode_t node) {
-    if (*DSC_BUF_CHAR(node->data) < *DSC_BUF_CHAR(comp_to->data)) {
-        return INSERT_GT;
-    } else {
+static InsertCmp_t get_btree_node_insert_func(const BTreeNode_t node, const BTreeNode_t cmp) {
+    if (*(char*)cmp->data < *(char*)node->data) {
         return INSERT_LT;
+    } else {
+        return INSERT_GT;
     }
 }
 
-static SortCriteria get_btree_node_sort_func(const pBTreeNode_t node) {
+static SearchCmp_t get_btree_node_search_func(const BTreeNode_t node) {
     char needle = 'p';
 
-    if (*DSC_BUF_CHAR(node->data) < needle) {
-        return SORT_LT;
-    } else if (*DSC_BUF_CHAR(node->data) > needle) {
-        return SORT_GT;
+    if (needle < *(char*)node->data) {
+        return SEARCH_LT;
+    } else if (needle > *(char*)node->data) {
+        return SEARCH_GT;
     } else {
-        return SORT_EQ;
+        return SEARCH_EQ;
     }
 }
 
@@ -72,54 +73,41 @@ START_TEST(GetBTreeNode) {
     char haystack[] = { 'z', 'q', 'r', 'a', 's', 'p', 'm', 'i', 'c' };
     int hs_size = sizeof(haystack) / sizeof(*haystack);
 
-    pBTreeNode_t root = dsc_create_btree(1, sizeof(middle), (void*)&middle);
+    BTreeNode_t root = dsc_btree_create((void*)&middle, NULL, DFS);
     for (i = 0; i < hs_size; ++i) {
-        dsc_add_btree_node(root, (void*)&haystack[i], 1, get_btree_node_insert_func);
+        dsc_btree_add(root, (void*)&haystack[i], NULL, get_btree_node_insert_func);
     }
 
-    pBTreeNode_t needle = dsc_get_btree_node(root, get_btree_node_sort_func);
+    BTreeNode_t needle = dsc_btree_peek(root, get_btree_node_search_func);
     ck_assert_ptr_nonnull(needle);
-    ck_assert_int_eq((int)*DSC_BUF_CHAR(needle->data), (int)'p');
+    ck_assert_int_eq((int)*(char*)needle->data, (int)'p');
 
-    pBTreeNode_t parent = dsc_get_btree_node_parent(root, get_btree_node_sort_func);
-    ck_assert_int_eq((int)*DSC_BUF_CHAR(parent->data), (int)'q');
+    BTreeNode_t parent = dsc_btree_peek_parent(root, get_btree_node_search_func);
+    ck_assert_ptr_nonnull(parent);
+    ck_assert_int_eq((int)*(char*)parent->data, (int)'q');
 
-    dsc_destroy_btree(root);
+    dsc_btree_destroy(root);
 }
 END_TEST
 
-#define DSC_MIN(x, y) (((x) < (y)) ? (x) : (y))
-
-static InsertCriteria remove_btree_node_insert_func(const pBTreeNode_t comp_to, const pBTreeNode_t node) {
-    int i;
-    const char *comp_to_as_str = DSC_BUF_CHAR(comp_to->data);
-    const char *node_as_str = DSC_BUF_CHAR(node->data);
-    size_t min = DSC_MIN(strlen(comp_to_as_str), strlen(node_as_str));
-
+static InsertCmp_t remove_btree_node_insert_func(const BTreeNode_t node, const BTreeNode_t cmp) {
     /* Sort alphabetically */
-    for (i = 0; i < min; ++i) {
-        if (tolower((int)node_as_str[i]) > tolower((int)comp_to_as_str[i])) {
-            return INSERT_GT;
-        } else if (tolower((int)node_as_str[i]) < tolower((int)comp_to_as_str[i])) {
-            return INSERT_LT;
-        } else {
-            continue;
-        }
+    if (strcmp((char*)cmp->data, (char*)node->data) < 0) {
+        return INSERT_LT;
+    } else {
+        return INSERT_GT;
     }
-
-    /* Arbitrary decision to return INSERT_LT in case where letters are same up until min indices */
-    return INSERT_LT;
 }
 
-static SortCriteria remove_btree_node_sort_func(const pBTreeNode_t node) {
+static SearchCmp_t remove_btree_node_search_func(const BTreeNode_t node) {
     const char *remove = "may";
 
-    if (strcmp(remove, DSC_BUF_CHAR(node->data)) < 0) {
-        return SORT_LT;
-    } else if (strcmp(remove, DSC_BUF_CHAR(node->data)) > 0) {
-        return SORT_GT;
+    if (strcmp(remove, (char*)node->data) < 0) {
+        return SEARCH_LT;
+    } else if (strcmp(remove, (char*)node->data) > 0) {
+        return SEARCH_GT;
     } else {
-        return SORT_EQ;
+        return SEARCH_EQ;
     }
 }
 
@@ -129,26 +117,371 @@ START_TEST(RemoveBTreeNode) {
     const char *expected[] = { "a", "sentence", "words" };
     int ssize = sizeof(sentence) / sizeof(*sentence);
     int esize = sizeof(expected) / sizeof(*expected);
-    pBTreeNode_t root = dsc_create_btree(strlen(sentence[0]) + 1, sizeof(char), (void*)sentence[0]);
-    pBTreeNode_t *list = malloc(sizeof(pBTreeNode_t) * esize);
+    BTreeNode_t root = dsc_btree_create((void*)sentence[0], NULL, DFS);
+    BTreeNode_t *list = malloc(sizeof(BTreeNode_t) * esize);
 
     for (i = 1; i < ssize; ++i) {
-        dsc_add_btree_node(root, (void*)sentence[i], strlen(sentence[i]) + 1, remove_btree_node_insert_func);
+        dsc_btree_add(root, (void*)sentence[i], NULL, remove_btree_node_insert_func);
     }
 
-    dsc_remove_btree_node(root, remove_btree_node_sort_func);
-    dsc_get_btree_node_list(root, list, esize, IN_ORDER);
+    // Removing "may" also removes "contain" and "many", which sit below it
+    ck_assert_int_eq(dsc_btree_remove(root, remove_btree_node_search_func), DSC_EOK);
+    ck_assert_int_eq(dsc_btree_flatten(root, list), DSC_EOK);
 
     for (i = 0; i < esize; ++i) {
-        ck_assert_str_eq(DSC_BUF_CHAR(list[i]->data), expected[i]);
+        ck_assert_str_eq((char*)list[i]->data, expected[i]);
     }
 
-    dsc_destroy_btree(root);
+    dsc_btree_destroy(root);
     free(list);
 }
 END_TEST
 
-Suite *buffer_suite(void) {
+static InsertCmp_t snapshot_insert_func(const BTreeNode_t node, const BTreeNode_t cmp) {
+    return (*(int*)cmp->data < *(int*)node->data) ? INSERT_LT : INSERT_GT;
+}
+
+static SearchCmp_t snapshot_search_func(const BTreeNode_t node) {
+    const int needle = 21;
+    if (needle < *(int*)node->data) {
+        return SEARCH_LT;
+    } else if (needle > *(int*)node->data) {
+        return SEARCH_GT;
+    } else {
+        return SEARCH_EQ;
+    }
+}
+
+START_TEST(SnapshotBTree) {
+    int nums[] = { 8, 5, 2, 10, 7, 21, 3 };
+    const char *path = "dsc_btree_test.snap";
+    Snapshot_t snap = { 0 };
+    size_t id = 0;
+
+    BTreeNode_t root = dsc_btree_create(&nums[0], NULL, DFS);
+    for (size_t i = 1; i < sizeof(nums) / sizeof(*nums); ++i) {
+        id = i;
+        dsc_btree_add(root, &nums[i], &id, snapshot_insert_func);
+    }
+    ck_assert_int_eq(dsc_btree_save(root, sizeof(int), path), DSC_EOK);
+    dsc_btree_destroy(root);
+
+    ck_assert_int_eq(dsc_snapshot_open(&snap, path), DSC_EOK);
+    const int *found = dsc_btree_snapshot_peek(&snap, snapshot_search_func, &id);
+    ck_assert_ptr_nonnull(found);
+    ck_assert_int_eq(*found, 21);
+    ck_assert_int_eq(id, 5);
+
+    BTreeNode_t loaded = dsc_btree_load(&snap, DFS, NULL);
+    ck_assert_ptr_nonnull(loaded);
+    ck_assert_int_eq(*(int*)dsc_btree_peek(loaded, snapshot_search_func)->data, 21);
+    dsc_btree_destroy(loaded);
+
+    dsc_snapshot_close(&snap);
+    unlink(path);
+}
+END_TEST
+
+// Mirrors the snapshot layout described in btree.c, so that tests can corrupt an image
+typedef struct {
+    SnapshotHeader_t hdr;
+    uint64_t nnodes;
+    uint64_t dsize;
+    uint64_t nodes_off;
+    uint64_t data_off;
+} TestSnapshot_t;
+
+typedef struct {
+    uint64_t id;
+    uint32_t left;
+    uint32_t right;
+} TestSnapNode_t;
+
+static uint8_t *read_image(const char *path, size_t *size) {
+    FILE *file = fopen(path, "rb");
+    ck_assert_ptr_nonnull(file);
+    fseek(file, 0, SEEK_END);
+    *size = (size_t)ftell(file);
+    rewind(file);
+    uint8_t *image = malloc(*size);
+    ck_assert_ptr_nonnull(image);
+    ck_assert_uint_eq(fread(image, 1, *size, file), *size);
+    fclose(file);
+    return image;
+}
+
+START_TEST(LoadCorruptBTree) {
+    int nums[] = { 8, 5, 2, 10, 7, 21, 3 };
+    const char *path = "dsc_btree_corrupt.snap";
+    Snapshot_t snap = { 0 };
+    size_t id = 0, size = 0;
+
+    BTreeNode_t root = dsc_btree_create(&nums[0], NULL, DFS);
+    for (size_t i = 1; i < sizeof(nums) / sizeof(*nums); ++i) {
+        id = i;
+        dsc_btree_add(root, &nums[i], &id, snapshot_insert_func);
+    }
+    ck_assert_int_eq(dsc_btree_save(root, sizeof(int), path), DSC_EOK);
+    dsc_btree_destroy(root);
+
+    uint8_t *image = read_image(path, &size);
+    unlink(path);
+    const TestSnapshot_t *hdr = (const TestSnapshot_t*)image;
+    TestSnapNode_t *table = (TestSnapNode_t*)(image + hdr->nodes_off);
+
+    // In pre-order the root (8) is node 0, its left child (5) node 1 and its right child (10) node 5
+    ck_assert_uint_eq(table[0].left, 1);
+    ck_assert_uint_eq(table[0].right, 5);
+
+    // A node linked under two parents
+    const uint32_t right = table[1].right;
+    table[1].right = table[0].right;
+    ck_assert_int_eq(dsc_snapshot_from(&snap, image, size), DSC_EOK);
+    ck_assert_ptr_null(dsc_btree_load(&snap, DFS, NULL));
+    table[1].right = right;
+
+    // A link back to an earlier node
+    table[1].right = 0;
+    ck_assert_ptr_null(dsc_btree_load(&snap, DFS, NULL));
+
+    // A link past the last node
+    table[1].right = (uint32_t)hdr->nnodes;
+    ck_assert_ptr_null(dsc_btree_load(&snap, DFS, NULL));
+    table[1].right = right;
+
+    root = dsc_btree_load(&snap, DFS, NULL);
+    ck_assert_ptr_nonnull(root);
+    dsc_btree_destroy(root);
+
+    free(image);
+}
+END_TEST
+
+static int build_cmp(const void *lhs, const void *rhs) {
+    const int a = *(const int*)lhs;
+    const int b = *(const int*)rhs;
+    return (a > b) - (a < b);
+}
+
+// Walks the tree in order, checking that it visits ids 0, 1, 2... and that the data ascends
+static size_t build_check(const BTreeNode_t node, size_t next, size_t depth, size_t *max_depth) {
+    if (node == NULL) {
+        *max_depth = (depth > *max_depth) ? depth : *max_depth;
+        return next;
+    }
+    next = build_check(node->left, next, depth + 1, max_depth);
+    ck_assert_int_eq(node->id, next);
+    ck_assert_int_eq(*(int*)node->data, (int)next * 3);
+    return build_check(node->right, next + 1, depth + 1, max_depth);
+}
+
+START_TEST(BuildBTree) {
+    const size_t n = 50000;
+    int *nums = malloc(n * sizeof(int));
+    size_t depth = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        nums[i] = (int)i * 3;
+    }
+    BTreeNode_t sorted = dsc_btree_build_from_sorted(nums, n, sizeof(int), DFS, NULL);
+    ck_assert_ptr_nonnull(sorted);
+    ck_assert_int_eq(build_check(sorted, 0, 0, &depth), n);
+    ck_assert_int_le(depth, 17); // ceil(log2(n + 1)) + 1 for the NULL leaves
+    ck_assert_int_eq(dsc_btree_destroy(sorted), DSC_EOK);
+
+    // Reverse the array so that the parallel build has to sort it first
+    for (size_t i = 0; i < n; ++i) {
+        nums[i] = (int)(n - 1 - i) * 3;
+    }
+    BTreeNode_t built = dsc_btree_build(nums, n, sizeof(int), build_cmp, 4, DFS, NULL);
+    ck_assert_ptr_nonnull(built);
+    depth = 0;
+    ck_assert_int_eq(build_check(built, 0, 0, &depth), n);
+    ck_assert_int_le(depth, 17);
+    ck_assert_int_eq(dsc_btree_destroy_parallel(built, 4), DSC_EOK);
+
+    free(nums);
+}
+END_TEST
+
+/*
+ * Allocator that fails once the budget in *ctx runs out (a negative budget never runs out). The
+ * build workers share the budget, so it is taken atomically.
+ */
+static bool build_take(void *ctx) {
+    int *budget = ctx;
+    int cur = __atomic_load_n(budget, __ATOMIC_RELAXED);
+    while (cur > 0 && !__atomic_compare_exchange_n(budget, &cur, cur - 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    return cur != 0;
+}
+
+static void *build_alloc(void *ctx, size_t size) {
+    return build_take(ctx) ? malloc(size) : NULL;
+}
+
+static void *build_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)old_size;
+    return build_take(ctx) ? realloc(ptr, new_size) : NULL;
+}
+
+static void build_free(void *ctx, void *ptr, size_t size) {
+    (void)ctx;
+    (void)size;
+    free(ptr);
+}
+
+START_TEST(BuildBTreeFailure) {
+    const size_t n = 50000;
+    int *nums = malloc(n * sizeof(int));
+    int budget = -1;
+    DscAllocator_t alloc = { build_alloc, build_realloc, build_free, &budget, NULL };
+
+    for (size_t i = 0; i < n; ++i) {
+        nums[i] = (int)i * 3;
+    }
+
+    // Fail the scratch array, a node of the top levels, then a node built by a worker; every
+    // node created before the failure must be freed
+    const int fails[] = { 0, 1, 2, (int)n / 2 };
+    for (size_t f = 0; f < sizeof(fails) / sizeof(*fails); ++f) {
+        budget = fails[f];
+        ck_assert_ptr_null(dsc_btree_build(nums, n, sizeof(int), build_cmp, 4, DFS, &alloc));
+        budget = -1;
+    }
+
+    // Destroying falls back to the calling thread rather than leaking the subtrees
+    BTreeNode_t built = dsc_btree_build(nums, n, sizeof(int), build_cmp, 4, DFS, &alloc);
+    ck_assert_ptr_nonnull(built);
+    budget = 0;
+    ck_assert_int_eq(dsc_btree_destroy_parallel(built, 4), DSC_EOK);
+    budget = -1;
+
+    free(nums);
+}
+END_TEST
+
+static int range_lo;
+static int range_hi;
+
+static SearchCmp_t range_lo_func(const BTreeNode_t node) {
+    const int value = *(int*)node->data;
+    return (range_lo < value) ? SEARCH_LT : (range_lo > value) ? SEARCH_GT : SEARCH_EQ;
+}
+
+static SearchCmp_t range_hi_func(const BTreeNode_t node) {
+    const int value = *(int*)node->data;
+    return (range_hi < value) ? SEARCH_LT : (range_hi > value) ? SEARCH_GT : SEARCH_EQ;
+}
+
+static void range_visit(const BTreeNode_t node, void *ctx) {
+    int *sum = ctx;
+    *sum += *(int*)node->data;
+}
+
+START_TEST(CursorRange) {
+    int nums[1000];
+    BTreeCursor_t cursor;
+    BTreeNode_t node;
+    int expect = 0;
+
+    for (int i = 0; i < 1000; ++i) {
+        nums[i] = i * 2; // Even numbers only, so that odd bounds fall between nodes
+    }
+    BTreeNode_t root = dsc_btree_build_from_sorted(nums, 1000, sizeof(int), DFS, NULL);
+
+    expect = 0;
+    for (node = dsc_btree_cursor_first(&cursor, root); node != NULL; node = dsc_btree_cursor_next(&cursor)) {
+        ck_assert_int_eq(*(int*)node->data, expect);
+        expect += 2;
+    }
+    ck_assert_int_eq(expect, 2000);
+    dsc_btree_cursor_destroy(&cursor);
+
+    range_lo = 101;
+    ck_assert_int_eq(*(int*)dsc_btree_lower_bound(root, range_lo_func)->data, 102);
+    range_lo = 100;
+    ck_assert_int_eq(*(int*)dsc_btree_lower_bound(root, range_lo_func)->data, 100);
+    ck_assert_int_eq(*(int*)dsc_btree_upper_bound(root, range_lo_func)->data, 102);
+    range_lo = 1998;
+    ck_assert_ptr_null(dsc_btree_upper_bound(root, range_lo_func));
+
+    range_lo = 10;
+    node = dsc_btree_cursor_upper_bound(&cursor, root, range_lo_func);
+    ck_assert_int_eq(*(int*)node->data, 12);
+    ck_assert_int_eq(*(int*)dsc_btree_cursor_next(&cursor)->data, 14);
+    dsc_btree_cursor_destroy(&cursor);
+
+    // [100, 201) holds 100, 102, ..., 200
+    int sum = 0;
+    range_lo = 100;
+    range_hi = 201;
+    ck_assert_int_eq(dsc_btree_range(root, range_lo_func, range_hi_func, range_visit, &sum), DSC_EOK);
+    ck_assert_int_eq(sum, (100 + 200) * 51 / 2);
+
+    BTreeNode_t list[1000];
+    ck_assert_int_eq(dsc_btree_flatten(root, list), DSC_EOK);
+    ck_assert_int_eq(*(int*)list[999]->data, 1998);
+
+    dsc_btree_destroy(root);
+}
+END_TEST
+
+// Allocator that fails every request while *ctx is true
+static void *oom_alloc(void *ctx, size_t size) {
+    return *(bool*)ctx ? NULL : malloc(size);
+}
+
+static void *oom_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)old_size;
+    return *(bool*)ctx ? NULL : realloc(ptr, new_size);
+}
+
+static void oom_free(void *ctx, void *ptr, size_t size) {
+    (void)ctx;
+    (void)size;
+    free(ptr);
+}
+
+START_TEST(CursorOutOfMemory) {
+    int nums[64];
+    bool fail = false;
+    DscAllocator_t alloc = { oom_alloc, oom_realloc, oom_free, &fail, NULL };
+    BTreeNode_t list[64];
+    BTreeCursor_t cursor;
+    int sum = 0;
+
+    // 0 at the root with 63, 62, ..., 1 as a left spine under its right child, so that the
+    // cursor only outgrows its inline path after it has moved past the root
+    nums[0] = 0;
+    BTreeNode_t root = dsc_btree_create_alloc(&nums[0], NULL, DFS, &alloc);
+    for (int i = 1; i < 64; ++i) {
+        nums[i] = 64 - i;
+        dsc_btree_add(root, &nums[i], NULL, add_test_insert_func);
+    }
+    fail = true;
+
+    ck_assert_ptr_eq(dsc_btree_cursor_first(&cursor, root), root);
+    ck_assert_int_eq(cursor.status, DSC_EOK);
+    ck_assert_ptr_null(dsc_btree_cursor_next(&cursor));
+    ck_assert_int_eq(cursor.status, DSC_ENOMEM);
+    dsc_btree_cursor_destroy(&cursor);
+
+    ck_assert_int_eq(dsc_btree_flatten(root, list), DSC_ENOMEM);
+    range_lo = 0;
+    range_hi = 64;
+    ck_assert_int_eq(dsc_btree_range(root, range_lo_func, range_hi_func, range_visit, &sum), DSC_ENOMEM);
+
+    fail = false;
+    ck_assert_int_eq(dsc_btree_flatten(root, list), DSC_EOK);
+    for (int i = 0; i < 64; ++i) {
+        ck_assert_int_eq(*(int*)list[i]->data, i);
+    }
+
+    dsc_btree_destroy(root);
+}
+END_TEST
+
+Suite *btree_suite(void) {
     Suite *s;
     TCase *tc_core;
 
@@ -160,6 +493,12 @@ Suite *buffer_suite(void) {
     tcase_add_test(tc_core, AddBTreeNode);
     tcase_add_test(tc_core, GetBTreeNode);
     tcase_add_test(tc_core, RemoveBTreeNode);
+    tcase_add_test(tc_core, SnapshotBTree);
+    tcase_add_test(tc_core, LoadCorruptBTree);
+    tcase_add_test(tc_core, BuildBTree);
+    tcase_add_test(tc_core, BuildBTreeFailure);
+    tcase_add_test(tc_core, CursorRange);
+    tcase_add_test(tc_core, CursorOutOfMemory);
     suite_add_tcase(s, tc_core);
 
     return s;
@@ -170,7 +509,7 @@ int main(void) {
     Suite *s;
     SRunner *sr;
 
-    s = buffer_suite();
+    s = btree_suite();
     sr = srunner_create(s);
 
     srunner_run_all(sr, CK_NORMAL);
@@ -2,15 +2,34 @@
 
 #include "dsc_common.h"
 #include "buffer.h"
+#include "buffer_internal.h"
+
+static void *test_alloc(void *ctx, size_t size) {
+    (void)ctx;
+    return malloc(size);
+}
+
+static void *test_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)ctx;
+    (void)old_size;
+    return realloc(ptr, new_size);
+}
+
+static void test_free(void *ctx, void *ptr, size_t size) {
+    (void)ctx;
+    (void)size;
+    free(ptr);
+}
 
 START_TEST(CreateBuffer) {
     Buffer_t buf = { 0 };
     dsc_buf_init(&buf, 10, sizeof(int));
 
-    ck_assert_ptr_nonnull(buf.addr);
+    ck_assert_ptr_nonnull(buf.base);
     ck_assert_int_eq(buf.tsize, sizeof(int));
     ck_assert_int_eq(buf.bsize, 10 * sizeof(int));
     ck_assert_int_eq(dsc_buf_nelem(&buf), 10);
+    dsc_buf_destroy(&buf);
 }
 END_TEST
 
@@ -26,15 +45,174 @@ START_TEST(ResizeBuffer) {
     ck_assert_int_eq(buf.tsize, sizeof(short));
     ck_assert_int_eq(buf.bsize, 10 * sizeof(short));
     ck_assert_int_eq(dsc_buf_nelem(&buf), 10);
+    dsc_buf_destroy(&buf);
 }
 END_TEST
 
 START_TEST(Memcpy) {
     const char *test_str = "Hello, World!";
     Buffer_t buf = { 0 };
-    dsc_buf_init(&buf, 1, sizeof(char*));
-    memcpy(buf.addr, test_str, strlen(test_str) + 1);
-    ck_assert_str_eq((char*)buf.addr, test_str);
+    dsc_buf_init(&buf, strlen(test_str) + 1, sizeof(char));
+    memcpy(buf.base, test_str, strlen(test_str) + 1);
+    ck_assert_str_eq((char*)buf.base, test_str);
+    dsc_buf_destroy(&buf);
+}
+END_TEST
+
+START_TEST(MmapBuffer) {
+    Buffer_t buf = { 0 };
+    ck_assert_int_eq(dsc_buf_init_mmap(&buf, 1024, sizeof(int), DSC_BUF_HUGEPAGE), DSC_EOK);
+    ck_assert_int_eq(buf.backing, BUF_ANON);
+    ck_assert_int_eq(dsc_buf_nelem(&buf), 1024);
+
+    for (int i = 0; i < 1024; ++i) {
+        ((int*)buf.base)[i] = i;
+    }
+
+    // Growing past the first mapping must keep the existing contents
+    ck_assert_int_eq(dsc_buf_resize(&buf, 1 << 20), DSC_EOK);
+    ck_assert_int_eq(dsc_buf_nelem(&buf), 1 << 20);
+    for (int i = 0; i < 1024; ++i) {
+        ck_assert_int_eq(((int*)buf.base)[i], i);
+    }
+    ((int*)buf.base)[(1 << 20) - 1] = 7;
+
+    ck_assert_int_eq(dsc_buf_destroy(&buf), DSC_EOK);
+    ck_assert_ptr_null(buf.base);
+}
+END_TEST
+
+START_TEST(FileBuffer) {
+    const char *path = "dsc_buffer_test.bin";
+    unlink(path);
+
+    Buffer_t buf = { 0 };
+    ck_assert_int_eq(dsc_buf_map_file(&buf, path, 16, sizeof(long), 0), DSC_EOK);
+    for (int i = 0; i < 16; ++i) {
+        ((long*)buf.base)[i] = (long)i * 11;
+    }
+    dsc_buf_resize(&buf, 32);
+    ((long*)buf.base)[31] = 99;
+    ck_assert_int_eq(dsc_buf_sync(&buf), DSC_EOK);
+    dsc_buf_destroy(&buf);
+
+    // Mapping with nelem == 0 picks the contents back up at the file's size
+    ck_assert_int_eq(dsc_buf_map_file(&buf, path, 0, sizeof(long), DSC_BUF_POPULATE), DSC_EOK);
+    ck_assert_int_eq(dsc_buf_nelem(&buf), 32);
+    ck_assert_int_eq(((long*)buf.base)[5], 55);
+    ck_assert_int_eq(((long*)buf.base)[31], 99);
+    dsc_buf_destroy(&buf);
+
+    unlink(path);
+}
+END_TEST
+
+START_TEST(FillFindCount) {
+    const uint8_t tsizes[] = { 1, 2, 3, 4, 8, 16 };
+    // Every width runs through each kernel the CPU has, not just the best one
+    const BufKernel_t kernels[] = { BUF_KERNEL_AUTO, BUF_KERNEL_SSE2, BUF_KERNEL_SCALAR };
+    uint8_t elem[16], other[16];
+
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); ++k) {
+        _dsc_buf_set_kernel(kernels[k]);
+        for (size_t t = 0; t < sizeof(tsizes); ++t) {
+            const uint8_t tsize = tsizes[t];
+            Buffer_t buf = { 0 };
+            memset(elem, 0xA5, sizeof(elem));
+            memset(other, 0xA5, sizeof(other));
+            other[tsize - 1] = 0x5A; // Differs from elem in its last byte only
+
+            dsc_buf_init(&buf, 1000, tsize);
+            ck_assert_int_eq(dsc_buf_fill_elem(&buf, elem), DSC_EOK);
+            ck_assert_int_eq(dsc_buf_count(&buf, elem), 1000);
+            ck_assert_int_eq(dsc_buf_find(&buf, elem), 0);
+            ck_assert_int_eq(dsc_buf_find(&buf, other), 1000);
+
+            memcpy((uint8_t*)buf.base + 37 * tsize, other, tsize);
+            memcpy((uint8_t*)buf.base + 998 * tsize, other, tsize);
+            ck_assert_int_eq(dsc_buf_find(&buf, other), 37);
+            ck_assert_int_eq(dsc_buf_count(&buf, other), 2);
+            ck_assert_int_eq(dsc_buf_count(&buf, elem), 998);
+
+            dsc_buf_destroy(&buf);
+        }
+    }
+    _dsc_buf_set_kernel(BUF_KERNEL_AUTO);
+
+    // Invalid buffers are reported rather than dereferenced or divided by
+    Buffer_t empty = { 0 };
+    ck_assert_int_eq(dsc_buf_find(NULL, elem), 0);
+    ck_assert_int_eq(dsc_buf_count(&empty, elem), 0);
+    ck_assert_int_eq(dsc_buf_fill_elem(&empty, elem), DSC_EFAULT);
+}
+END_TEST
+
+START_TEST(CopyCompare) {
+    Buffer_t src = { 0 };
+    Buffer_t dst = { 0 };
+    const int value = 1234;
+
+    dsc_buf_init(&src, 100, sizeof(int));
+    dsc_buf_init(&dst, 3, sizeof(int));
+    dsc_buf_fill_elem(&src, &value);
+
+    ck_assert_int_ne(dsc_buf_compare(&src, &dst), 0);
+    ck_assert_int_eq(dsc_buf_copy(&dst, &src), DSC_EOK);
+    ck_assert_int_eq(dsc_buf_nelem(&dst), 100);
+    ck_assert_int_eq(dsc_buf_compare(&src, &dst), 0);
+
+    dsc_buf_resize(&dst, 50);
+    ck_assert_int_gt(dsc_buf_compare(&src, &dst), 0);
+    ck_assert_int_lt(dsc_buf_compare(&dst, &src), 0);
+
+    dsc_buf_destroy(&src);
+    dsc_buf_destroy(&dst);
+}
+END_TEST
+
+START_TEST(InlineBuffer) {
+    SmallBuffer_t sbuf = { 0 };
+    Buffer_t *buf = &sbuf.buf;
+    DscStats_t stats = { 0 };
+    DscAllocator_t alloc = { test_alloc, test_realloc, test_free, NULL, &stats };
+
+    ck_assert_int_eq(dsc_buf_init_inline(&sbuf, 4, sizeof(int), &alloc), DSC_EOK);
+    ck_assert_ptr_eq(buf->base, sbuf.small);
+    ck_assert_int_eq(buf->backing, BUF_INLINE);
+    for (int i = 0; i < 4; ++i) {
+        ((int*)buf->base)[i] = i;
+    }
+
+    // Growing within the inline storage never calls the allocator
+    ck_assert_int_eq(dsc_buf_resize(buf, DSC_BUF_SMALL / sizeof(int)), DSC_EOK);
+    ck_assert_int_eq(stats.allocs, 0);
+
+    // One element more spills to the heap and keeps the contents
+    ck_assert_int_eq(dsc_buf_resize(buf, DSC_BUF_SMALL / sizeof(int) + 1), DSC_EOK);
+    ck_assert_int_eq(buf->backing, BUF_HEAP);
+    ck_assert_ptr_ne(buf->base, sbuf.small);
+    ck_assert_int_eq(stats.allocs, 1);
+    for (int i = 0; i < 4; ++i) {
+        ck_assert_int_eq(((int*)buf->base)[i], i);
+    }
+
+    dsc_buf_destroy(buf);
+    ck_assert_int_eq(stats.bytes, 0);
+}
+END_TEST
+
+START_TEST(CallocOverflow) {
+    DscStats_t stats = { 0 };
+    DscAllocator_t alloc = { test_alloc, test_realloc, test_free, NULL, &stats };
+
+    // A product that wraps must fail rather than hand back a short block
+    ck_assert_ptr_null(dsc_calloc(&alloc, SIZE_MAX / 2, 4));
+    ck_assert_int_eq(stats.allocs, 0);
+
+    int *ints = dsc_calloc(&alloc, 4, sizeof(int));
+    ck_assert_ptr_nonnull(ints);
+    ck_assert_int_eq(ints[3], 0);
+    dsc_free(&alloc, ints, 4 * sizeof(int));
 }
 END_TEST
 
@@ -49,6 +227,12 @@ Suite *buffer_suite(void) {
     tcase_add_test(tc_core, CreateBuffer);
     tcase_add_test(tc_core, ResizeBuffer);
     tcase_add_test(tc_core, Memcpy);
+    tcase_add_test(tc_core, MmapBuffer);
+    tcase_add_test(tc_core, FileBuffer);
+    tcase_add_test(tc_core, FillFindCount);
+    tcase_add_test(tc_core, CopyCompare);
+    tcase_add_test(tc_core, InlineBuffer);
+    tcase_add_test(tc_core, CallocOverflow);
     suite_add_tcase(s, tc_core);
 
     return s;
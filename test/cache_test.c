@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "cache.h"
+
+static void count_evict(const void *key, void *value, void *ctx) {
+    (void)key;
+    *(size_t*)ctx += *(const int*)value;
+}
+
+START_TEST(LRU) {
+    Cache_t cache = { 0 };
+    int key, value;
+
+    ck_assert_int_eq(dsc_cache_init(&cache, 4, sizeof(int), sizeof(int), CACHE_LRU), DSC_EOK);
+    for (key = 0; key < 4; ++key) {
+        value = key * 10;
+        ck_assert_int_eq(dsc_cache_put(&cache, &key, &value), DSC_EOK);
+    }
+
+    // Using 0 makes 1 the least recently used entry
+    key = 0;
+    ck_assert_int_eq(*(int*)dsc_cache_get(&cache, &key), 0);
+    key = 4;
+    value = 40;
+    dsc_cache_put(&cache, &key, &value);
+    key = 1;
+    ck_assert_ptr_null(dsc_cache_get(&cache, &key));
+    for (key = 0; key < 5; ++key) {
+        if (key != 1) {
+            ck_assert_int_eq(*(int*)dsc_cache_get(&cache, &key), key * 10);
+        }
+    }
+
+    ck_assert_uint_eq(dsc_cache_count(&cache), 4);
+    ck_assert_uint_eq(cache.stats.evictions, 1);
+    ck_assert_uint_eq(cache.stats.hits, 5);
+    ck_assert_uint_eq(cache.stats.misses, 1);
+    dsc_cache_destroy(&cache);
+}
+END_TEST
+
+START_TEST(Clock) {
+    Cache_t cache = { 0 };
+    int key;
+
+    dsc_cache_init(&cache, 4, sizeof(int), 0, CACHE_CLOCK);
+    for (key = 0; key < 4; ++key) {
+        dsc_cache_put(&cache, &key, NULL);
+    }
+
+    // Referenced entries get a second chance, so the first unreferenced one (2) goes
+    key = 0;
+    dsc_cache_get(&cache, &key);
+    key = 1;
+    dsc_cache_get(&cache, &key);
+    key = 4;
+    dsc_cache_put(&cache, &key, NULL);
+    key = 2;
+    ck_assert_ptr_null(dsc_cache_get(&cache, &key));
+    for (key = 0; key < 5; ++key) {
+        if (key != 2) {
+            ck_assert_ptr_nonnull(dsc_cache_get(&cache, &key));
+        }
+    }
+    dsc_cache_destroy(&cache);
+}
+END_TEST
+
+START_TEST(TinyLFU) {
+    Cache_t cache = { 0 };
+    int key;
+
+    dsc_cache_init(&cache, 100, sizeof(int), sizeof(int), CACHE_TINYLFU);
+    for (int round = 0; round < 3; ++round) {
+        for (key = 0; key < 100; ++key) {
+            if (dsc_cache_get(&cache, &key) == NULL) {
+                dsc_cache_put(&cache, &key, &key);
+            }
+        }
+    }
+
+    // A scan of keys that are each used once cannot displace the keys still in use
+    for (int i = 0; i < 2000; ++i) {
+        key = 1000 + i;
+        dsc_cache_put(&cache, &key, &key);
+        key = i % 100;
+        if (dsc_cache_get(&cache, &key) == NULL) {
+            dsc_cache_put(&cache, &key, &key);
+        }
+    }
+    ck_assert_uint_ge(cache.stats.rejections, 1900);
+    size_t kept = 0;
+    for (key = 0; key < 100; ++key) {
+        kept += dsc_cache_get(&cache, &key) != NULL;
+    }
+    ck_assert_uint_ge(kept, 95);
+    dsc_cache_destroy(&cache);
+}
+END_TEST
+
+START_TEST(RemoveReuse) {
+    Cache_t cache = { 0 };
+    size_t evicted = 0;
+    int key, value;
+
+    // Many keys through a small table exercise removal from the middle of probe runs
+    for (CachePolicy_t policy = CACHE_LRU; policy <= CACHE_CLOCK; ++policy) {
+        dsc_cache_init(&cache, 64, sizeof(int), sizeof(int), policy);
+        dsc_cache_on_evict(&cache, count_evict, &evicted);
+        for (key = 0; key < 10000; ++key) {
+            value = 1;
+            dsc_cache_put(&cache, &key, &value);
+            if (key % 3 == 0) {
+                ck_assert_int_eq(dsc_cache_remove(&cache, &key), DSC_EOK);
+                ck_assert_int_eq(dsc_cache_remove(&cache, &key), DSC_ENODATA);
+            }
+        }
+        // The last key (9999) was removed again, leaving one entry free
+        ck_assert_uint_eq(dsc_cache_count(&cache), 63);
+
+        size_t found = 0;
+        for (key = 0; key < 10000; ++key) {
+            found += dsc_cache_get(&cache, &key) != NULL;
+        }
+        ck_assert_uint_eq(found, 63);
+        ck_assert_uint_eq(cache.stats.evictions + 63 + 3334, cache.stats.inserts);
+        dsc_cache_destroy(&cache);
+    }
+
+    // Every entry not removed by hand went through the callback, either evicted or at destroy
+    ck_assert_uint_eq(evicted, 2 * (10000 - 3334));
+}
+END_TEST
+
+Suite *cache_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Cache");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, LRU);
+    tcase_add_test(tc_core, Clock);
+    tcase_add_test(tc_core, TinyLFU);
+    tcase_add_test(tc_core, RemoveReuse);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = cache_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,98 @@
+// chmap.h comes first so that the feature macros it needs are set before any system header
+#include "chmap.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#define NTHREADS   4
+#define PER_THREAD 5000
+
+static CMap_t shared;
+
+static void *writer(void *arg) {
+    const int base = (int)(intptr_t)arg * PER_THREAD;
+
+    for (int i = base; i < base + PER_THREAD; ++i) {
+        const long value = (long)i * 2;
+        ck_assert_int_eq(dsc_chmap_add_entry(&shared, &i, &value), DSC_EOK);
+
+        long out = 0;
+        ck_assert_int_eq(dsc_chmap_retrieve_value(&shared, &i, &out), DSC_EOK);
+        ck_assert_int_eq(out, value);
+    }
+    for (int i = base; i < base + PER_THREAD; i += 2) {
+        ck_assert_int_eq(dsc_chmap_remove_entry(&shared, &i), DSC_EOK);
+    }
+
+    return NULL;
+}
+
+START_TEST(CreateCHMap) {
+    CMap_t map = { 0 };
+    ck_assert_int_eq(dsc_chmap_init(&map, 10, sizeof(int), sizeof(long)), DSC_EOK);
+    ck_assert_int_eq(map.nsegs, 16);
+    ck_assert_int_eq((uintptr_t)map.segs % DSC_CACHELINE, 0);
+    ck_assert_int_eq(dsc_chmap_count(&map), 0);
+    ck_assert_int_eq(dsc_chmap_destroy(&map), DSC_EOK);
+    ck_assert_ptr_null(map.segs);
+}
+END_TEST
+
+START_TEST(ParallelWriters) {
+    pthread_t threads[NTHREADS];
+
+    dsc_chmap_init(&shared, 0, sizeof(int), sizeof(long));
+    for (intptr_t t = 0; t < NTHREADS; ++t) {
+        pthread_create(&threads[t], NULL, writer, (void*)t);
+    }
+    for (int t = 0; t < NTHREADS; ++t) {
+        pthread_join(threads[t], NULL);
+    }
+
+    ck_assert_int_eq(dsc_chmap_count(&shared), NTHREADS * PER_THREAD / 2);
+    for (int i = 0; i < NTHREADS * PER_THREAD; ++i) {
+        ck_assert(dsc_chmap_contains_key(&shared, &i) == (i % 2 != 0));
+    }
+
+    const int odd = 1;
+    const long value = -1;
+    long out = 0;
+    ck_assert_int_eq(dsc_chmap_replace_entry(&shared, &odd, &value), DSC_EOK);
+    ck_assert_int_eq(dsc_chmap_retrieve_value(&shared, &odd, &out), DSC_EOK);
+    ck_assert_int_eq(out, -1);
+    ck_assert_int_eq(dsc_chmap_retrieve_value(&shared, &(int){ 0 }, &out), DSC_ENODATA);
+
+    dsc_chmap_destroy(&shared);
+}
+END_TEST
+
+Suite *chmap_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("CHMap");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, CreateCHMap);
+    tcase_add_test(tc_core, ParallelWriters);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = chmap_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "cuckoo.h"
+
+#define NKEYS 100000
+
+START_TEST(Membership) {
+    Cuckoo_t filter = { 0 };
+    size_t fps = 0;
+
+    ck_assert_int_eq(dsc_cuckoo_init(&filter, NKEYS, sizeof(uint64_t), NULL), DSC_EOK);
+    for (uint64_t key = 0; key < NKEYS; ++key) {
+        ck_assert_int_eq(dsc_cuckoo_add(&filter, &key), DSC_EOK);
+    }
+    ck_assert_uint_eq(dsc_cuckoo_count(&filter), NKEYS);
+
+    for (uint64_t key = 0; key < NKEYS; ++key) {
+        ck_assert(dsc_cuckoo_contains(&filter, &key));
+    }
+    for (uint64_t key = NKEYS; key < 2 * NKEYS; ++key) {
+        fps += dsc_cuckoo_contains(&filter, &key);
+    }
+    ck_assert_uint_lt(fps, NKEYS / 1000);
+
+    // Removing half of the keys keeps the other half
+    for (uint64_t key = 0; key < NKEYS; key += 2) {
+        ck_assert_int_eq(dsc_cuckoo_remove(&filter, &key), DSC_EOK);
+    }
+    for (uint64_t key = 1; key < NKEYS; key += 2) {
+        ck_assert(dsc_cuckoo_contains(&filter, &key));
+    }
+    ck_assert_uint_eq(dsc_cuckoo_count(&filter), NKEYS / 2);
+    dsc_cuckoo_destroy(&filter);
+}
+END_TEST
+
+START_TEST(Overflow) {
+    Cuckoo_t filter = { 0 };
+    uint64_t key;
+
+    // 64 slots fill up shortly before 64 keys; every key added before the first failure is kept
+    dsc_cuckoo_init(&filter, 60, sizeof(uint64_t), NULL);
+    for (key = 0; dsc_cuckoo_add(&filter, &key) == DSC_EOK; ++key) {}
+    ck_assert_uint_eq(dsc_cuckoo_count(&filter), key);
+    ck_assert_uint_ge(key, 56);
+    for (uint64_t k = 0; k < key; ++k) {
+        ck_assert(dsc_cuckoo_contains(&filter, &k));
+    }
+
+    // A remove makes room again
+    for (uint64_t k = 0; k < 8; ++k) {
+        dsc_cuckoo_remove(&filter, &k);
+    }
+    ck_assert_int_eq(dsc_cuckoo_add(&filter, &key), DSC_EOK);
+    ck_assert(dsc_cuckoo_contains(&filter, &key));
+
+    const char *word = "duplicate";
+    dsc_cuckoo_destroy(&filter);
+    dsc_cuckoo_init(&filter, 16, 0, murmur3_hash);
+    dsc_cuckoo_add(&filter, word);
+    dsc_cuckoo_add(&filter, word);
+    ck_assert_int_eq(dsc_cuckoo_remove(&filter, word), DSC_EOK);
+    ck_assert(dsc_cuckoo_contains(&filter, word));
+    ck_assert_int_eq(dsc_cuckoo_remove(&filter, word), DSC_EOK);
+    ck_assert(!dsc_cuckoo_contains(&filter, word));
+    ck_assert_int_eq(dsc_cuckoo_remove(&filter, word), DSC_ENODATA);
+    dsc_cuckoo_destroy(&filter);
+}
+END_TEST
+
+Suite *cuckoo_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Cuckoo");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, Membership);
+    tcase_add_test(tc_core, Overflow);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = cuckoo_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
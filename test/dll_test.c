@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "dll.h"
+
+START_TEST(LinkUnlink) {
+    struct DLLNode head;
+    struct DLLNode nodes[5];
+    int values[5] = { 0, 1, 2, 3, 4 };
+
+    dsc_dll_init(&head, NULL);
+    ck_assert(dsc_dll_empty(&head));
+    for (int i = 0; i < 5; ++i) {
+        dsc_dll_init(&nodes[i], &values[i]);
+        ck_assert(!dsc_dll_linked(&nodes[i]));
+        dsc_dll_append(&head, &nodes[i]);
+    }
+    ck_assert_int_eq(dsc_dll_nelem(&head), 5);
+
+    // Unlinking from the middle and both ends keeps the ring intact
+    dsc_dll_unlink(&nodes[2]);
+    dsc_dll_unlink(&nodes[0]);
+    dsc_dll_unlink(&nodes[4]);
+    ck_assert(!dsc_dll_linked(&nodes[2]));
+    ck_assert_int_eq(dsc_dll_nelem(&head), 2);
+    ck_assert_int_eq(*(int*)head.next->data, 1);
+    ck_assert_int_eq(*(int*)head.prev->data, 3);
+
+    dsc_dll_insert_after(&head, &nodes[0]);
+    dsc_dll_insert_after(&nodes[1], &nodes[2]);
+    int expect = 0;
+    for (DLLNode_t iter = head.next; iter != &head; iter = iter->next) {
+        ck_assert_int_eq(*(int*)iter->data, expect++);
+    }
+    ck_assert_int_eq(expect, 4);
+}
+END_TEST
+
+START_TEST(Splice) {
+    struct DLLNode a, b;
+    struct DLLNode nodes[6];
+    int values[6] = { 0, 1, 2, 3, 4, 5 };
+
+    dsc_dll_init(&a, NULL);
+    dsc_dll_init(&b, NULL);
+    for (int i = 0; i < 6; ++i) {
+        dsc_dll_init(&nodes[i], &values[i]);
+        dsc_dll_append((i < 3) ? &a : &b, &nodes[i]);
+    }
+
+    dsc_dll_splice(&a, &b);
+    ck_assert(dsc_dll_empty(&b));
+    ck_assert_int_eq(dsc_dll_nelem(&a), 6);
+    int expect = 5;
+    for (DLLNode_t iter = a.prev; iter != &a; iter = iter->prev) {
+        ck_assert_int_eq(*(int*)iter->data, expect--);
+    }
+
+    // Splicing an empty list is a no-op, and into an empty list moves everything
+    dsc_dll_splice(&a, &b);
+    ck_assert_int_eq(dsc_dll_nelem(&a), 6);
+    dsc_dll_splice(&b, &a);
+    ck_assert(dsc_dll_empty(&a));
+    ck_assert_int_eq(dsc_dll_nelem(&b), 6);
+}
+END_TEST
+
+Suite *dll_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("DLL");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, LinkUnlink);
+    tcase_add_test(tc_core, Splice);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = dll_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
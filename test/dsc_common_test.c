@@ -0,0 +1,161 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <check.h>
+
+// Only warnings and errors logged from this file reach _dsc_log()
+#define DSC_LOG_LEVEL DSC_LOG_LEVEL_WARNING
+
+#include "dsc_common.h"
+#include "buffer.h"
+
+typedef struct {
+    size_t        count;     // Messages received
+    DscLogLevel_t level;     // Level of the last message
+    int           line;      // Line of the last message
+    char          msg[128];  // Text of the last message
+    char          func[64];  // Function of the last message
+    size_t        nsummary;  // Rate limiting summaries received
+    char          summary[128];
+} Capture_t;
+
+static void capture_sink(
+    void *ctx,
+    const DscLogLevel_t level,
+    const char *file,
+    const char *func,
+    const int line,
+    const char *msg
+) {
+    Capture_t *cap = ctx;
+    (void)file;
+
+    if (strstr(msg, "suppressed by rate limiting") != NULL) {
+        ++cap->nsummary;
+        snprintf(cap->summary, sizeof(cap->summary), "%s", msg);
+        return;
+    }
+    ++cap->count;
+    cap->level = level;
+    cap->line = line;
+    snprintf(cap->msg, sizeof(cap->msg), "%s", msg);
+    snprintf(cap->func, sizeof(cap->func), "%s", func);
+}
+
+// Spins until the rate limiter's clock enters a new second
+static void wait_next_second(void) {
+    struct timespec ts, now;
+    const struct timespec nap = { 0, 5 * 1000 * 1000 };
+
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+    do {
+        nanosleep(&nap, NULL);
+        clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+    } while (now.tv_sec == ts.tv_sec);
+}
+
+START_TEST(LevelGate) {
+    Capture_t cap = { 0 };
+    dsc_log_set_sink(capture_sink, &cap);
+
+    DSC_LOG("Dropped before it reaches the sink", DSC_NOTE);
+    ck_assert_int_eq(cap.count, 0);
+
+    DSC_LOG("Passed to the sink", DSC_WARNING);
+    ck_assert_int_eq(cap.count, 1);
+    ck_assert_int_eq(cap.level, DSC_WARNING);
+    ck_assert_str_eq(cap.msg, "Passed to the sink");
+
+    dsc_log_set_sink(NULL, NULL);
+}
+END_TEST
+
+START_TEST(CustomSink) {
+    Capture_t cap = { 0 };
+    dsc_log_set_sink(capture_sink, &cap);
+
+    const int line = __LINE__ + 1;
+    DSC_LOG("Logged from the test", DSC_ERROR);
+    ck_assert_int_eq(cap.count, 1);
+    ck_assert_int_eq(cap.level, DSC_ERROR);
+    ck_assert_int_eq(cap.line, line);
+    ck_assert_str_eq(cap.func, "CustomSink");
+
+    // Messages logged inside the library reach the same sink
+    ck_assert_int_eq(dsc_buf_destroy(NULL), DSC_EINVAL);
+    ck_assert_int_eq(cap.count, 2);
+    ck_assert_int_eq(cap.level, DSC_ERROR);
+    ck_assert_str_eq(cap.msg, "The buffer points to an invalid address");
+    ck_assert_str_eq(cap.func, "dsc_buf_destroy");
+
+    // Restoring the default sink stops the capture
+    dsc_log_set_sink(NULL, NULL);
+    dsc_buf_destroy(NULL);
+    ck_assert_int_eq(cap.count, 2);
+}
+END_TEST
+
+START_TEST(RateLimit) {
+    Capture_t cap = { 0 };
+    dsc_log_set_sink(capture_sink, &cap);
+    dsc_log_set_rate_limit(3);
+
+    // Starting at the top of a second leaves ample time for the burst to land in one window
+    wait_next_second();
+    for (int i = 0; i < 10; ++i) {
+        DSC_LOG("Burst", DSC_ERROR);
+    }
+    ck_assert_int_eq(cap.count, 3);
+    ck_assert_int_eq(cap.nsummary, 0);
+
+    // The first message of the next window is preceded by a count of the ones dropped
+    wait_next_second();
+    DSC_LOG("After the burst", DSC_ERROR);
+    ck_assert_int_eq(cap.nsummary, 1);
+    ck_assert_str_eq(cap.summary, "7 messages were suppressed by rate limiting");
+    ck_assert_int_eq(cap.count, 4);
+    ck_assert_str_eq(cap.msg, "After the burst");
+
+    // With the limit lifted, nothing is dropped
+    dsc_log_set_rate_limit(0);
+    for (int i = 0; i < 10; ++i) {
+        DSC_LOG("Unlimited", DSC_ERROR);
+    }
+    ck_assert_int_eq(cap.count, 14);
+
+    dsc_log_set_rate_limit(100);
+    dsc_log_set_sink(NULL, NULL);
+}
+END_TEST
+
+Suite *dsc_common_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Common");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, LevelGate);
+    tcase_add_test(tc_core, CustomSink);
+    tcase_add_test(tc_core, RateLimit);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = dsc_common_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,195 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "heap.h"
+
+static int int_cmp(const void *lhs, const void *rhs) {
+    const int a = *(const int*)lhs;
+    const int b = *(const int*)rhs;
+    return (a > b) - (a < b);
+}
+
+START_TEST(PushPop) {
+    Heap_t heap = { 0 };
+    int value;
+
+    for (size_t arity = 2; arity <= 8; arity *= 2) {
+        ck_assert_int_eq(dsc_heap_init(&heap, sizeof(int), arity, int_cmp), DSC_EOK);
+        for (int i = 0; i < 1000; ++i) {
+            value = (i * 389) % 1000; // Every value in [0, 1000) once, out of order
+            ck_assert_int_eq(dsc_heap_push(&heap, &value, NULL), DSC_EOK);
+        }
+        ck_assert_int_eq(dsc_heap_nelem(&heap), 1000);
+        ck_assert_int_eq(*(const int*)dsc_heap_peek(&heap), 0);
+
+        for (int i = 0; i < 1000; ++i) {
+            ck_assert_int_eq(dsc_heap_pop(&heap, &value), DSC_EOK);
+            ck_assert_int_eq(value, i);
+        }
+        ck_assert_int_eq(dsc_heap_pop(&heap, &value), DSC_ENODATA);
+        ck_assert_ptr_null(dsc_heap_peek(&heap));
+        dsc_heap_destroy(&heap);
+    }
+}
+END_TEST
+
+START_TEST(Handles) {
+    Heap_t heap = { 0 };
+    size_t handles[100];
+    int value;
+
+    dsc_heap_init(&heap, sizeof(int), 0, int_cmp);
+    ck_assert_int_eq(dsc_heap_track_handles(&heap), DSC_EOK);
+    for (int i = 0; i < 100; ++i) {
+        value = 1000 + i;
+        dsc_heap_push(&heap, &value, &handles[i]);
+    }
+
+    // Decrease-key moves an element to the top
+    value = 5;
+    ck_assert_int_eq(dsc_heap_update(&heap, handles[70], &value), DSC_EOK);
+    ck_assert_int_eq(*(const int*)dsc_heap_peek(&heap), 5);
+
+    // Increase-key sinks it again
+    value = 5000;
+    ck_assert_int_eq(dsc_heap_update(&heap, handles[70], &value), DSC_EOK);
+    ck_assert_int_eq(*(const int*)dsc_heap_peek(&heap), 1000);
+
+    ck_assert_int_eq(dsc_heap_remove(&heap, handles[0]), DSC_EOK);
+    ck_assert_int_eq(dsc_heap_remove(&heap, handles[0]), DSC_ENODATA);
+    ck_assert_int_eq(dsc_heap_remove(&heap, handles[50]), DSC_EOK);
+
+    int prev = -1;
+    while (dsc_heap_pop(&heap, &value) == DSC_EOK) {
+        ck_assert_int_ne(value, 1000);
+        ck_assert_int_ne(value, 1050);
+        ck_assert_int_gt(value, prev);
+        prev = value;
+    }
+    ck_assert_int_eq(prev, 5000);
+    dsc_heap_destroy(&heap);
+}
+END_TEST
+
+// Allocator that fails once the budget in *ctx runs out (a negative budget never runs out)
+static bool oom_take(void *ctx) {
+    int *budget = ctx;
+    if (*budget > 0) {
+        --*budget;
+        return true;
+    }
+    return *budget < 0;
+}
+
+static void *oom_alloc(void *ctx, size_t size) {
+    return oom_take(ctx) ? malloc(size) : NULL;
+}
+
+static void *oom_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)old_size;
+    return oom_take(ctx) ? realloc(ptr, new_size) : NULL;
+}
+
+static void oom_free(void *ctx, void *ptr, size_t size) {
+    (void)ctx;
+    (void)size;
+    free(ptr);
+}
+
+START_TEST(PushOutOfMemory) {
+    Heap_t heap = { 0 };
+    size_t handles[64];
+    int budget = -1;
+    DscAllocator_t alloc = { oom_alloc, oom_realloc, oom_free, &budget, NULL };
+    int value;
+
+    ck_assert_int_eq(dsc_heap_init_alloc(&heap, sizeof(int), 0, int_cmp, &alloc), DSC_EOK);
+    ck_assert_int_eq(dsc_heap_track_handles(&heap), DSC_EOK);
+    for (int i = 0; i < 16; ++i) {
+        value = 100 - i;
+        ck_assert_int_eq(dsc_heap_push(&heap, &value, &handles[i]), DSC_EOK);
+    }
+
+    // The elements grow but their handles do not
+    budget = 1;
+    value = 0;
+    ck_assert_int_eq(dsc_heap_push(&heap, &value, &handles[16]), DSC_ENOMEM);
+    ck_assert_int_eq(heap.nelem, 16);
+    ck_assert_int_eq(dsc_heap_push(&heap, &value, &handles[16]), DSC_ENOMEM);
+
+    budget = -1;
+    for (int i = 16; i < 64; ++i) {
+        value = 100 - i;
+        ck_assert_int_eq(dsc_heap_push(&heap, &value, &handles[i]), DSC_EOK);
+    }
+    value = -1;
+    ck_assert_int_eq(dsc_heap_update(&heap, handles[0], &value), DSC_EOK);
+
+    int prev = -2;
+    while (dsc_heap_pop(&heap, &value) == DSC_EOK) {
+        ck_assert_int_gt(value, prev);
+        prev = value;
+    }
+    ck_assert_int_eq(prev, 99);
+    dsc_heap_destroy(&heap);
+}
+END_TEST
+
+START_TEST(HeapifyTopK) {
+    Heap_t heap = { 0 };
+    int nums[500];
+    int best[10];
+    int value;
+
+    for (int i = 0; i < 500; ++i) {
+        nums[i] = (i * 211) % 500;
+    }
+
+    dsc_heap_init(&heap, sizeof(int), 3, int_cmp);
+    ck_assert_int_eq(dsc_heap_heapify(&heap, nums, 500), DSC_EOK);
+    for (int i = 0; i < 500; ++i) {
+        dsc_heap_pop(&heap, &value);
+        ck_assert_int_eq(value, i);
+    }
+    dsc_heap_destroy(&heap);
+
+    ck_assert_int_eq(dsc_heap_topk(nums, 500, sizeof(int), 10, int_cmp, best), 10);
+    for (int i = 0; i < 10; ++i) {
+        ck_assert_int_eq(best[i], i);
+    }
+    ck_assert_int_eq(dsc_heap_topk(nums, 3, sizeof(int), 10, int_cmp, best), 3);
+}
+END_TEST
+
+Suite *heap_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Heap");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, PushPop);
+    tcase_add_test(tc_core, Handles);
+    tcase_add_test(tc_core, PushOutOfMemory);
+    tcase_add_test(tc_core, HeapifyTopK);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = heap_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,467 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "hmap.h"
+
+START_TEST(CreateHMap) {
+    Map_t map = { 0 };
+    ck_assert_int_eq(dsc_hmap_init(&map, 10, sizeof(int), sizeof(long)), DSC_EOK);
+    ck_assert_ptr_nonnull(map.base);
+    ck_assert_int_eq(map.nelem, 16);
+    ck_assert_int_eq(map.count, 0);
+    ck_assert_int_eq(dsc_hmap_destroy(&map), DSC_EOK);
+    ck_assert_ptr_null(map.base);
+}
+END_TEST
+
+START_TEST(AddRetrieveEntry) {
+    Map_t map = { 0 };
+    dsc_hmap_init(&map, 0, sizeof(int), sizeof(long));
+
+    for (int i = 0; i < 1000; ++i) {
+        long value = (long)i * 3;
+        ck_assert_int_eq(dsc_hmap_add_entry(&map, &i, &value), DSC_EOK);
+    }
+    ck_assert_int_eq(map.count, 1000);
+
+    int dup = 7;
+    long dup_value = 0;
+    ck_assert_int_eq(dsc_hmap_add_entry(&map, &dup, &dup_value), DSC_EINVAL);
+
+    for (int i = 0; i < 1000; ++i) {
+        Buffer_t value = dsc_hmap_retrieve_value(&map, &i);
+        ck_assert_ptr_nonnull(value.base);
+        ck_assert_int_eq(value.bsize, sizeof(long));
+        ck_assert_int_eq(*(long*)value.base, (long)i * 3);
+    }
+
+    int missing = 1000;
+    ck_assert_ptr_null(dsc_hmap_retrieve_value(&map, &missing).base);
+    ck_assert(!dsc_hmap_contains_key(&map, &missing));
+
+    dsc_hmap_destroy(&map);
+}
+END_TEST
+
+START_TEST(ReplaceRemoveEntry) {
+    Map_t map = { 0 };
+    const char *keys[] = { "Foo", "Bar", "Baz" };
+    dsc_hmap_init(&map, 4, 0, sizeof(int));
+
+    for (int i = 0; i < 3; ++i) {
+        dsc_hmap_add_entry(&map, keys[i], &i);
+    }
+
+    int value = 42;
+    ck_assert_int_eq(dsc_hmap_replace_entry(&map, "Bar", &value), DSC_EOK);
+    ck_assert_int_eq(*(int*)dsc_hmap_retrieve_value(&map, "Bar").base, 42);
+    ck_assert(dsc_hmap_contains_value(&map, &value));
+
+    ck_assert_int_eq(dsc_hmap_remove_entry(&map, "Foo"), DSC_EOK);
+    ck_assert_int_eq(dsc_hmap_remove_entry(&map, "Foo"), DSC_ENODATA);
+    ck_assert(!dsc_hmap_contains_key(&map, "Foo"));
+    ck_assert(dsc_hmap_contains_key(&map, "Baz"));
+    ck_assert_int_eq(map.count, 2);
+
+    // Re-adding a removed key reuses its tombstone
+    ck_assert_int_eq(dsc_hmap_add_entry(&map, "Foo", &value), DSC_EOK);
+    ck_assert_int_eq(*(int*)dsc_hmap_retrieve_value(&map, "Foo").base, 42);
+
+    dsc_hmap_destroy(&map);
+}
+END_TEST
+
+static void *test_alloc(void *ctx, size_t size) {
+    ++*(int*)ctx;
+    return malloc(size);
+}
+
+static void *test_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)old_size;
+    ++*(int*)ctx;
+    return realloc(ptr, new_size);
+}
+
+static void test_free(void *ctx, void *ptr, size_t size) {
+    (void)size;
+    --*(int*)ctx;
+    free(ptr);
+}
+
+START_TEST(CustomAllocator) {
+    int live = 0;
+    DscStats_t stats = { 0 };
+    DscAllocator_t alloc = { test_alloc, test_realloc, test_free, &live, &stats };
+    Map_t map = { 0 };
+
+    dsc_hmap_init_alloc(&map, 8, sizeof(int), sizeof(int), &alloc);
+    for (int i = 0; i < 100; ++i) {
+        dsc_hmap_add_entry(&map, &i, &i);
+    }
+    ck_assert_int_eq(live, 101); // Slot array plus one block per entry
+    ck_assert_int_gt(stats.resizes, 0);
+    ck_assert_int_gt(stats.bytes, 0);
+    ck_assert_int_ge(stats.probes, stats.lookups);
+
+    dsc_hmap_destroy(&map);
+    ck_assert_int_eq(live, 0);
+    ck_assert_int_eq(stats.bytes, 0);
+    ck_assert_int_eq(stats.allocs, stats.frees);
+}
+END_TEST
+
+START_TEST(IncrementalResize) {
+    Map_t map = { 0 };
+    bool drained = false;
+
+    dsc_hmap_init(&map, 0, sizeof(int), sizeof(int));
+    ck_assert_int_eq(dsc_hmap_set_resize(&map, RESIZE_INCREMENTAL), DSC_EOK);
+
+    for (int i = 0; i < 10000; ++i) {
+        ck_assert_int_eq(dsc_hmap_add_entry(&map, &i, &i), DSC_EOK);
+        drained |= (map.old_base != NULL);
+        if (i % 3 == 0) {
+            ck_assert_int_eq(dsc_hmap_remove_entry(&map, &i), DSC_EOK);
+        }
+    }
+    ck_assert(drained);
+    ck_assert_int_eq(map.count, 10000 - 3334);
+
+    for (int i = 0; i < 10000; ++i) {
+        Buffer_t value = dsc_hmap_retrieve_value(&map, &i);
+        if (i % 3 == 0) {
+            ck_assert_ptr_null(value.base);
+        } else {
+            ck_assert_ptr_nonnull(value.base);
+            ck_assert_int_eq(*(int*)value.base, i);
+        }
+    }
+
+    ck_assert_int_eq(dsc_hmap_set_resize(&map, RESIZE_BLOCKING), DSC_EOK);
+    ck_assert_ptr_null(map.old_base);
+    ck_assert(dsc_hmap_contains_key(&map, &(int){ 9998 }));
+    dsc_hmap_destroy(&map);
+}
+END_TEST
+
+START_TEST(SnapshotRoundTrip) {
+    Map_t map = { 0 };
+    Map_t loaded = { 0 };
+    Snapshot_t snap = { 0 };
+    const char *path = "dsc_hmap_test.snap";
+    const char *names[] = { "alpha", "beta", "gamma", "delta" };
+
+    dsc_hmap_init(&map, 0, 0, sizeof(int));
+    for (int i = 0; i < 4; ++i) {
+        ck_assert_int_eq(dsc_hmap_add_entry(&map, names[i], &i), DSC_EOK);
+    }
+    dsc_hmap_remove_entry(&map, "beta");
+    ck_assert_int_eq(dsc_hmap_save(&map, path), DSC_EOK);
+    dsc_hmap_destroy(&map);
+
+    ck_assert_int_eq(dsc_snapshot_open(&snap, path), DSC_EOK);
+    Buffer_t value = dsc_hmap_snapshot_retrieve_value(&snap, "gamma");
+    ck_assert_ptr_nonnull(value.base);
+    ck_assert_int_eq(*(int*)value.base, 2);
+    ck_assert(dsc_hmap_snapshot_contains_key(&snap, "delta"));
+    ck_assert(!dsc_hmap_snapshot_contains_key(&snap, "beta"));
+    ck_assert(!dsc_hmap_snapshot_contains_key(&snap, "epsilon"));
+
+    ck_assert_int_eq(dsc_hmap_load(&loaded, &snap, NULL), DSC_EOK);
+    ck_assert_int_eq(loaded.count, 3);
+    ck_assert_int_eq(*(int*)dsc_hmap_retrieve_value(&loaded, "alpha").base, 0);
+    dsc_hmap_destroy(&loaded);
+
+    ck_assert_int_eq(dsc_snapshot_close(&snap), DSC_EOK);
+    unlink(path);
+}
+END_TEST
+
+// Mirrors the snapshot layout described in hmap.c, so that tests can corrupt an image
+typedef struct {
+    SnapshotHeader_t hdr;
+    uint64_t nslots;
+    uint64_t count;
+    uint64_t ksize;
+    uint64_t vsize;
+    uint64_t slots_off;
+} TestSnapshot_t;
+
+typedef struct {
+    uint32_t hash;
+    uint32_t klen;
+    uint64_t off;
+} TestSlot_t;
+
+// Saves map, reads the image back into memory and returns its first occupied slot
+static uint8_t *save_image(Map_t *map, const char *path, size_t *size, TestSlot_t **slot) {
+    ck_assert_int_eq(dsc_hmap_save(map, path), DSC_EOK);
+    FILE *file = fopen(path, "rb");
+    ck_assert_ptr_nonnull(file);
+    fseek(file, 0, SEEK_END);
+    *size = (size_t)ftell(file);
+    rewind(file);
+    uint8_t *image = malloc(*size);
+    ck_assert_ptr_nonnull(image);
+    ck_assert_uint_eq(fread(image, 1, *size, file), *size);
+    fclose(file);
+    unlink(path);
+
+    const TestSnapshot_t *hdr = (const TestSnapshot_t*)image;
+    TestSlot_t *slots = (TestSlot_t*)(image + hdr->slots_off);
+    for (*slot = slots; (*slot)->off == 0; ++*slot);
+
+    return image;
+}
+
+START_TEST(LoadCorruptSnapshot) {
+    Map_t map = { 0 };
+    Map_t loaded = { 0 };
+    Snapshot_t snap = { 0 };
+    TestSlot_t *slot = NULL;
+    size_t size = 0;
+    const char *path = "dsc_hmap_corrupt.snap";
+    int value = 1;
+
+    // A string key whose terminator is missing or comes early
+    dsc_hmap_init(&map, 0, 0, sizeof(int));
+    ck_assert_int_eq(dsc_hmap_add_entry(&map, "alpha", &value), DSC_EOK);
+    uint8_t *image = save_image(&map, path, &size, &slot);
+    dsc_hmap_destroy(&map);
+    ck_assert_int_eq(dsc_snapshot_from(&snap, image, size), DSC_EOK);
+
+    slot->klen -= 1;
+    ck_assert_int_eq(dsc_hmap_load(&loaded, &snap, NULL), DSC_EINVAL);
+    ck_assert(!dsc_hmap_snapshot_contains_key(&snap, "alph"));
+    slot->klen += 2;
+    ck_assert_int_eq(dsc_hmap_load(&loaded, &snap, NULL), DSC_EINVAL);
+    slot->klen = 0;
+    ck_assert_int_eq(dsc_hmap_load(&loaded, &snap, NULL), DSC_EINVAL);
+    slot->klen = 6;
+    slot->off = size;
+    ck_assert_int_eq(dsc_hmap_load(&loaded, &snap, NULL), DSC_EINVAL);
+    free(image);
+
+    // A fixed-size key whose length disagrees with the map's
+    int key = 7;
+    dsc_hmap_init(&map, 0, sizeof(int), sizeof(int));
+    ck_assert_int_eq(dsc_hmap_add_entry(&map, &key, &value), DSC_EOK);
+    image = save_image(&map, path, &size, &slot);
+    dsc_hmap_destroy(&map);
+    ck_assert_int_eq(dsc_snapshot_from(&snap, image, size), DSC_EOK);
+
+    slot->klen = sizeof(int) * 64;
+    ck_assert_int_eq(dsc_hmap_load(&loaded, &snap, NULL), DSC_EINVAL);
+    slot->klen = sizeof(int);
+    ck_assert_int_eq(dsc_hmap_load(&loaded, &snap, NULL), DSC_EOK);
+    ck_assert_int_eq(*(int*)dsc_hmap_retrieve_value(&loaded, &key).base, 1);
+    dsc_hmap_destroy(&loaded);
+    free(image);
+}
+END_TEST
+
+START_TEST(AddMany) {
+    Map_t map = { 0 };
+    const size_t n = 40000;
+    uint64_t *keys = malloc(n * sizeof(uint64_t));
+    uint64_t *values = malloc(n * sizeof(uint64_t));
+
+    dsc_hmap_init(&map, 0, sizeof(uint64_t), sizeof(uint64_t));
+    for (uint64_t i = 0; i < 100; ++i) {
+        dsc_hmap_add_entry(&map, &i, &i);
+        if (i % 2 == 0) {
+            dsc_hmap_remove_entry(&map, &i); // Leave tombstones for the bulk insert to reuse
+        }
+    }
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = 1000 + i * 7;
+        values[i] = i;
+    }
+
+    ck_assert_int_eq(dsc_hmap_add_many(&map, keys, values, n, 4), DSC_EOK);
+    ck_assert_int_eq(map.count, n + 50);
+    for (size_t i = 0; i < n; ++i) {
+        Buffer_t value = dsc_hmap_retrieve_value(&map, &keys[i]);
+        ck_assert_ptr_nonnull(value.base);
+        ck_assert_int_eq(*(uint64_t*)value.base, i);
+    }
+    ck_assert(dsc_hmap_contains_key(&map, &(uint64_t){ 99 }));
+
+    // Duplicates are reported but do not stop the rest of the batch
+    keys[0] = 99;
+    keys[1] = 5000000;
+    ck_assert_int_eq(dsc_hmap_add_many(&map, keys, values, 2, 4), DSC_EINVAL);
+    ck_assert(dsc_hmap_contains_key(&map, &keys[1]));
+
+    dsc_hmap_destroy(&map);
+    free(keys);
+    free(values);
+}
+END_TEST
+
+/*
+ * Allocator that fails once the budget in *ctx runs out (a negative budget never runs out). The
+ * workers of a bulk insert share the budget, so it is taken atomically.
+ */
+static bool oom_take(void *ctx) {
+    int *budget = ctx;
+    int cur = __atomic_load_n(budget, __ATOMIC_RELAXED);
+    while (cur > 0 && !__atomic_compare_exchange_n(budget, &cur, cur - 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    return cur != 0;
+}
+
+static void *oom_alloc(void *ctx, size_t size) {
+    return oom_take(ctx) ? malloc(size) : NULL;
+}
+
+static void *oom_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)old_size;
+    return oom_take(ctx) ? realloc(ptr, new_size) : NULL;
+}
+
+static void oom_free(void *ctx, void *ptr, size_t size) {
+    (void)ctx;
+    (void)size;
+    free(ptr);
+}
+
+START_TEST(AddManyFailure) {
+    const size_t n = 40000;
+    uint64_t *keys = malloc(n * sizeof(uint64_t));
+    int budget = -1;
+    // No stats are attached, so the insert is not forced onto a single thread
+    DscAllocator_t alloc = { oom_alloc, oom_realloc, oom_free, &budget, NULL };
+    Map_t map = { 0 };
+
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = 1000 + i;
+    }
+
+    // Fail the table's growth, then each scratch array in turn; none of them may leave entries behind
+    for (int fail = 0; fail < 5; ++fail) {
+        budget = -1;
+        dsc_hmap_init_alloc(&map, 0, sizeof(uint64_t), sizeof(uint64_t), &alloc);
+        for (uint64_t i = 0; i < 10; ++i) {
+            dsc_hmap_add_entry(&map, &i, &i);
+        }
+
+        budget = fail;
+        ck_assert_int_eq(dsc_hmap_add_many(&map, keys, keys, n, 4), DSC_ENOMEM);
+        budget = -1;
+        ck_assert_int_eq(map.count, 10);
+        ck_assert(!dsc_hmap_contains_key(&map, &keys[0]));
+        ck_assert(!dsc_hmap_contains_key(&map, &keys[n - 1]));
+        ck_assert(dsc_hmap_contains_key(&map, &(uint64_t){ 9 }));
+
+        // The same batch goes in once memory is available
+        ck_assert_int_eq(dsc_hmap_add_many(&map, keys, keys, n, 4), DSC_EOK);
+        ck_assert_int_eq(map.count, n + 10);
+        dsc_hmap_destroy(&map);
+    }
+
+    // Running out while the workers copy entries in keeps the entries already added
+    dsc_hmap_init_alloc(&map, 0, sizeof(uint64_t), sizeof(uint64_t), &alloc);
+    budget = 5 + (int)n / 2;
+    ck_assert_int_eq(dsc_hmap_add_many(&map, keys, keys, n, 4), DSC_ENOMEM);
+    budget = -1;
+    size_t found = 0;
+    for (size_t i = 0; i < n; ++i) {
+        found += dsc_hmap_contains_key(&map, &keys[i]);
+    }
+    ck_assert_int_eq(found, map.count);
+    ck_assert_int_lt(map.count, n);
+
+    // Retrying adds the rest and reports the entries that were already present
+    ck_assert_int_eq(dsc_hmap_add_many(&map, keys, keys, n, 4), DSC_EINVAL);
+    ck_assert_int_eq(map.count, n);
+    dsc_hmap_destroy(&map);
+
+    free(keys);
+}
+END_TEST
+
+START_TEST(RetrieveMany) {
+    Map_t map = { 0 };
+    size_t n = 0;
+    uint64_t keys[8192];
+    void *values[8192];
+    bool found[8192];
+
+    dsc_hmap_init(&map, 0, sizeof(uint64_t), sizeof(uint64_t));
+    dsc_hmap_set_resize(&map, RESIZE_INCREMENTAL);
+    // Stop partway through a resize, so that some keys are still only in the old slot array
+    while (n < 500 || map.old_base == NULL) {
+        dsc_hmap_add_entry(&map, &(uint64_t){ n }, &(uint64_t){ n * 3 });
+        ++n;
+    }
+    ck_assert_uint_le(n, 4096);
+    for (size_t i = 0; i < 2 * n; ++i) {
+        keys[i] = (i % 2 == 0) ? i / 2 : n + i; // Every other key is absent
+    }
+
+    ck_assert_int_eq(dsc_hmap_retrieve_many(&map, keys, 2 * n, values), n);
+    ck_assert_int_eq(dsc_hmap_contains_many(&map, keys, 2 * n, found), n);
+    for (size_t i = 0; i < 2 * n; ++i) {
+        if (i % 2 == 0) {
+            ck_assert_ptr_nonnull(values[i]);
+            ck_assert_int_eq(*(uint64_t*)values[i], (i / 2) * 3);
+            ck_assert(found[i]);
+        } else {
+            ck_assert_ptr_null(values[i]);
+            ck_assert(!found[i]);
+        }
+    }
+    ck_assert_int_eq(dsc_hmap_retrieve_many(&map, NULL, 0, NULL), 0);
+    dsc_hmap_destroy(&map);
+
+    const char *names[] = { "alpha", "beta", "gamma", "delta" };
+    dsc_hmap_init(&map, 0, 0, sizeof(int));
+    dsc_hmap_add_entry(&map, "beta", &(int){ 2 });
+    dsc_hmap_add_entry(&map, "delta", &(int){ 4 });
+    ck_assert_int_eq(dsc_hmap_retrieve_many(&map, names, 4, values), 2);
+    ck_assert_ptr_null(values[0]);
+    ck_assert_int_eq(*(int*)values[1], 2);
+    ck_assert_ptr_null(values[2]);
+    ck_assert_int_eq(*(int*)values[3], 4);
+    dsc_hmap_destroy(&map);
+}
+END_TEST
+
+Suite *hmap_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("HMap");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, CreateHMap);
+    tcase_add_test(tc_core, AddRetrieveEntry);
+    tcase_add_test(tc_core, ReplaceRemoveEntry);
+    tcase_add_test(tc_core, CustomAllocator);
+    tcase_add_test(tc_core, IncrementalResize);
+    tcase_add_test(tc_core, SnapshotRoundTrip);
+    tcase_add_test(tc_core, LoadCorruptSnapshot);
+    tcase_add_test(tc_core, AddMany);
+    tcase_add_test(tc_core, AddManyFailure);
+    tcase_add_test(tc_core, RetrieveMany);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = hmap_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "intern.h"
+#include "hmap.h"
+
+#define NSTRINGS 20000
+
+START_TEST(AddFind) {
+    Intern_t pool = { 0 };
+    char str[32];
+    uint32_t id;
+
+    // Start small so that the arena, ID arrays and index all grow
+    ck_assert_int_eq(dsc_intern_init(&pool, 4), DSC_EOK);
+    for (size_t i = 0; i < NSTRINGS; ++i) {
+        snprintf(str, sizeof(str), "string-%zu", i);
+        ck_assert_int_eq(dsc_intern_add(&pool, str, &id), DSC_EOK);
+        ck_assert_uint_eq(id, i);
+    }
+    ck_assert_uint_eq(dsc_intern_count(&pool), NSTRINGS);
+
+    // Interning an equal string again hands back the same ID and stores nothing
+    const size_t bytes = dsc_intern_bytes(&pool);
+    for (size_t i = 0; i < NSTRINGS; ++i) {
+        snprintf(str, sizeof(str), "string-%zu", i);
+        ck_assert_int_eq(dsc_intern_add(&pool, str, &id), DSC_EOK);
+        ck_assert_uint_eq(id, i);
+        ck_assert_int_eq(dsc_intern_find(&pool, str, &id), DSC_EOK);
+        ck_assert_uint_eq(id, i);
+        ck_assert_str_eq(dsc_intern_str(&pool, id), str);
+    }
+    ck_assert_uint_eq(dsc_intern_count(&pool), NSTRINGS);
+    ck_assert_uint_eq(dsc_intern_bytes(&pool), bytes);
+
+    ck_assert_int_eq(dsc_intern_find(&pool, "absent", &id), DSC_ENODATA);
+    ck_assert_int_eq(dsc_intern_add(&pool, "", &id), DSC_EOK);
+    ck_assert_str_eq(dsc_intern_str(&pool, id), "");
+    ck_assert_ptr_null(dsc_intern_str(&pool, NSTRINGS + 1));
+
+    ck_assert_int_eq(dsc_intern_destroy(&pool), DSC_EOK);
+}
+END_TEST
+
+START_TEST(InternedMapKeys) {
+    Intern_t pool = { 0 };
+    Map_t map = { 0 };
+    const char *words[] = { "apple", "banana", "cherry", "apple", "cherry", "apple" };
+    uint32_t id;
+
+    dsc_intern_init(&pool, 0);
+    dsc_hmap_init(&map, 0, sizeof(uint32_t), sizeof(int));
+    ck_assert_int_eq(dsc_hmap_set_hash(&map, int_hash), DSC_EOK);
+
+    for (size_t i = 0; i < sizeof(words) / sizeof(*words); ++i) {
+        dsc_intern_add(&pool, words[i], &id);
+        Buffer_t count = dsc_hmap_retrieve_value(&map, &id);
+        if (count.base != NULL) {
+            ++*(int*)count.base;
+        } else {
+            dsc_hmap_add_entry(&map, &id, &(int){ 1 });
+        }
+    }
+    ck_assert_uint_eq(map.count, 3);
+
+    dsc_intern_find(&pool, "apple", &id);
+    ck_assert_int_eq(*(int*)dsc_hmap_retrieve_value(&map, &id).base, 3);
+    dsc_intern_find(&pool, "banana", &id);
+    ck_assert_int_eq(*(int*)dsc_hmap_retrieve_value(&map, &id).base, 1);
+
+    // The hash cannot change once the map holds entries
+    ck_assert_int_eq(dsc_hmap_set_hash(&map, NULL), DSC_EINVAL);
+
+    dsc_hmap_destroy(&map);
+    dsc_intern_destroy(&pool);
+}
+END_TEST
+
+Suite *intern_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Intern");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, AddFind);
+    tcase_add_test(tc_core, InternedMapKeys);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = intern_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "iter.h"
+#include "hmap.h"
+
+#define NELEM 1000
+
+// Drains iter in batches of batch pointers, summing the ints they point at
+static size_t drain(Iter_t *iter, const size_t batch, long *sum) {
+    void *elems[DSC_ITER_BATCH];
+    size_t total = 0;
+    size_t n;
+
+    *sum = 0;
+    while ((n = dsc_iter_next(iter, elems, batch)) != 0) {
+        ck_assert_uint_le(n, batch);
+        for (size_t i = 0; i < n; ++i) {
+            *sum += *(int*)elems[i];
+        }
+        total += n;
+    }
+
+    return total;
+}
+
+START_TEST(Sequences) {
+    Iter_t iter;
+    Buffer_t buf;
+    struct DLLNode head, nodes[NELEM];
+    int vals[NELEM];
+    long sum;
+    const long want = (long)NELEM * (NELEM - 1) / 2;
+
+    for (int i = 0; i < NELEM; ++i) {
+        vals[i] = i;
+    }
+
+    // Buffer, visited in index order
+    ck_assert_int_eq(dsc_buf_init(&buf, NELEM, sizeof(int)), DSC_EOK);
+    memcpy(buf.base, vals, sizeof(vals));
+    ck_assert_int_eq(dsc_iter_buf(&iter, &buf), DSC_EOK);
+    void *first[3];
+    ck_assert_uint_eq(dsc_iter_next(&iter, first, 3), 3);
+    ck_assert_int_eq(*(int*)first[2], 2);
+    ck_assert_uint_eq(drain(&iter, 7, &sum), NELEM - 3);
+    ck_assert_int_eq(sum, want - 3);
+    ck_assert_int_eq(dsc_iter_destroy(&iter), DSC_EOK);
+    dsc_buf_destroy(&buf);
+
+    // Singly linked list
+    LLNode_t ll = dsc_ll_create(&vals[0]);
+    for (int i = 1; i < NELEM; ++i) {
+        ck_assert_int_eq(dsc_ll_append(ll, &vals[i]), DSC_EOK);
+    }
+    ck_assert_int_eq(dsc_iter_ll(&iter, ll), DSC_EOK);
+    ck_assert_uint_eq(drain(&iter, DSC_ITER_BATCH, &sum), NELEM);
+    ck_assert_int_eq(sum, want);
+    ck_assert_uint_eq(dsc_iter_next(&iter, first, 3), 0);
+    dsc_ll_destroy(ll);
+
+    // Doubly linked list; the sentinel is skipped
+    dsc_dll_init(&head, NULL);
+    ck_assert_int_eq(dsc_iter_dll(&iter, &head), DSC_EOK);
+    ck_assert_uint_eq(dsc_iter_next(&iter, first, 3), 0);
+    for (int i = 0; i < NELEM; ++i) {
+        dsc_dll_init(&nodes[i], &vals[i]);
+        dsc_dll_append(&head, &nodes[i]);
+    }
+    ck_assert_int_eq(dsc_iter_dll(&iter, &head), DSC_EOK);
+    ck_assert_uint_eq(drain(&iter, 1, &sum), NELEM);
+    ck_assert_int_eq(sum, want);
+
+    ck_assert_int_eq(dsc_iter_ll(&iter, NULL), DSC_EINVAL);
+    ck_assert_int_eq(dsc_iter_buf(NULL, &buf), DSC_EINVAL);
+}
+END_TEST
+
+START_TEST(MapAndTree) {
+    Iter_t iter;
+    Map_t map;
+    int vals[NELEM];
+    void *elems[DSC_ITER_BATCH];
+    size_t n, total = 0;
+    long sum = 0;
+
+    // Iterate while an incremental resize is still draining the old slots
+    ck_assert_int_eq(dsc_hmap_init(&map, 16, sizeof(int), sizeof(int)), DSC_EOK);
+    ck_assert_int_eq(dsc_hmap_set_resize(&map, RESIZE_INCREMENTAL), DSC_EOK);
+    int i = 0;
+    for (; i < NELEM || map.old_base == NULL; ++i) {
+        ck_assert_int_eq(dsc_hmap_add_entry(&map, &i, &i), DSC_EOK);
+    }
+    const int count = i;
+
+    ck_assert_int_eq(dsc_iter_hmap(&iter, &map), DSC_EOK);
+    while ((n = dsc_iter_next(&iter, elems, DSC_ITER_BATCH)) != 0) {
+        for (size_t j = 0; j < n; ++j) {
+            const KV_t *kv = elems[j];
+            ck_assert_int_eq(*(int*)kv->key, *(int*)kv->value);
+            sum += *(int*)kv->key;
+        }
+        total += n;
+    }
+    ck_assert_uint_eq(total, (size_t)count);
+    ck_assert_int_eq(sum, (long)count * (count - 1) / 2);
+    dsc_hmap_destroy(&map);
+
+    // Tree, visited in order
+    for (i = 0; i < NELEM; ++i) {
+        vals[i] = i;
+    }
+    BTreeNode_t root = dsc_btree_build_from_sorted(vals, NELEM, sizeof(int), DFS, NULL);
+    ck_assert_ptr_nonnull(root);
+    ck_assert_int_eq(dsc_iter_btree(&iter, root), DSC_EOK);
+    int expect = 0;
+    while ((n = dsc_iter_next(&iter, elems, 5)) != 0) {
+        for (size_t j = 0; j < n; ++j) {
+            ck_assert_int_eq(*(int*)elems[j], expect++);
+        }
+    }
+    ck_assert_int_eq(expect, NELEM);
+    ck_assert_int_eq(dsc_iter_destroy(&iter), DSC_EOK);
+    dsc_btree_destroy(root);
+}
+END_TEST
+
+// Allocator that fails every request while *ctx is true
+static void *oom_alloc(void *ctx, size_t size) {
+    return *(bool*)ctx ? NULL : malloc(size);
+}
+
+static void *oom_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)old_size;
+    return *(bool*)ctx ? NULL : realloc(ptr, new_size);
+}
+
+static void oom_free(void *ctx, void *ptr, size_t size) {
+    (void)ctx;
+    (void)size;
+    free(ptr);
+}
+
+START_TEST(TreeOutOfMemory) {
+    int vals[NELEM];
+    bool fail = false;
+    DscAllocator_t alloc = { oom_alloc, oom_realloc, oom_free, &fail, NULL };
+    Iter_t iter;
+    void *elems[DSC_ITER_BATCH];
+
+    for (int i = 0; i < NELEM; ++i) {
+        vals[i] = i;
+    }
+    BTreeNode_t root = dsc_btree_build_from_sorted(vals, NELEM, sizeof(int), DFS, &alloc);
+    ck_assert_ptr_nonnull(root);
+
+    // The left spine is deeper than the cursor's inline path, so placing it needs the allocator
+    fail = true;
+    ck_assert_int_eq(dsc_iter_btree(&iter, root), DSC_ENOMEM);
+    ck_assert_uint_eq(dsc_iter_next(&iter, elems, DSC_ITER_BATCH), 0);
+    ck_assert_int_eq(dsc_iter_destroy(&iter), DSC_ENOMEM);
+
+    fail = false;
+    ck_assert_int_eq(dsc_iter_btree(&iter, root), DSC_EOK);
+    ck_assert_uint_eq(dsc_iter_next(&iter, elems, DSC_ITER_BATCH), DSC_ITER_BATCH);
+    ck_assert_int_eq(dsc_iter_destroy(&iter), DSC_EOK);
+    dsc_btree_destroy(root);
+}
+END_TEST
+
+Suite *iter_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Iter");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, Sequences);
+    tcase_add_test(tc_core, MapAndTree);
+    tcase_add_test(tc_core, TreeOutOfMemory);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = iter_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "packed.h"
+
+#define NELEM 10007 // Leaves a partial last block
+
+static uint64_t next_rand(uint64_t *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// Checks get and decode of every run length and alignment against the original values
+static void check_values(const PackedArray_t* const arr, const uint64_t *values, const size_t n) {
+    uint64_t out[300];
+
+    ck_assert_uint_eq(dsc_packed_nelem(arr), n);
+    for (size_t i = 0; i < n; ++i) {
+        ck_assert_uint_eq(dsc_packed_get(arr, i), values[i]);
+    }
+    for (size_t start = 0; start < n; start += 97) {
+        const size_t len = (start * 7) % 300;
+        const size_t got = dsc_packed_decode(arr, start, len, out);
+        ck_assert_uint_eq(got, (n - start < len) ? n - start : len);
+        for (size_t i = 0; i < got; ++i) {
+            ck_assert_uint_eq(out[i], values[start + i]);
+        }
+    }
+}
+
+START_TEST(GetDecode) {
+    PackedArray_t arr;
+    uint64_t *values = malloc(NELEM * sizeof(uint64_t));
+    uint64_t state = 88172645463325252ULL;
+
+    // Offsets of 0 bits (all equal), odd widths that straddle words, and the full 64 bits
+    const unsigned widths[] = { 0, 1, 7, 13, 33, 63, 64 };
+    for (size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); ++w) {
+        const uint64_t mask = (widths[w] < 64) ? (UINT64_C(1) << widths[w]) - 1 : UINT64_MAX;
+        for (size_t i = 0; i < NELEM; ++i) {
+            values[i] = 1000000 + (next_rand(&state) & mask);
+        }
+        ck_assert_int_eq(dsc_packed_init(&arr, values, NELEM), DSC_EOK);
+        check_values(&arr, values, NELEM);
+        ck_assert_int_eq(dsc_packed_destroy(&arr), DSC_EOK);
+    }
+
+    ck_assert_int_eq(dsc_packed_init(&arr, NULL, 0), DSC_EOK);
+    ck_assert_uint_eq(dsc_packed_decode(&arr, 0, 10, values), 0);
+    ck_assert_uint_eq(dsc_packed_lower_bound(&arr, 5), 0);
+    ck_assert_int_eq(dsc_packed_destroy(&arr), DSC_EOK);
+    ck_assert_int_eq(dsc_packed_init(NULL, values, 1), DSC_EINVAL);
+
+    free(values);
+}
+END_TEST
+
+START_TEST(SortedIds) {
+    PackedArray_t arr;
+    uint64_t *values = malloc(NELEM * sizeof(uint64_t));
+    uint64_t state = 88172645463325252ULL;
+    uint64_t id = 1u << 30;
+
+    // Gaps of up to 255, with runs of duplicates
+    for (size_t i = 0; i < NELEM; ++i) {
+        id += (i % 10 == 0) ? 0 : next_rand(&state) % 256;
+        values[i] = id;
+    }
+    ck_assert_int_eq(dsc_packed_init(&arr, values, NELEM), DSC_EOK);
+    check_values(&arr, values, NELEM);
+    ck_assert_uint_lt(dsc_packed_bytes(&arr) * 4, NELEM * sizeof(uint64_t));
+
+    for (size_t i = 0; i < NELEM; ++i) {
+        for (uint64_t delta = 0; delta < 2; ++delta) {
+            const uint64_t key = values[i] + delta;
+            size_t want = 0;
+            while (want < NELEM && values[want] < key) {
+                want += (want + 64 < NELEM && values[want + 64] < key) ? 64 : 1;
+            }
+            ck_assert_uint_eq(dsc_packed_lower_bound(&arr, key), want);
+        }
+    }
+    ck_assert_uint_eq(dsc_packed_lower_bound(&arr, 0), 0);
+    ck_assert_uint_eq(dsc_packed_lower_bound(&arr, UINT64_MAX), NELEM);
+    ck_assert_int_eq(dsc_packed_destroy(&arr), DSC_EOK);
+
+    free(values);
+}
+END_TEST
+
+Suite *packed_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Packed");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, GetDecode);
+    tcase_add_test(tc_core, SortedIds);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = packed_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
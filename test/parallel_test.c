@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "parallel.h"
+
+static int int_cmp(const void *lhs, const void *rhs) {
+    const int a = *(const int*)lhs;
+    const int b = *(const int*)rhs;
+    return (a > b) - (a < b);
+}
+
+static void mark_share(void *ctx, const size_t idx, const size_t nthreads) {
+    int *marks = ctx;
+    ck_assert_int_lt(idx, nthreads);
+    marks[idx] += 1;
+}
+
+START_TEST(RunEveryShare) {
+    int marks[8] = { 0 };
+
+    ck_assert_int_ge(dsc_parallel_nthreads(0), 1);
+    ck_assert_int_eq(dsc_parallel_nthreads(3), 3);
+    ck_assert_int_eq(dsc_parallel_run(mark_share, marks, 8), DSC_EOK);
+    for (size_t i = 0; i < 8; ++i) {
+        ck_assert_int_eq(marks[i], 1);
+    }
+}
+END_TEST
+
+START_TEST(SortMatchesQsort) {
+    // Odd sizes so that the runs are uneven and the last merge pass has an unpaired run
+    const size_t sizes[] = { 0, 1, 17, 4096 * 3 + 5, 100003 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        const size_t n = sizes[s];
+        int *nums = malloc((n + 1) * sizeof(int));
+        int *expect = malloc((n + 1) * sizeof(int));
+
+        srand(42);
+        for (size_t i = 0; i < n; ++i) {
+            nums[i] = expect[i] = rand() % 1000;
+        }
+        qsort(expect, n, sizeof(int), int_cmp);
+
+        ck_assert_int_eq(dsc_parallel_sort(nums, n, sizeof(int), int_cmp, 3), DSC_EOK);
+        for (size_t i = 0; i < n; ++i) {
+            ck_assert_int_eq(nums[i], expect[i]);
+        }
+
+        free(nums);
+        free(expect);
+    }
+}
+END_TEST
+
+Suite *parallel_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Parallel");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, RunEveryShare);
+    tcase_add_test(tc_core, SortMatchesQsort);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = parallel_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "pool.h"
+#include "parallel.h"
+
+#define NINDICES 200000
+
+typedef struct {
+    ThreadPool_t *pool;
+    uint8_t      *marks;
+    size_t        nested;
+} Visit_t;
+
+static void visit(void *ctx, const size_t lo, const size_t hi) {
+    Visit_t *visit = ctx;
+
+    for (size_t i = lo; i < hi; ++i) {
+        __atomic_add_fetch(&visit->marks[i], 1, __ATOMIC_RELAXED);
+    }
+}
+
+// Work grows with the index, so an even split would leave the last thread with most of it
+static void visit_uneven(void *ctx, const size_t lo, const size_t hi) {
+    Visit_t *visit = ctx;
+    volatile size_t spin = 0;
+
+    for (size_t i = lo; i < hi; ++i) {
+        for (size_t j = 0; j < i / 1000; ++j) {
+            ++spin;
+        }
+        __atomic_add_fetch(&visit->marks[i], 1, __ATOMIC_RELAXED);
+    }
+}
+
+static void visit_nested(void *ctx, const size_t lo, const size_t hi) {
+    Visit_t *outer = ctx;
+    uint8_t marks[16] = { 0 };
+    Visit_t inner = { outer->pool, marks, 0 };
+
+    // A job started from inside another runs on the calling thread
+    dsc_pool_for(outer->pool, 16, 1, visit, &inner);
+    for (size_t i = 0; i < 16; ++i) {
+        ck_assert_int_eq(marks[i], 1);
+    }
+    visit(ctx, lo, hi);
+    __atomic_add_fetch(&outer->nested, 1, __ATOMIC_RELAXED);
+}
+
+static int int_cmp(const void *lhs, const void *rhs) {
+    const int a = *(const int*)lhs;
+    const int b = *(const int*)rhs;
+    return (a > b) - (a < b);
+}
+
+START_TEST(ForVisitsEachIndexOnce) {
+    ThreadPool_t pool;
+    Visit_t job = { &pool, calloc(NINDICES, 1), 0 };
+
+    ck_assert_int_eq(dsc_pool_init(&pool, 4), DSC_EOK);
+    ck_assert_uint_eq(dsc_pool_nthreads(&pool), 4);
+
+    ck_assert_int_eq(dsc_pool_for(&pool, NINDICES, 64, visit, &job), DSC_EOK);
+    ck_assert_int_eq(dsc_pool_for(&pool, NINDICES, 0, visit_uneven, &job), DSC_EOK);
+    for (size_t i = 0; i < NINDICES; ++i) {
+        ck_assert_int_eq(job.marks[i], 2);
+    }
+
+    // Many small jobs back to back, so that workers join and leave jobs constantly
+    memset(job.marks, 0, NINDICES);
+    for (size_t round = 0; round < 200; ++round) {
+        ck_assert_int_eq(dsc_pool_for(&pool, 100, 1, visit, &job), DSC_EOK);
+    }
+    for (size_t i = 0; i < 100; ++i) {
+        ck_assert_int_eq(job.marks[i], 200);
+    }
+
+    memset(job.marks, 0, NINDICES);
+    ck_assert_int_eq(dsc_pool_for(&pool, 1000, 10, visit_nested, &job), DSC_EOK);
+    for (size_t i = 0; i < 1000; ++i) {
+        ck_assert_int_eq(job.marks[i], 1);
+    }
+    ck_assert_uint_ge(job.nested, 1);
+
+    ck_assert_int_eq(dsc_pool_destroy(&pool), DSC_EOK);
+    free(job.marks);
+}
+END_TEST
+
+START_TEST(InstalledPool) {
+    ThreadPool_t pool;
+    Visit_t job = { &pool, calloc(NINDICES, 1), 0 };
+    const size_t n = 100003;
+    int *nums = malloc(n * sizeof(int));
+
+    dsc_pool_init(&pool, 3);
+    dsc_parallel_set_pool(&pool);
+
+    ck_assert_int_eq(dsc_parallel_for(NINDICES, 1000, visit, &job), DSC_EOK);
+    for (size_t i = 0; i < NINDICES; ++i) {
+        ck_assert_int_eq(job.marks[i], 1);
+    }
+
+    // Bulk operations built on dsc_parallel_run() now run their shares on the pool
+    srand(3);
+    for (size_t i = 0; i < n; ++i) {
+        nums[i] = rand();
+    }
+    ck_assert_int_eq(dsc_parallel_sort(nums, n, sizeof(int), int_cmp, 8), DSC_EOK);
+    for (size_t i = 1; i < n; ++i) {
+        ck_assert_int_le(nums[i - 1], nums[i]);
+    }
+
+    dsc_parallel_set_pool(NULL);
+    ck_assert_int_eq(dsc_parallel_for(NINDICES, 1000, visit, &job), DSC_EOK);
+    for (size_t i = 0; i < NINDICES; ++i) {
+        ck_assert_int_eq(job.marks[i], 2);
+    }
+
+    dsc_pool_destroy(&pool);
+    free(job.marks);
+    free(nums);
+}
+END_TEST
+
+Suite *pool_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Pool");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, ForVisitsEachIndexOnce);
+    tcase_add_test(tc_core, InstalledPool);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = pool_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
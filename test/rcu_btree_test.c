@@ -0,0 +1,117 @@
+// rcu_btree.h comes first so that the feature macros it needs are set before any system header
+#include "rcu_btree.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#define NKEYS 2000
+
+static RcuBTree_t shared;
+static int keys[NKEYS];
+static int done;
+
+static InsertCmp_t rcu_insert_func(const BTreeNode_t node, const BTreeNode_t cmp) {
+    return (*(int*)cmp->data < *(int*)node->data) ? INSERT_LT : INSERT_GT;
+}
+
+// rcu_search_func takes no context, so each reader thread keeps its needle here
+static __thread int needle;
+
+static SearchCmp_t rcu_search_func(const BTreeNode_t node) {
+    if (needle < *(int*)node->data) {
+        return SEARCH_LT;
+    } else if (needle > *(int*)node->data) {
+        return SEARCH_GT;
+    } else {
+        return SEARCH_EQ;
+    }
+}
+
+static void *reader(void *arg) {
+    RcuReader_t self;
+    (void)arg;
+
+    dsc_rcu_btree_register(&shared, &self);
+    while (!__atomic_load_n(&done, __ATOMIC_ACQUIRE)) {
+        for (int i = 0; i < NKEYS; i += 37) {
+            BTreeNode_t root = dsc_rcu_btree_read_begin(&shared, &self);
+            needle = keys[i];
+            BTreeNode_t node = (root != NULL) ? dsc_btree_peek(root, rcu_search_func) : NULL;
+            ck_assert(node == NULL || *(int*)node->data == keys[i]);
+            dsc_rcu_btree_read_end(&self);
+        }
+    }
+    dsc_rcu_btree_unregister(&shared, &self);
+
+    return NULL;
+}
+
+START_TEST(ConcurrentReaders) {
+    pthread_t threads[3];
+    RcuReader_t self;
+
+    for (int i = 0; i < NKEYS; ++i) {
+        keys[i] = (int)(((unsigned)i * 2654435761u) % 100003u);
+    }
+    ck_assert_int_eq(dsc_rcu_btree_init(&shared, DFS, NULL), DSC_EOK);
+    for (int t = 0; t < 3; ++t) {
+        pthread_create(&threads[t], NULL, reader, NULL);
+    }
+
+    for (int i = 0; i < NKEYS; ++i) {
+        ck_assert_int_eq(dsc_rcu_btree_add(&shared, &keys[i], NULL, rcu_insert_func), DSC_EOK);
+    }
+    for (int i = 0; i < NKEYS; i += 2) {
+        needle = keys[i];
+        dsc_rcu_btree_remove(&shared, rcu_search_func);
+    }
+
+    __atomic_store_n(&done, 1, __ATOMIC_RELEASE);
+    for (int t = 0; t < 3; ++t) {
+        pthread_join(threads[t], NULL);
+    }
+
+    // Removing an even key drops its subtree too, so only check that the removed keys are gone
+    dsc_rcu_btree_register(&shared, &self);
+    BTreeNode_t root = dsc_rcu_btree_read_begin(&shared, &self);
+    for (int i = 0; root != NULL && i < NKEYS; i += 2) {
+        needle = keys[i];
+        ck_assert_ptr_null(dsc_btree_peek(root, rcu_search_func));
+    }
+    dsc_rcu_btree_read_end(&self);
+    ck_assert_int_eq(dsc_rcu_btree_unregister(&shared, &self), DSC_EOK);
+    ck_assert_int_eq(dsc_rcu_btree_unregister(&shared, &self), DSC_ENODATA);
+
+    ck_assert_int_eq(dsc_rcu_btree_destroy(&shared), DSC_EOK);
+}
+END_TEST
+
+Suite *rcu_btree_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("RcuBTree");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, ConcurrentReaders);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = rcu_btree_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,120 @@
+// skiplist.h comes first so that the feature macros it needs are set before any system header
+#include "skiplist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <check.h>
+
+#define NTHREADS   4
+#define PER_THREAD 5000
+
+static SkipList_t shared;
+
+static int u64_cmp(const void *lhs, const void *rhs) {
+    const uint64_t a = *(const uint64_t*)lhs;
+    const uint64_t b = *(const uint64_t*)rhs;
+    return (a > b) - (a < b);
+}
+
+static void sum_visit(const void *key, void *value, void *ctx) {
+    (void)key;
+    *(uint64_t*)ctx += *(uint64_t*)value;
+}
+
+START_TEST(OrderedOps) {
+    SkipList_t list = { 0 };
+    uint64_t sum = 0;
+
+    ck_assert_int_eq(dsc_skiplist_init(&list, sizeof(uint64_t), sizeof(uint64_t), u64_cmp), DSC_EOK);
+    // Insert out of order: 0, 7, 14, ... modulo a prime, so every key in [0, 1009) appears once
+    for (uint64_t i = 0; i < 1009; ++i) {
+        const uint64_t key = (i * 7) % 1009;
+        ck_assert_int_eq(dsc_skiplist_add(&list, &key, &key), DSC_EOK);
+    }
+    ck_assert_int_eq(dsc_skiplist_add(&list, &(uint64_t){ 5 }, NULL), DSC_EINVAL);
+    ck_assert_int_eq(dsc_skiplist_count(&list), 1009);
+
+    uint64_t expect = 0;
+    for (SkipNode_t node = dsc_skiplist_first(&list); node != NULL; node = dsc_skiplist_next(node)) {
+        ck_assert_int_eq(*(const uint64_t*)dsc_skiplist_key(node), expect++);
+    }
+    ck_assert_int_eq(expect, 1009);
+
+    for (uint64_t key = 0; key < 1009; key += 2) {
+        ck_assert_int_eq(dsc_skiplist_remove(&list, &key), DSC_EOK);
+    }
+    ck_assert_int_eq(dsc_skiplist_remove(&list, &(uint64_t){ 0 }), DSC_ENODATA);
+    ck_assert_ptr_null(dsc_skiplist_find(&list, &(uint64_t){ 10 }));
+    ck_assert_int_eq(*(uint64_t*)dsc_skiplist_find(&list, &(uint64_t){ 11 }), 11);
+    ck_assert_int_eq(*(const uint64_t*)dsc_skiplist_key(dsc_skiplist_lower_bound(&list, &(uint64_t){ 20 })), 21);
+
+    // [10, 20) now holds 11, 13, 15, 17 and 19
+    ck_assert_int_eq(dsc_skiplist_range(&list, &(uint64_t){ 10 }, &(uint64_t){ 20 }, sum_visit, &sum), DSC_EOK);
+    ck_assert_int_eq(sum, 11 + 13 + 15 + 17 + 19);
+
+    dsc_skiplist_destroy(&list);
+}
+END_TEST
+
+static void *insert_worker(void *arg) {
+    const uint64_t t = (uint64_t)(uintptr_t)arg;
+    for (uint64_t i = 0; i < PER_THREAD; ++i) {
+        // Interleave the threads' keys so that they race for the same predecessors
+        const uint64_t key = i * NTHREADS + t;
+        ck_assert_int_eq(dsc_skiplist_add_concurrent(&shared, &key, &key), DSC_EOK);
+        ck_assert_ptr_nonnull(dsc_skiplist_find(&shared, &key));
+    }
+    return NULL;
+}
+
+START_TEST(ConcurrentInsert) {
+    pthread_t threads[NTHREADS];
+
+    dsc_skiplist_init(&shared, sizeof(uint64_t), sizeof(uint64_t), u64_cmp);
+    for (uintptr_t t = 0; t < NTHREADS; ++t) {
+        pthread_create(&threads[t], NULL, insert_worker, (void*)t);
+    }
+    for (size_t t = 0; t < NTHREADS; ++t) {
+        pthread_join(threads[t], NULL);
+    }
+
+    ck_assert_int_eq(dsc_skiplist_count(&shared), NTHREADS * PER_THREAD);
+    uint64_t expect = 0;
+    for (SkipNode_t node = dsc_skiplist_first(&shared); node != NULL; node = dsc_skiplist_next(node)) {
+        ck_assert_int_eq(*(uint64_t*)dsc_skiplist_value(&shared, node), expect++);
+    }
+    ck_assert_int_eq(expect, NTHREADS * PER_THREAD);
+    dsc_skiplist_destroy(&shared);
+}
+END_TEST
+
+Suite *skiplist_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("SkipList");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, OrderedOps);
+    tcase_add_test(tc_core, ConcurrentInsert);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = skiplist_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
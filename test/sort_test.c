@@ -0,0 +1,256 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "sort.h"
+
+typedef struct {
+    uint32_t key;
+    uint32_t seq;
+} Pair_t;
+
+typedef struct {
+    uint64_t key;
+    uint8_t  pad[72]; // Wider than the on-stack temporary used for small elements
+} Wide_t;
+
+static int u32_cmp(const void *lhs, const void *rhs) {
+    const uint32_t a = *(const uint32_t*)lhs;
+    const uint32_t b = *(const uint32_t*)rhs;
+    return (a > b) - (a < b);
+}
+
+static int u64_cmp(const void *lhs, const void *rhs) {
+    const uint64_t a = *(const uint64_t*)lhs;
+    const uint64_t b = *(const uint64_t*)rhs;
+    return (a > b) - (a < b);
+}
+
+static int i16_cmp(const void *lhs, const void *rhs) {
+    const int16_t a = *(const int16_t*)lhs;
+    const int16_t b = *(const int16_t*)rhs;
+    return (a > b) - (a < b);
+}
+
+static int i64_cmp(const void *lhs, const void *rhs) {
+    const int64_t a = *(const int64_t*)lhs;
+    const int64_t b = *(const int64_t*)rhs;
+    return (a > b) - (a < b);
+}
+
+// Fills n 32-bit values following one of several patterns
+static void fill(uint32_t *nums, const size_t n, const int pattern) {
+    for (size_t i = 0; i < n; ++i) {
+        switch (pattern) {
+            case 0: nums[i] = (uint32_t)rand(); break;
+            case 1: nums[i] = (uint32_t)i; break;
+            case 2: nums[i] = (uint32_t)(n - i); break;
+            case 3: nums[i] = (uint32_t)(rand() % 4); break;
+            default: nums[i] = (i % 100 == 0) ? (uint32_t)rand() : (uint32_t)i; break;
+        }
+    }
+}
+
+START_TEST(SortMatchesQsort) {
+    const size_t sizes[] = { 0, 1, 2, 16, 17, 129, 1000, 100003 };
+    Buffer_t buf;
+
+    srand(7);
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        for (int pattern = 0; pattern < 5; ++pattern) {
+            const size_t n = sizes[s];
+            uint32_t *input = malloc((n + 1) * sizeof(uint32_t));
+            uint32_t *expect = malloc((n + 1) * sizeof(uint32_t));
+
+            fill(input, n, pattern);
+            memcpy(expect, input, n * sizeof(uint32_t));
+            qsort(expect, n, sizeof(uint32_t), u32_cmp);
+
+            dsc_buf_init(&buf, n + (n == 0), sizeof(uint32_t));
+            buf.bsize = n * sizeof(uint32_t);
+            memcpy(buf.base, input, n * sizeof(uint32_t));
+            ck_assert_int_eq(dsc_sort(&buf, u32_cmp), DSC_EOK);
+            ck_assert_mem_eq(buf.base, expect, n * sizeof(uint32_t));
+
+            memcpy(buf.base, input, n * sizeof(uint32_t));
+            ck_assert_int_eq(dsc_sort_parallel(&buf, u32_cmp, 3), DSC_EOK);
+            ck_assert_mem_eq(buf.base, expect, n * sizeof(uint32_t));
+
+            buf.bsize = (n + (n == 0)) * sizeof(uint32_t);
+            dsc_buf_destroy(&buf);
+            free(input);
+            free(expect);
+        }
+    }
+}
+END_TEST
+
+START_TEST(SortWideElements) {
+    const size_t n = 5000;
+    Buffer_t buf;
+
+    dsc_buf_init(&buf, n, sizeof(Wide_t));
+    Wide_t *elems = buf.base;
+    for (size_t i = 0; i < n; ++i) {
+        elems[i].key = (uint64_t)rand() % 1000;
+        memset(elems[i].pad, (int)(elems[i].key & 0xFF), sizeof(elems[i].pad));
+    }
+
+    ck_assert_int_eq(dsc_sort(&buf, u64_cmp), DSC_EOK);
+    for (size_t i = 0; i < n; ++i) {
+        ck_assert(i == 0 || elems[i - 1].key <= elems[i].key);
+        ck_assert_int_eq(elems[i].pad[71], (int)(elems[i].key & 0xFF));
+    }
+
+    dsc_buf_destroy(&buf);
+}
+END_TEST
+
+START_TEST(StableKeepsOrder) {
+    const size_t n = 10007;
+    Buffer_t buf;
+
+    dsc_buf_init(&buf, n, sizeof(Pair_t));
+    Pair_t *pairs = buf.base;
+    for (size_t i = 0; i < n; ++i) {
+        pairs[i].key = (uint32_t)(rand() % 50);
+        pairs[i].seq = (uint32_t)i;
+    }
+
+    ck_assert_int_eq(dsc_sort_stable(&buf, u32_cmp), DSC_EOK);
+    for (size_t i = 1; i < n; ++i) {
+        ck_assert_uint_le(pairs[i - 1].key, pairs[i].key);
+        if (pairs[i - 1].key == pairs[i].key) {
+            ck_assert_uint_lt(pairs[i - 1].seq, pairs[i].seq);
+        }
+    }
+
+    dsc_buf_destroy(&buf);
+}
+END_TEST
+
+START_TEST(RadixSigned) {
+    const size_t n = 20000;
+    Buffer_t buf, expect;
+
+    // 64-bit signed, including the extremes
+    dsc_buf_init(&buf, n, sizeof(int64_t));
+    dsc_buf_init(&expect, n, sizeof(int64_t));
+    int64_t *nums = buf.base;
+    for (size_t i = 0; i < n; ++i) {
+        nums[i] = (int64_t)(((uint64_t)rand() << 31) ^ ((uint64_t)rand() << 2) ^ (i % 3));
+        nums[i] = (i % 2 == 0) ? -nums[i] : nums[i];
+    }
+    nums[0] = INT64_MIN;
+    nums[1] = INT64_MAX;
+    memcpy(expect.base, buf.base, buf.bsize);
+    qsort(expect.base, n, sizeof(int64_t), i64_cmp);
+    ck_assert_int_eq(dsc_sort_radix(&buf, RADIX_SIGNED), DSC_EOK);
+    ck_assert_mem_eq(buf.base, expect.base, buf.bsize);
+    dsc_buf_destroy(&buf);
+    dsc_buf_destroy(&expect);
+
+    // 16-bit signed, where most digits are shared and their passes are skipped
+    dsc_buf_init(&buf, n, sizeof(int16_t));
+    dsc_buf_init(&expect, n, sizeof(int16_t));
+    int16_t *shorts = buf.base;
+    for (size_t i = 0; i < n; ++i) {
+        shorts[i] = (int16_t)(rand() % 200 - 100);
+    }
+    memcpy(expect.base, buf.base, buf.bsize);
+    qsort(expect.base, n, sizeof(int16_t), i16_cmp);
+    ck_assert_int_eq(dsc_sort_radix(&buf, RADIX_SIGNED), DSC_EOK);
+    ck_assert_mem_eq(buf.base, expect.base, buf.bsize);
+    dsc_buf_destroy(&buf);
+    dsc_buf_destroy(&expect);
+}
+END_TEST
+
+START_TEST(RadixUnsigned) {
+    const size_t n = 20000;
+    Buffer_t buf, expect;
+
+    dsc_buf_init(&buf, n, sizeof(uint32_t));
+    dsc_buf_init(&expect, n, sizeof(uint32_t));
+    fill(buf.base, n, 0);
+    ((uint32_t*)buf.base)[0] = UINT32_MAX;
+    memcpy(expect.base, buf.base, buf.bsize);
+    qsort(expect.base, n, sizeof(uint32_t), u32_cmp);
+    ck_assert_int_eq(dsc_sort_radix(&buf, RADIX_UNSIGNED), DSC_EOK);
+    ck_assert_mem_eq(buf.base, expect.base, buf.bsize);
+    dsc_buf_destroy(&buf);
+    dsc_buf_destroy(&expect);
+
+    // Element sizes other than 1, 2, 4 and 8 are rejected
+    dsc_buf_init(&buf, 4, 3);
+    ck_assert_int_eq(dsc_sort_radix(&buf, RADIX_UNSIGNED), DSC_EINVAL);
+    dsc_buf_destroy(&buf);
+}
+END_TEST
+
+START_TEST(LowerBound) {
+    const size_t n = 1001;
+    Buffer_t buf;
+
+    dsc_buf_init(&buf, n, sizeof(uint32_t));
+    uint32_t *nums = buf.base;
+    for (size_t i = 0; i < n; ++i) {
+        nums[i] = (uint32_t)(i / 2) * 2; // Every even value twice
+    }
+
+    for (uint32_t key = 0; key <= 1002; ++key) {
+        size_t expect = 0;
+        while (expect < n && nums[expect] < key) {
+            ++expect;
+        }
+        ck_assert_uint_eq(dsc_lower_bound(&buf, &key, u32_cmp), expect);
+    }
+
+    buf.bsize = 0;
+    ck_assert_uint_eq(dsc_lower_bound(&buf, &(uint32_t){ 5 }, u32_cmp), 0);
+    buf.bsize = n * sizeof(uint32_t);
+
+    // Invalid arguments are rejected rather than dereferenced or divided by
+    ck_assert_uint_eq(dsc_lower_bound(NULL, &(uint32_t){ 5 }, u32_cmp), 0);
+    ck_assert_uint_eq(dsc_lower_bound(&buf, NULL, u32_cmp), 0);
+    ck_assert_uint_eq(dsc_lower_bound(&buf, &(uint32_t){ 5 }, NULL), 0);
+    buf.tsize = 0;
+    ck_assert_uint_eq(dsc_lower_bound(&buf, &(uint32_t){ 5 }, u32_cmp), 0);
+    buf.tsize = sizeof(uint32_t);
+    dsc_buf_destroy(&buf);
+}
+END_TEST
+
+Suite *sort_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Sort");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, SortMatchesQsort);
+    tcase_add_test(tc_core, SortWideElements);
+    tcase_add_test(tc_core, StableKeepsOrder);
+    tcase_add_test(tc_core, RadixSigned);
+    tcase_add_test(tc_core, RadixUnsigned);
+    tcase_add_test(tc_core, LowerBound);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = sort_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
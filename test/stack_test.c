@@ -8,26 +8,54 @@ START_TEST(CreateStack) {
     Stack_t stack = { 0 };
     long data = 9999999999999;
     dsc_stack_init(&stack, &data, sizeof(long));
-    ck_assert_ptr_nonnull(stack.base);
-    ck_assert_int_eq(stack.tsize, sizeof(long));
-    ck_assert_int_eq(stack.bsize, sizeof(long));
+    ck_assert_ptr_nonnull(stack.buf.base);
+    ck_assert_int_eq(stack.buf.tsize, sizeof(long));
+    ck_assert_int_eq(stack.buf.bsize, sizeof(long));
     ck_assert_int_eq(dsc_stack_nelem(&stack), 1);
+    ck_assert_int_eq(*(long*)dsc_stack_peek(&stack), data);
+    dsc_stack_destroy(&stack);
 }
 END_TEST
 
 START_TEST(PopStack) {
     Stack_t stack = { 0 };
-    dsc_stack_init(&stack, (void*)strdup("Some"), sizeof(char*));
-    dsc_stack_push(&stack, (void*)strdup("test"));
-    dsc_stack_push(&stack, (void*)strdup("data"));
+    const char *words[] = { "Some", "test", "data" };
+    dsc_stack_init(&stack, &words[0], sizeof(char*));
+    dsc_stack_push(&stack, &words[1]);
+    dsc_stack_push(&stack, &words[2]);
     ck_assert_int_eq(dsc_stack_nelem(&stack), 3);
 
     void *top = dsc_stack_peek(&stack);
-    ck_assert_str_eq((char*)top, "data");
+    ck_assert_str_eq(*(char**)top, "data");
 
     dsc_stack_pop(&stack);
     top = dsc_stack_peek(&stack);
-    ck_assert_str_eq((char*)top, "test");
+    ck_assert_str_eq(*(char**)top, "test");
+    dsc_stack_destroy(&stack);
+}
+END_TEST
+
+START_TEST(InlineStack) {
+    Stack_t stack = { 0 };
+    int value = 0;
+
+    dsc_stack_init(&stack, &value, sizeof(int));
+    ck_assert_ptr_eq(stack.buf.base, stack.small);
+    for (value = 1; value < 100; ++value) {
+        dsc_stack_push(&stack, &value);
+        // Stays inline until it outgrows DSC_BUF_SMALL bytes
+        ck_assert_int_eq(stack.buf.backing == BUF_INLINE, (value + 1) * sizeof(int) <= DSC_BUF_SMALL);
+    }
+    for (value = 99; value >= 0; --value) {
+        ck_assert_int_eq(*(int*)dsc_stack_peek(&stack), value);
+        ck_assert_int_eq(dsc_stack_pop(&stack), DSC_EOK);
+    }
+
+    // Emptying the stack returns it to the inline storage
+    ck_assert_int_eq(dsc_stack_nelem(&stack), 0);
+    ck_assert_int_eq(stack.buf.backing, BUF_INLINE);
+    ck_assert_int_eq(dsc_stack_pop(&stack), DSC_ENODATA);
+    dsc_stack_destroy(&stack);
 }
 END_TEST
 
@@ -41,6 +69,7 @@ Suite *buffer_suite(void) {
     tc_core = tcase_create("Core");
     tcase_add_test(tc_core, CreateStack);
     tcase_add_test(tc_core, PopStack);
+    tcase_add_test(tc_core, InlineStack);
     suite_add_tcase(s, tc_core);
 
     return s;
@@ -0,0 +1,147 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "stree.h"
+
+static int int_cmp(const void *lhs, const void *rhs) {
+    const int a = *(const int*)lhs;
+    const int b = *(const int*)rhs;
+    return (a > b) - (a < b);
+}
+
+static InsertCmp_t int_insert(const BTreeNode_t node, const BTreeNode_t cmp) {
+    return (*(int*)cmp->data < *(int*)node->data) ? INSERT_LT : INSERT_GT;
+}
+
+START_TEST(FromSorted) {
+    Buffer_t sorted = { 0 };
+    STree_t tree = { 0 };
+
+    // Every size up to a few full levels, so that each shape of last level is covered
+    for (size_t n = 0; n < 70; ++n) {
+        dsc_buf_init(&sorted, n, sizeof(int));
+        for (size_t i = 0; i < n; ++i) {
+            ((int*)sorted.base)[i] = (int)i * 2;
+        }
+        ck_assert_int_eq(dsc_stree_from_sorted(&tree, &sorted, int_cmp), DSC_EOK);
+        dsc_buf_destroy(&sorted);
+
+        for (int key = -1; key <= (int)n * 2; ++key) {
+            const int *bound = dsc_stree_lower_bound(&tree, &key);
+            const int expect = (key < 0) ? 0 : (key + 1) / 2 * 2;
+            if (expect >= (int)n * 2) {
+                ck_assert_ptr_null(bound);
+            } else {
+                ck_assert_ptr_nonnull(bound);
+                ck_assert_int_eq(*bound, expect);
+            }
+            ck_assert_int_eq(dsc_stree_find(&tree, &key) != NULL, key >= 0 && key % 2 == 0 && key < (int)n * 2);
+        }
+        dsc_stree_destroy(&tree);
+    }
+}
+END_TEST
+
+START_TEST(FromBTree) {
+    int nums[] = { 8, 5, 2, 10, 7, 21, 3 };
+    STree_t tree = { 0 };
+
+    BTreeNode_t root = dsc_btree_create(&nums[0], NULL, DFS);
+    for (size_t i = 1; i < sizeof(nums) / sizeof(*nums); ++i) {
+        dsc_btree_add(root, &nums[i], NULL, int_insert);
+    }
+    ck_assert_int_eq(dsc_stree_from_btree(&tree, root, sizeof(int), int_cmp), DSC_EOK);
+    dsc_btree_destroy(root);
+
+    ck_assert_int_eq(tree.nelem, 7);
+    ck_assert_int_eq(*(const int*)dsc_stree_find(&tree, &(int){ 21 }), 21);
+    ck_assert_int_eq(*(const int*)dsc_stree_lower_bound(&tree, &(int){ 9 }), 10);
+    ck_assert_ptr_null(dsc_stree_find(&tree, &(int){ 4 }));
+    dsc_stree_destroy(&tree);
+}
+END_TEST
+
+// Allocator that fails once the budget in *ctx runs out (a negative budget never runs out)
+static bool oom_take(void *ctx) {
+    int *budget = ctx;
+    return *budget < 0 || (*budget)-- > 0;
+}
+
+static void *oom_alloc(void *ctx, size_t size) {
+    return oom_take(ctx) ? malloc(size) : NULL;
+}
+
+static void *oom_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)old_size;
+    return oom_take(ctx) ? realloc(ptr, new_size) : NULL;
+}
+
+static void oom_free(void *ctx, void *ptr, size_t size) {
+    (void)ctx;
+    (void)size;
+    free(ptr);
+}
+
+START_TEST(FromBTreeOutOfMemory) {
+    int nums[64];
+    int budget = -1;
+    DscAllocator_t alloc = { oom_alloc, oom_realloc, oom_free, &budget, NULL };
+    STree_t tree = { 0 };
+    DscError_t status = DSC_ENOMEM;
+
+    // A long left spine under the root's right child outgrows the cursor's inline path
+    nums[0] = 0;
+    BTreeNode_t root = dsc_btree_create_alloc(&nums[0], NULL, DFS, &alloc);
+    for (int i = 1; i < 64; ++i) {
+        nums[i] = 64 - i;
+        dsc_btree_add(root, &nums[i], NULL, int_insert);
+    }
+
+    // Run out at every point of both walks in turn until the build gets through
+    for (budget = 0; status == DSC_ENOMEM; ++budget) {
+        const int allowed = budget;
+        status = dsc_stree_from_btree(&tree, root, sizeof(int), int_cmp);
+        budget = allowed;
+    }
+    ck_assert_int_eq(status, DSC_EOK);
+    ck_assert_int_gt(budget, 1); // Both walks needed the allocator, so both were failed at least once
+    ck_assert_int_eq(tree.nelem, 64);
+    ck_assert_int_eq(*(const int*)dsc_stree_find(&tree, &(int){ 63 }), 63);
+    dsc_stree_destroy(&tree);
+
+    budget = -1;
+    dsc_btree_destroy(root);
+}
+END_TEST
+
+Suite *stree_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("STree");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, FromSorted);
+    tcase_add_test(tc_core, FromBTree);
+    tcase_add_test(tc_core, FromBTreeOutOfMemory);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = stree_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,141 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "twheel.h"
+
+#define NTIMERS 2000
+
+static uint64_t prev_now;
+static uint64_t cur_now;
+static size_t   nfired;
+
+// Checks that a timer fires during the first advance that reaches its expiry
+static void on_fire(Timer_t *timer, void *ctx) {
+    (void)ctx;
+    ck_assert_uint_le(timer->expires, cur_now);
+    ck_assert_uint_gt(timer->expires, prev_now);
+    ++nfired;
+}
+
+static void on_periodic(Timer_t *timer, void *ctx) {
+    TimerWheel_t *wheel = ctx;
+    ++nfired;
+    dsc_twheel_schedule(wheel, timer, timer->expires + 10);
+}
+
+static void advance_to(TimerWheel_t *wheel, const uint64_t now) {
+    cur_now = now;
+    dsc_twheel_advance(wheel, now);
+    prev_now = now;
+}
+
+START_TEST(ExpireAtTick) {
+    static TimerWheel_t wheel;
+    static Timer_t timers[NTIMERS];
+    const uint64_t start = 1000;
+
+    dsc_twheel_init(&wheel, start + 1);
+    prev_now = start;
+    nfired = 0;
+
+    // Spread expiries over every level, including ones beyond the top level
+    for (size_t i = 0; i < NTIMERS; ++i) {
+        const uint64_t span = 1ULL << (i % 40);
+        dsc_timer_init(&timers[i], on_fire, NULL);
+        dsc_twheel_schedule(&wheel, &timers[i], start + 1 + (i * 2654435761ULL) % span);
+    }
+    ck_assert_uint_eq(dsc_twheel_count(&wheel), NTIMERS);
+
+    // Advance in uneven steps, then in large jumps
+    uint64_t now = start;
+    for (size_t step = 0; step < 20000; ++step) {
+        now += 1 + step % 7;
+        advance_to(&wheel, now);
+    }
+    while (dsc_twheel_count(&wheel) != 0) {
+        now += 1ULL << 28;
+        advance_to(&wheel, now);
+    }
+    ck_assert_uint_eq(nfired, NTIMERS);
+    for (size_t i = 0; i < NTIMERS; ++i) {
+        ck_assert(!dsc_timer_pending(&timers[i]));
+    }
+}
+END_TEST
+
+START_TEST(CancelReschedule) {
+    static TimerWheel_t wheel;
+    static Timer_t timers[100];
+
+    dsc_twheel_init(&wheel, 1);
+    prev_now = 0;
+    nfired = 0;
+    for (size_t i = 0; i < 100; ++i) {
+        dsc_timer_init(&timers[i], on_fire, NULL);
+        dsc_twheel_schedule(&wheel, &timers[i], 100 + i * 100);
+    }
+
+    for (size_t i = 0; i < 100; i += 2) {
+        ck_assert_int_eq(dsc_twheel_cancel(&wheel, &timers[i]), DSC_EOK);
+        ck_assert_int_eq(dsc_twheel_cancel(&wheel, &timers[i]), DSC_ENODATA);
+    }
+    // Moving a pending timer does not count it twice
+    dsc_twheel_schedule(&wheel, &timers[1], 50);
+    ck_assert_uint_eq(dsc_twheel_count(&wheel), 50);
+
+    advance_to(&wheel, 60);
+    ck_assert_uint_eq(nfired, 1);
+    advance_to(&wheel, 100000);
+    ck_assert_uint_eq(nfired, 50);
+    ck_assert_uint_eq(dsc_twheel_count(&wheel), 0);
+}
+END_TEST
+
+START_TEST(Periodic) {
+    static TimerWheel_t wheel;
+    Timer_t timer;
+
+    dsc_twheel_init(&wheel, 0);
+    nfired = 0;
+    dsc_timer_init(&timer, on_periodic, &wheel);
+    dsc_twheel_schedule(&wheel, &timer, 10);
+
+    // A callback that reschedules itself fires once per period, even within one advance
+    ck_assert_uint_eq(dsc_twheel_advance(&wheel, 1000), 100);
+    ck_assert_uint_eq(nfired, 100);
+    ck_assert(dsc_timer_pending(&timer));
+    ck_assert_int_eq(dsc_twheel_cancel(&wheel, &timer), DSC_EOK);
+}
+END_TEST
+
+Suite *twheel_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("TimerWheel");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, ExpireAtTick);
+    tcase_add_test(tc_core, CancelReschedule);
+    tcase_add_test(tc_core, Periodic);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = twheel_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}